@@ -0,0 +1,22 @@
+/**
+ * @file benchrunner.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Benchmark runner for hvcommon
+ *
+ * Results can be exported with --benchmark_out=<file> and
+ * --benchmark_out_format=json|csv|console.
+ */
+#include <systemc>
+#include "benchmark/benchmark.h"
+
+int sc_main(int argc, char* argv[]) {
+	::benchmark::Initialize(&argc, argv);
+	if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+		return 1;
+	}
+	::benchmark::RunSpecifiedBenchmarks();
+	return 0;
+}
@@ -0,0 +1,80 @@
+/**
+ * @file bitmapallocatorbench.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Bitmap allocator benchmarks against bit-by-bit first fit
+ */
+
+#include <limits>
+#include "benchmark/benchmark.h"
+#include "bitmapallocator.h"
+
+using namespace ::hv::common;
+
+typedef BitVector::bvsize_t bvsize_t;
+
+/**
+ * Bitmap size: 4M bits with 32-bit BitVector sizes (HV_BV_WIDE_SIZE), else
+ * the largest BitVector
+ */
+#define BITMAP_SIZE (std::numeric_limits<bvsize_t>::max() > (1u << 22) ? \
+		(1u << 22) : static_cast<hvuint32_t>(std::numeric_limits<bvsize_t>::max()))
+
+/**
+ * Fragmented allocator: random single bits allocated, then one run of
+ * state.range(0) bits made free near the end
+ */
+static void fragment(BitmapAllocator &alloc, const bvsize_t &runLength) {
+	RandomEngine rng(1u);
+	for (unsigned int i = 0u; i < BITMAP_SIZE; i += 1u + rng() % runLength) {
+		alloc.allocateAt(static_cast<bvsize_t>(i), 1u);
+	}
+	for (unsigned int i = BITMAP_SIZE - 2u * runLength; i < BITMAP_SIZE - runLength; i++) {
+		if (!alloc.isFree(static_cast<bvsize_t>(i), 1u)) {
+			alloc.free(static_cast<bvsize_t>(i), 1u);
+		}
+	}
+}
+
+/**
+ * Allocation and release of a run in a fragmented bitmap
+ */
+static void BM_BitmapAllocator(benchmark::State &state) {
+	const bvsize_t n(static_cast<bvsize_t>(state.range(0)));
+	BitmapAllocator alloc(BITMAP_SIZE,
+			state.range(1) ? ALLOC_BEST_FIT : ALLOC_FIRST_FIT);
+	fragment(alloc, n);
+	for (auto _ : state) {
+		const bvsize_t start(alloc.allocateRun(n));
+		alloc.free(start, n);
+		benchmark::DoNotOptimize(start);
+	}
+}
+
+/**
+ * Same allocation, testing the bitmap cells bit by bit
+ */
+static void BM_BitByBitFirstFit(benchmark::State &state) {
+	const bvsize_t n(static_cast<bvsize_t>(state.range(0)));
+	BitmapAllocator alloc(BITMAP_SIZE);
+	fragment(alloc, n);
+	const BitVector::bvdata_t *d(alloc.getBitmap().getDataAddress());
+	for (auto _ : state) {
+		unsigned int start(0u), length(0u);
+		for (unsigned int i = 0u; (i < BITMAP_SIZE) && (length < n); i++) {
+			if ((d[i / 32u] >> (i % 32u)) & 1u) {
+				start = i + 1u;
+				length = 0u;
+			} else {
+				length++;
+			}
+		}
+		benchmark::DoNotOptimize(start);
+	}
+}
+
+BENCHMARK(BM_BitmapAllocator)->Args( { 16, 0 })->Args( { 256, 0 })->Args( {
+		16, 1 })->Args( { 256, 1 });
+BENCHMARK(BM_BitByBitFirstFit)->Arg(16)->Arg(256);
@@ -0,0 +1,578 @@
+/**
+ * @file bitvectorbench.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief BitVector benchmarks against sc_dt::sc_bv, std::bitset and boost::dynamic_bitset
+ *
+ * Each operation is benchmarked through an implementation adapter so all
+ * containers run the exact same code. boost::dynamic_bitset benchmarks are
+ * only built if HV_BENCH_HAS_BOOST is defined.
+ */
+
+#include <bitset>
+#include <string>
+#include <vector>
+#include <systemc>
+#include <cci_configuration>
+#include "benchmark/benchmark.h"
+#include "bitvector.h"
+#include "random.h"
+#ifdef HV_BENCH_HAS_BOOST
+#include <boost/dynamic_bitset.hpp>
+#endif
+
+using namespace ::hv::common;
+
+/**
+ * Slice bounds used by slice benchmarks: middle half of the vector
+ */
+#define HV_BENCH_SLICE_LOW(W) ((W) / 4)
+#define HV_BENCH_SLICE_LEN(W) ((W) / 2 > 0 ? (W) / 2 : 1)
+#define HV_BENCH_SLICE_HIGH(W) (HV_BENCH_SLICE_LOW(W) + HV_BENCH_SLICE_LEN(W) - 1)
+
+/**
+ * BitVector adapter
+ */
+template<int W> struct BitVectorImpl {
+	typedef BitVector type;
+	typedef BitVector slice_type;
+
+	static type make() {
+		return BitVector(W, 0u);
+	}
+
+	static void randomize(type &x, RandomEngine &engine) {
+		x.rand(engine);
+	}
+
+	static slice_type makeSlice(RandomEngine &engine) {
+		BitVector ret(HV_BENCH_SLICE_LEN(W), 0u);
+		ret.rand(engine);
+		return ret;
+	}
+
+	static slice_type getSlice(const type &x) {
+		return x(HV_BENCH_SLICE_HIGH(W), HV_BENCH_SLICE_LOW(W));
+	}
+
+	static void setSlice(type &x, const slice_type &s) {
+		x(HV_BENCH_SLICE_HIGH(W), HV_BENCH_SLICE_LOW(W)) = s;
+	}
+
+	static std::string toString(const type &x) {
+		return x.toString();
+	}
+};
+
+/**
+ * sc_dt::sc_bv adapter
+ */
+template<int W> struct ScBvImpl {
+	typedef sc_dt::sc_bv<W> type;
+	typedef sc_dt::sc_bv<HV_BENCH_SLICE_LEN(W)> slice_type;
+
+	static type make() {
+		return type();
+	}
+
+	template<typename T> static void randomizeWords(T &x,
+			RandomEngine &engine) {
+		for (int i = 0; i < x.size(); i++) {
+			x.set_word(i, static_cast<sc_dt::sc_digit>(engine()));
+		}
+		x.clean_tail();
+	}
+
+	static void randomize(type &x, RandomEngine &engine) {
+		randomizeWords(x, engine);
+	}
+
+	static slice_type makeSlice(RandomEngine &engine) {
+		slice_type ret;
+		randomizeWords(ret, engine);
+		return ret;
+	}
+
+	static slice_type getSlice(const type &x) {
+		return slice_type(x.range(HV_BENCH_SLICE_HIGH(W), HV_BENCH_SLICE_LOW(W)));
+	}
+
+	static void setSlice(type &x, const slice_type &s) {
+		x.range(HV_BENCH_SLICE_HIGH(W), HV_BENCH_SLICE_LOW(W)) = s;
+	}
+
+	static std::string toString(const type &x) {
+		return x.to_string();
+	}
+};
+
+/**
+ * std::bitset adapter
+ * Slices are emulated with shifts and masks.
+ */
+template<int W> struct StdBitsetImpl {
+	typedef std::bitset<W> type;
+	typedef std::bitset<W> slice_type;
+
+	static type make() {
+		return type();
+	}
+
+	static void randomize(type &x, RandomEngine &engine) {
+		hvuint64_t r(0u);
+		for (int i = 0; i < W; i++) {
+			if (!(i % 64)) {
+				r = engine();
+			}
+			x[i] = (r >> (i % 64)) & 1u;
+		}
+	}
+
+	static slice_type makeSlice(RandomEngine &engine) {
+		slice_type ret;
+		randomize(ret, engine);
+		return (ret << (W - HV_BENCH_SLICE_LEN(W))) >> (W - HV_BENCH_SLICE_LEN(W));
+	}
+
+	static slice_type getSlice(const type &x) {
+		return ((x >> HV_BENCH_SLICE_LOW(W)) << (W - HV_BENCH_SLICE_LEN(W)))
+				>> (W - HV_BENCH_SLICE_LEN(W));
+	}
+
+	static void setSlice(type &x, const slice_type &s) {
+		const type mask(((~type()) >> (W - HV_BENCH_SLICE_LEN(W)))
+				<< HV_BENCH_SLICE_LOW(W));
+		x = (x & ~mask) | ((s << HV_BENCH_SLICE_LOW(W)) & mask);
+	}
+
+	static std::string toString(const type &x) {
+		return x.to_string();
+	}
+};
+
+#ifdef HV_BENCH_HAS_BOOST
+/**
+ * boost::dynamic_bitset adapter
+ * Slices are emulated with shifts and masks.
+ */
+template<int W> struct BoostBitsetImpl {
+	typedef boost::dynamic_bitset<> type;
+	typedef boost::dynamic_bitset<> slice_type;
+
+	static type make() {
+		return type(W);
+	}
+
+	static void randomize(type &x, RandomEngine &engine) {
+		hvuint64_t r(0u);
+		for (int i = 0; i < W; i++) {
+			if (!(i % 64)) {
+				r = engine();
+			}
+			x[i] = (r >> (i % 64)) & 1u;
+		}
+	}
+
+	static slice_type makeSlice(RandomEngine &engine) {
+		slice_type ret(W);
+		randomize(ret, engine);
+		return (ret << (W - HV_BENCH_SLICE_LEN(W))) >> (W - HV_BENCH_SLICE_LEN(W));
+	}
+
+	static slice_type getSlice(const type &x) {
+		return ((x >> HV_BENCH_SLICE_LOW(W)) << (W - HV_BENCH_SLICE_LEN(W)))
+				>> (W - HV_BENCH_SLICE_LEN(W));
+	}
+
+	static void setSlice(type &x, const slice_type &s) {
+		const type mask((~type(W)) >> (W - HV_BENCH_SLICE_LEN(W))
+				<< HV_BENCH_SLICE_LOW(W));
+		x = (x & ~mask) | ((s << HV_BENCH_SLICE_LOW(W)) & mask);
+	}
+
+	static std::string toString(const type &x) {
+		std::string ret;
+		boost::to_string(x, ret);
+		return ret;
+	}
+};
+#endif
+
+//** Generic benchmarks **//
+template<typename I> static void BM_Construct(benchmark::State &state) {
+	for (auto _ : state) {
+		typename I::type x(I::make());
+		benchmark::DoNotOptimize(x);
+	}
+}
+
+template<typename I> static void BM_And(benchmark::State &state) {
+	RandomEngine engine(1u);
+	typename I::type a(I::make()), b(I::make()), c(I::make());
+	I::randomize(a, engine);
+	I::randomize(b, engine);
+	for (auto _ : state) {
+		c = a & b;
+		benchmark::DoNotOptimize(c);
+	}
+}
+
+template<typename I> static void BM_Or(benchmark::State &state) {
+	RandomEngine engine(1u);
+	typename I::type a(I::make()), b(I::make()), c(I::make());
+	I::randomize(a, engine);
+	I::randomize(b, engine);
+	for (auto _ : state) {
+		c = a | b;
+		benchmark::DoNotOptimize(c);
+	}
+}
+
+template<typename I> static void BM_Xor(benchmark::State &state) {
+	RandomEngine engine(1u);
+	typename I::type a(I::make()), b(I::make()), c(I::make());
+	I::randomize(a, engine);
+	I::randomize(b, engine);
+	for (auto _ : state) {
+		c = a ^ b;
+		benchmark::DoNotOptimize(c);
+	}
+}
+
+template<typename I> static void BM_Not(benchmark::State &state) {
+	RandomEngine engine(1u);
+	typename I::type a(I::make()), c(I::make());
+	I::randomize(a, engine);
+	for (auto _ : state) {
+		c = ~a;
+		benchmark::DoNotOptimize(c);
+	}
+}
+
+template<typename I> static void BM_ShiftLeft(benchmark::State &state) {
+	RandomEngine engine(1u);
+	typename I::type a(I::make()), c(I::make());
+	I::randomize(a, engine);
+	const int n(static_cast<int>(state.range(0)));
+	for (auto _ : state) {
+		c = a << n;
+		benchmark::DoNotOptimize(c);
+	}
+}
+
+template<typename I> static void BM_ShiftRight(benchmark::State &state) {
+	RandomEngine engine(1u);
+	typename I::type a(I::make()), c(I::make());
+	I::randomize(a, engine);
+	const int n(static_cast<int>(state.range(0)));
+	for (auto _ : state) {
+		c = a >> n;
+		benchmark::DoNotOptimize(c);
+	}
+}
+
+template<typename I> static void BM_SliceRead(benchmark::State &state) {
+	RandomEngine engine(1u);
+	typename I::type a(I::make());
+	I::randomize(a, engine);
+	for (auto _ : state) {
+		typename I::slice_type s(I::getSlice(a));
+		benchmark::DoNotOptimize(s);
+	}
+}
+
+template<typename I> static void BM_SliceWrite(benchmark::State &state) {
+	RandomEngine engine(1u);
+	typename I::type a(I::make());
+	I::randomize(a, engine);
+	const typename I::slice_type s(I::makeSlice(engine));
+	for (auto _ : state) {
+		I::setSlice(a, s);
+		benchmark::ClobberMemory();
+	}
+}
+
+template<typename I> static void BM_ToString(benchmark::State &state) {
+	RandomEngine engine(1u);
+	typename I::type a(I::make());
+	I::randomize(a, engine);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(I::toString(a));
+	}
+}
+
+template<typename I> static void BM_Equal(benchmark::State &state) {
+	RandomEngine engine(1u);
+	typename I::type a(I::make());
+	I::randomize(a, engine);
+	const typename I::type b(a);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(a == b);
+	}
+}
+
+//** BitVector-only benchmarks **//
+template<int W> static void BM_CciPack(benchmark::State &state) {
+	RandomEngine engine(1u);
+	BitVector a(W, 0u);
+	a.rand(engine);
+	for (auto _ : state) {
+		cci::cci_value v(a);
+		benchmark::DoNotOptimize(v);
+	}
+}
+
+template<int W> static void BM_CciUnpack(benchmark::State &state) {
+	RandomEngine engine(1u);
+	BitVector a(W, 0u), b(W, 0u);
+	a.rand(engine);
+	const cci::cci_value v(a);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(v.try_get(b));
+	}
+}
+
+// 512-bit bus beat built from 16 32-bit fields
+static void BM_ConcatChained(benchmark::State &state) {
+	RandomEngine engine(1u);
+	std::vector<BitVector> f(16, BitVector(32, 0u));
+	for (auto &x : f) {
+		x.rand(engine);
+	}
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(
+				f[0] + f[1] + f[2] + f[3] + f[4] + f[5] + f[6] + f[7] + f[8]
+						+ f[9] + f[10] + f[11] + f[12] + f[13] + f[14]
+						+ f[15]);
+	}
+}
+BENCHMARK(BM_ConcatChained);
+
+static void BM_ConcatNary(benchmark::State &state) {
+	RandomEngine engine(1u);
+	std::vector<BitVector> f(16, BitVector(32, 0u));
+	for (auto &x : f) {
+		x.rand(engine);
+	}
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(
+				concat(f[0], f[1], f[2], f[3], f[4], f[5], f[6], f[7], f[8],
+						f[9], f[10], f[11], f[12], f[13], f[14], f[15]));
+	}
+}
+BENCHMARK(BM_ConcatNary);
+
+/**
+ * Round-robin arbitration among 1024 requesters, a few of them active
+ */
+static BitVector roundRobinRequests() {
+	BitVector ret(1024u, 0u);
+	for (auto i : { 3u, 200u, 517u, 1000u }) {
+		ret[i] = true;
+	}
+	return ret;
+}
+
+static void BM_RoundRobinFindNextSet(benchmark::State &state) {
+	const BitVector req(roundRobinRequests());
+	BitVector::bvsize_t last(0u);
+	for (auto _ : state) {
+		last = req.findNextSet(last + 1u, true);
+		benchmark::DoNotOptimize(last);
+	}
+}
+BENCHMARK(BM_RoundRobinFindNextSet);
+
+static void BM_RoundRobinBitLoop(benchmark::State &state) {
+	const BitVector req(roundRobinRequests());
+	const BitVector::bvsize_t size(req.getSize());
+	BitVector::bvsize_t last(0u);
+	for (auto _ : state) {
+		for (BitVector::bvsize_t i = 1u; i <= size; i++) {
+			const BitVector::bvsize_t ind((last + i) % size);
+			if (static_cast<bool>(req[ind])) {
+				last = ind;
+				break;
+			}
+		}
+		benchmark::DoNotOptimize(last);
+	}
+}
+BENCHMARK(BM_RoundRobinBitLoop);
+
+#define HV_BENCH_GENERIC(I) \
+	BENCHMARK_TEMPLATE(BM_Construct, I); \
+	BENCHMARK_TEMPLATE(BM_And, I); \
+	BENCHMARK_TEMPLATE(BM_Or, I); \
+	BENCHMARK_TEMPLATE(BM_Xor, I); \
+	BENCHMARK_TEMPLATE(BM_Not, I); \
+	BENCHMARK_TEMPLATE(BM_ShiftLeft, I)->Arg(1)->Arg(33); \
+	BENCHMARK_TEMPLATE(BM_ShiftRight, I)->Arg(1)->Arg(33); \
+	BENCHMARK_TEMPLATE(BM_SliceRead, I); \
+	BENCHMARK_TEMPLATE(BM_SliceWrite, I); \
+	BENCHMARK_TEMPLATE(BM_ToString, I); \
+	BENCHMARK_TEMPLATE(BM_Equal, I)
+
+#ifdef HV_BENCH_HAS_BOOST
+#define HV_BENCH_BOOST(W) HV_BENCH_GENERIC(BoostBitsetImpl<W>)
+#else
+#define HV_BENCH_BOOST(W) static_assert(true, "")
+#endif
+
+#define HV_BENCH_WIDTH(W) \
+	HV_BENCH_GENERIC(BitVectorImpl<W>); \
+	HV_BENCH_GENERIC(ScBvImpl<W>); \
+	HV_BENCH_GENERIC(StdBitsetImpl<W>); \
+	HV_BENCH_BOOST(W); \
+	BENCHMARK_TEMPLATE(BM_CciPack, W); \
+	BENCHMARK_TEMPLATE(BM_CciUnpack, W)
+
+HV_BENCH_WIDTH(8);
+HV_BENCH_WIDTH(32);
+HV_BENCH_WIDTH(64);
+HV_BENCH_WIDTH(65);
+HV_BENCH_WIDTH(128);
+HV_BENCH_WIDTH(512);
+HV_BENCH_WIDTH(4096);
+
+/**
+ * Register model idiom: compare against a literal, then mask a field
+ */
+template<int W> static void BM_ScalarOperators(benchmark::State &state) {
+	RandomEngine engine(1u);
+	BitVector a(W, 0u);
+	a.rand(engine);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(a == 0x5Au);
+		benchmark::DoNotOptimize(a != 0x5Au);
+		a |= 0x10u;
+		a &= 0xFFFFFFEFu;
+	}
+}
+BENCHMARK_TEMPLATE(BM_ScalarOperators, 32);
+BENCHMARK_TEMPLATE(BM_ScalarOperators, 128);
+
+/**
+ * Same operations through BitVector operands
+ */
+template<int W> static void BM_ScalarOperatorsConverted(
+		benchmark::State &state) {
+	RandomEngine engine(1u);
+	BitVector a(W, 0u);
+	a.rand(engine);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(a == BitVector(32u, 0x5Au));
+		benchmark::DoNotOptimize(a != BitVector(32u, 0x5Au));
+		a |= BitVector(32u, 0x10u);
+		a &= BitVector(32u, 0xFFFFFFEFu);
+	}
+}
+BENCHMARK_TEMPLATE(BM_ScalarOperatorsConverted, 32);
+BENCHMARK_TEMPLATE(BM_ScalarOperatorsConverted, 128);
+
+#ifdef HV_HAS_INT128
+/**
+ * 128-bit register write and read back
+ */
+static void BM_Int128Native(benchmark::State &state) {
+	BitVector reg(128u, false);
+	hvuint128_t v(0x0123456789ABCDEFull);
+	for (auto _ : state) {
+		reg = v;
+		v = static_cast<hvuint128_t>(reg) + 1u;
+	}
+	benchmark::DoNotOptimize(v);
+}
+BENCHMARK(BM_Int128Native);
+
+/**
+ * Same through two 64-bit halves
+ */
+static void BM_Int128Halves(benchmark::State &state) {
+	BitVector reg(128u, false);
+	hvuint128_t v(0x0123456789ABCDEFull);
+	for (auto _ : state) {
+		reg = static_cast<hvuint64_t>(v);
+		reg(127u, 64u) = static_cast<hvuint64_t>(v >> 64);
+		v = ((static_cast<hvuint128_t>(static_cast<hvuint64_t>(reg >> 64u)) << 64)
+				| static_cast<hvuint64_t>(reg)) + 1u;
+	}
+	benchmark::DoNotOptimize(v);
+}
+BENCHMARK(BM_Int128Halves);
+#endif
+
+/**
+ * Snapshot of 1000 registers, with storage sharing enabled (argument 1) or
+ * not (argument 0), then a write to one register
+ */
+template<int W> static void BM_Snapshot(benchmark::State &state) {
+	const BitVector::bvsize_t threshold(BitVector::getShareThreshold());
+	BitVector::setShareThreshold(state.range(0) ? W : 0u);
+	RandomEngine engine(1u);
+	std::vector<BitVector> regs(1000u, BitVector(W, 0u));
+	for (BitVector &r : regs) {
+		r.rand(engine);
+	}
+	for (auto _ : state) {
+		std::vector<BitVector> snapshot(regs);
+		regs[0] ^= BitVector(W, 1u);
+		benchmark::DoNotOptimize(snapshot.data());
+	}
+	BitVector::setShareThreshold(threshold);
+}
+BENCHMARK_TEMPLATE(BM_Snapshot, 256)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_Snapshot, 4096)->Arg(0)->Arg(1);
+
+/**
+ * Register dump through toString()
+ */
+template<int W> static void BM_FormatToString(benchmark::State &state) {
+	RandomEngine engine(1u);
+	BitVector a(W, 0u);
+	a.rand(engine);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(a.toString());
+	}
+}
+BENCHMARK_TEMPLATE(BM_FormatToString, 64);
+BENCHMARK_TEMPLATE(BM_FormatToString, 1024);
+
+/**
+ * Same dump through the fmt formatter, in binary and hexadecimal, into a
+ * reused buffer
+ */
+template<int W> static void BM_FormatFmt(benchmark::State &state) {
+	RandomEngine engine(1u);
+	BitVector a(W, 0u);
+	a.rand(engine);
+	fmt::memory_buffer buf;
+	for (auto _ : state) {
+		buf.clear();
+		fmt::format_to(std::back_inserter(buf), "{} {:#_x}", a, a);
+		benchmark::DoNotOptimize(buf.data());
+	}
+}
+BENCHMARK_TEMPLATE(BM_FormatFmt, 64);
+BENCHMARK_TEMPLATE(BM_FormatFmt, 1024);
+
+/**
+ * Log call filtered out at run time, with the BitVector formatted by fmt
+ * (argument 1) or converted with toString() first (argument 0)
+ */
+template<int W> static void BM_LogFiltered(benchmark::State &state) {
+	const log::LogLevel previous(getLogLevel());
+	setLogLevel(log::error);
+	BitVector a(W, 0u);
+	for (auto _ : state) {
+		if (state.range(0)) {
+			HV_LOG_WARNING("reg = {}", a);
+		} else {
+			HV_LOG_WARNING("reg = {}", a.toString());
+		}
+	}
+	setLogLevel(previous);
+}
+BENCHMARK_TEMPLATE(BM_LogFiltered, 1024)->Arg(0)->Arg(1);
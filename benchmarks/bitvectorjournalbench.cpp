@@ -0,0 +1,66 @@
+/**
+ * @file bitvectorjournalbench.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief BitVector journal benchmarks: writes with and without journaling,
+ * against full snapshots
+ */
+
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "bitvectorjournal.h"
+
+using namespace ::hv::common;
+
+#define N_REGISTERS 32u
+#define N_WRITES_PER_CYCLE 4u
+
+/**
+ * One simulated cycle: a few register writes
+ */
+static void cycle(std::vector<BitVector> &regs, hvuint64_t &t) {
+	for (unsigned int i = 0u; i < N_WRITES_PER_CYCLE; i++) {
+		regs[(t * 7u + i) % N_REGISTERS] = t;
+	}
+	t++;
+}
+
+/**
+ * Register writes, journaling disabled (Arg(0)) or enabled (Arg(1)), one
+ * marker per cycle
+ */
+static void BM_JournaledWrites(benchmark::State &state) {
+	std::vector<BitVector> regs(N_REGISTERS, BitVector(64u, 0u));
+	for (BitVector &r : regs) {
+		r.setJournaled(state.range(0) != 0);
+	}
+	hvuint64_t t(0u);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(BitVectorJournal::mark());
+		cycle(regs, t);
+	}
+	state.SetItemsProcessed(
+			static_cast<int64_t>(state.iterations()) * N_WRITES_PER_CYCLE);
+}
+
+/**
+ * Register writes with a full snapshot of the register file per cycle
+ */
+static void BM_SnapshotWrites(benchmark::State &state) {
+	std::vector<BitVector> regs(N_REGISTERS, BitVector(64u, 0u));
+	std::vector<BitVector> snapshot(regs);
+	hvuint64_t t(0u);
+	for (auto _ : state) {
+		for (unsigned int i = 0u; i < N_REGISTERS; i++) {
+			snapshot[i] = regs[i];
+		}
+		cycle(regs, t);
+	}
+	state.SetItemsProcessed(
+			static_cast<int64_t>(state.iterations()) * N_WRITES_PER_CYCLE);
+}
+
+BENCHMARK(BM_JournaledWrites)->Arg(0)->Arg(1);
+BENCHMARK(BM_SnapshotWrites);
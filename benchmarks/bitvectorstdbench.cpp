@@ -0,0 +1,116 @@
+/**
+ * @file bitvectorstdbench.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief std::bitset/std::vector<bool> conversion benchmarks: word copies
+ * against to_string() and per-bit loops on 4096 bits
+ */
+
+#include <bitset>
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "bitvector_std.h"
+
+using namespace ::hv::common;
+
+#define N_BITS 4096u
+
+/**
+ * Random 4096-bit std::bitset
+ */
+static std::bitset<N_BITS> randomBitset() {
+	BitVector bv(N_BITS, 0u);
+	bv.rand();
+	return toBitset<N_BITS>(bv);
+}
+
+/**
+ * std::bitset import through word copies
+ */
+static void BM_StdBitsetWords(benchmark::State &state) {
+	const std::bitset<N_BITS> bs(randomBitset());
+	BitVector bv(N_BITS, 0u);
+	for (auto _ : state) {
+		fromStd(bs, bv);
+		benchmark::DoNotOptimize(bv);
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * N_BITS);
+}
+
+/**
+ * Same through to_string() and the BitVector string constructor
+ */
+static void BM_StdBitsetString(benchmark::State &state) {
+	const std::bitset<N_BITS> bs(randomBitset());
+	BitVector bv(N_BITS, 0u);
+	for (auto _ : state) {
+		bv = BitVector(bs.to_string());
+		benchmark::DoNotOptimize(bv);
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * N_BITS);
+}
+
+/**
+ * Same bit by bit
+ */
+static void BM_StdBitsetPerBit(benchmark::State &state) {
+	const std::bitset<N_BITS> bs(randomBitset());
+	BitVector bv(N_BITS, 0u);
+	for (auto _ : state) {
+		for (unsigned int i = 0u; i < N_BITS; i++) {
+			bv[i] = bs[i];
+		}
+		benchmark::DoNotOptimize(bv);
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * N_BITS);
+}
+
+/**
+ * std::bitset export through word copies
+ */
+static void BM_StdBitsetExport(benchmark::State &state) {
+	const BitVector bv(toBitVector(randomBitset()));
+	std::bitset<N_BITS> bs;
+	for (auto _ : state) {
+		toStd(bv, bs);
+		benchmark::DoNotOptimize(bs);
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * N_BITS);
+}
+
+/**
+ * std::vector<bool> import through word copies
+ */
+static void BM_StdBoolVectorWords(benchmark::State &state) {
+	const std::vector<bool> v(toBoolVector(toBitVector(randomBitset())));
+	BitVector bv(N_BITS, 0u);
+	for (auto _ : state) {
+		fromStd(v, bv);
+		benchmark::DoNotOptimize(bv);
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * N_BITS);
+}
+
+/**
+ * Same bit by bit
+ */
+static void BM_StdBoolVectorPerBit(benchmark::State &state) {
+	const std::vector<bool> v(toBoolVector(toBitVector(randomBitset())));
+	BitVector bv(N_BITS, 0u);
+	for (auto _ : state) {
+		for (unsigned int i = 0u; i < N_BITS; i++) {
+			bv[i] = static_cast<bool>(v[i]);
+		}
+		benchmark::DoNotOptimize(bv);
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * N_BITS);
+}
+
+BENCHMARK(BM_StdBitsetWords);
+BENCHMARK(BM_StdBitsetString);
+BENCHMARK(BM_StdBitsetPerBit);
+BENCHMARK(BM_StdBitsetExport);
+BENCHMARK(BM_StdBoolVectorWords);
+BENCHMARK(BM_StdBoolVectorPerBit);
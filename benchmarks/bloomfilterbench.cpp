@@ -0,0 +1,76 @@
+/**
+ * @file bloomfilterbench.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Bloom filter benchmarks: watchpoint checks with and without
+ * pre-filter
+ */
+
+#include <set>
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "bloomfilter.h"
+
+using namespace ::hv::common;
+
+#define N_WATCHPOINTS 64u
+#define N_ACCESSES 4096u
+
+/**
+ * Watchpoints on 8-byte granules and random 4-byte accesses
+ */
+static void setup(std::set<hvaddr_t> &watchpoints,
+		std::vector<hvaddr_t> &accesses) {
+	RandomEngine rng(1u);
+	for (unsigned int i = 0u; i < N_WATCHPOINTS; i++) {
+		watchpoints.insert(rng() & 0x3FFFFFF8u);
+	}
+	for (unsigned int i = 0u; i < N_ACCESSES; i++) {
+		accesses.push_back(rng() & 0x3FFFFFFCu);
+	}
+}
+
+/**
+ * Watchpoint set lookup on every access
+ */
+static void BM_WatchpointSet(benchmark::State &state) {
+	std::set<hvaddr_t> watchpoints;
+	std::vector<hvaddr_t> accesses;
+	setup(watchpoints, accesses);
+	for (auto _ : state) {
+		unsigned int hits(0u);
+		for (const hvaddr_t a : accesses) {
+			hits += watchpoints.count(a & ~static_cast<hvaddr_t>(7u));
+		}
+		benchmark::DoNotOptimize(hits);
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * N_ACCESSES);
+}
+
+/**
+ * Bloom filter in front of the watchpoint set
+ */
+static void BM_WatchpointBloomFilter(benchmark::State &state) {
+	std::set<hvaddr_t> watchpoints;
+	std::vector<hvaddr_t> accesses;
+	setup(watchpoints, accesses);
+	BloomFilter filter(4096u, 3u, 3u);
+	for (const hvaddr_t w : watchpoints) {
+		filter.insertRange(w, 8u);
+	}
+	for (auto _ : state) {
+		unsigned int hits(0u);
+		for (const hvaddr_t a : accesses) {
+			if (filter.mayContainRange(a, 4u)) {
+				hits += watchpoints.count(a & ~static_cast<hvaddr_t>(7u));
+			}
+		}
+		benchmark::DoNotOptimize(hits);
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * N_ACCESSES);
+}
+
+BENCHMARK(BM_WatchpointSet);
+BENCHMARK(BM_WatchpointBloomFilter);
@@ -0,0 +1,99 @@
+/**
+ * @file compactbitvectorbench.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief CompactBitVector benchmarks: 1M-element containers against
+ * BitVector
+ */
+
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "compactbitvector.h"
+
+using namespace ::hv::common;
+
+#define N_ELEMENTS (1u << 20)
+#define N_ACCESSES 4096u
+
+/**
+ * Random element indexes
+ */
+static std::vector<unsigned int> accessIndexes() {
+	RandomEngine rng(1u);
+	std::vector<unsigned int> ret(N_ACCESSES);
+	for (unsigned int &i : ret) {
+		i = rng() % N_ELEMENTS;
+	}
+	return ret;
+}
+
+/**
+ * Scoreboard update: random reads, compare and write back, on 1M 64-bit
+ * BitVectors
+ */
+static void BM_ContainerBitVector(benchmark::State &state) {
+	std::vector<BitVector> c(N_ELEMENTS, BitVector(64u, 0u));
+	const std::vector<unsigned int> idx(accessIndexes());
+	const BitVector one(64u, 1u);
+	for (auto _ : state) {
+		for (const unsigned int i : idx) {
+			if (c[i] != one) {
+				c[i] ^= one;
+			}
+		}
+	}
+	state.counters["bytes_per_element"] = sizeof(BitVector);
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * N_ACCESSES);
+}
+
+/**
+ * Same on 1M CompactBitVectors
+ */
+static void BM_ContainerCompactBitVector(benchmark::State &state) {
+	std::vector<CompactBitVector> c(N_ELEMENTS, CompactBitVector(64u, 0u));
+	const std::vector<unsigned int> idx(accessIndexes());
+	const CompactBitVector one(64u, 1u);
+	for (auto _ : state) {
+		for (const unsigned int i : idx) {
+			if (c[i] != one) {
+				c[i] ^= one;
+			}
+		}
+	}
+	state.counters["bytes_per_element"] = sizeof(CompactBitVector);
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * N_ACCESSES);
+}
+
+/**
+ * Sequential scan of the whole container (counting set bits)
+ */
+static void BM_ScanBitVector(benchmark::State &state) {
+	std::vector<BitVector> c(N_ELEMENTS, BitVector(64u, 0x5u));
+	for (auto _ : state) {
+		hvuint64_t n(0u);
+		for (const BitVector &x : c) {
+			n += popCount(static_cast<hvuint64_t>(x));
+		}
+		benchmark::DoNotOptimize(n);
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * N_ELEMENTS);
+}
+
+static void BM_ScanCompactBitVector(benchmark::State &state) {
+	std::vector<CompactBitVector> c(N_ELEMENTS, CompactBitVector(64u, 0x5u));
+	for (auto _ : state) {
+		hvuint64_t n(0u);
+		for (const CompactBitVector &x : c) {
+			n += x.count();
+		}
+		benchmark::DoNotOptimize(n);
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * N_ELEMENTS);
+}
+
+BENCHMARK(BM_ContainerBitVector);
+BENCHMARK(BM_ContainerCompactBitVector);
+BENCHMARK(BM_ScanBitVector);
+BENCHMARK(BM_ScanCompactBitVector);
@@ -0,0 +1,121 @@
+/**
+ * @file crcbench.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief CRC engine benchmarks (table-driven vs hardware-accelerated)
+ */
+
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "crc.h"
+#include "random.h"
+
+using namespace ::hv::common;
+
+/**
+ * Random byte buffer, identical for a given size
+ * @param len Buffer length
+ * @return Buffer
+ */
+static std::vector<hvuint8_t> randBuffer(const std::size_t &len) {
+	RandomEngine engine(len);
+	std::vector<hvuint8_t> ret(len);
+	for (auto &b : ret) {
+		b = static_cast<hvuint8_t>(engine());
+	}
+	return ret;
+}
+
+static void runCrc(benchmark::State &state, const CrcEngine &engine) {
+	const std::vector<hvuint8_t> buf(
+			randBuffer(static_cast<std::size_t>(state.range(0))));
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(engine.compute(buf.data(), buf.size()));
+	}
+	state.SetBytesProcessed(
+			static_cast<int64_t>(state.iterations()) * state.range(0));
+	state.SetLabel(engine.isAccelerated() ? "accelerated" : "table");
+}
+
+static void runCrcTable(benchmark::State &state, const CrcEngine &preset) {
+	CrcEngine engine(preset);
+	engine.setAccelerated(false);
+	runCrc(state, engine);
+}
+
+static void BM_Crc32Table(benchmark::State &state) {
+	runCrcTable(state, CrcEngine::getCrc32());
+}
+
+static void BM_Crc32Accel(benchmark::State &state) {
+	runCrc(state, CrcEngine::getCrc32());
+}
+
+static void BM_Crc32cTable(benchmark::State &state) {
+	runCrcTable(state, CrcEngine::getCrc32c());
+}
+
+static void BM_Crc32cAccel(benchmark::State &state) {
+	runCrc(state, CrcEngine::getCrc32c());
+}
+
+static void BM_Crc64XzTable(benchmark::State &state) {
+	runCrcTable(state, CrcEngine::getCrc64Xz());
+}
+
+static void BM_Crc64XzAccel(benchmark::State &state) {
+	runCrc(state, CrcEngine::getCrc64Xz());
+}
+
+static void BM_Crc64Ecma182Table(benchmark::State &state) {
+	runCrcTable(state, CrcEngine::getCrc64Ecma182());
+}
+
+/**
+ * CRC over a BitVector (word serialization overhead)
+ */
+static void BM_Crc32BitVector(benchmark::State &state) {
+	BitVector bv(static_cast<BitVector::bvsize_t>(state.range(0) * 8), 0u);
+	bv.rand();
+	const CrcEngine &engine(CrcEngine::getCrc32());
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(engine.compute(bv));
+	}
+	state.SetBytesProcessed(
+			static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+/**
+ * Bit-serial CRC-32 through BitVector::operator[], as typically written in
+ * models
+ */
+static void BM_Crc32BitSerial(benchmark::State &state) {
+	BitVector data(static_cast<BitVector::bvsize_t>(state.range(0) * 8), 0u);
+	data.rand();
+	const BitVector &bv(data);
+	for (auto _ : state) {
+		hvuint32_t reg(0xFFFFFFFFu);
+		for (BitVector::bvsize_t i = 0u; i < bv.getSize(); i++) {
+			reg ^= static_cast<bool>(bv[i]);
+			reg = (reg & 1u) ? (reg >> 1) ^ 0xEDB88320u : reg >> 1;
+		}
+		benchmark::DoNotOptimize(reg);
+	}
+	state.SetBytesProcessed(
+			static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// 64 B: small packet, 1.5 KiB: Ethernet MTU, 64 KiB: large DMA transfer
+#define HV_CRC_BENCH(name) BENCHMARK(name)->Arg(64)->Arg(1536)->Arg(65536)
+
+HV_CRC_BENCH(BM_Crc32Table);
+HV_CRC_BENCH(BM_Crc32Accel);
+HV_CRC_BENCH(BM_Crc32cTable);
+HV_CRC_BENCH(BM_Crc32cAccel);
+HV_CRC_BENCH(BM_Crc64XzTable);
+HV_CRC_BENCH(BM_Crc64XzAccel);
+HV_CRC_BENCH(BM_Crc64Ecma182Table);
+BENCHMARK(BM_Crc32BitVector)->Arg(64)->Arg(1536)->Arg(8191);
+BENCHMARK(BM_Crc32BitSerial)->Arg(64)->Arg(1536);
@@ -0,0 +1,88 @@
+/**
+ * @file eccbench.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief SECDED benchmarks against a per-bit parity tree over BitVector
+ */
+
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "ecc.h"
+#include "random.h"
+
+using namespace ::hv::common;
+
+template<int W> static void BM_SecdedEncode(benchmark::State &state) {
+	const Secded ecc(W);
+	BitVector data(W, 0u);
+	data.rand();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(ecc.encode(data));
+	}
+}
+
+template<int W> static void BM_SecdedDecode(benchmark::State &state) {
+	const Secded ecc(W);
+	BitVector data(W, 0u);
+	data.rand();
+	BitVector check(ecc.encode(data));
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(ecc.decode(data, check));
+	}
+}
+
+/**
+ * Check bits computed bit by bit, as written by hand in memory models
+ */
+template<int W> static void BM_ParityTreeEncode(benchmark::State &state) {
+	const Secded ecc(W);
+	BitVector tmp(W, 0u);
+	tmp.rand();
+	const BitVector &data(tmp);
+	const unsigned int nHamming(ecc.getCheckWidth() - 1u);
+	for (auto _ : state) {
+		hvuint32_t check(0u);
+		bool p(false);
+		for (unsigned int pos = 1u; pos <= W + nHamming; pos++) {
+			const int ind(ecc.getDataIndex(pos));
+			if ((ind >= 0) && static_cast<bool>(data[ind])) {
+				for (unsigned int j = 0u; j < nHamming; j++) {
+					check ^= pos & (1u << j);
+				}
+				p = !p;
+			}
+		}
+		for (unsigned int j = 0u; j < nHamming; j++) {
+			p ^= (check >> j) & 1u;
+		}
+		benchmark::DoNotOptimize(check | (static_cast<hvuint32_t>(p) << nHamming));
+	}
+}
+
+template<int W> static void BM_SecdedBatchDecode(benchmark::State &state) {
+	const Secded ecc(W);
+	const std::size_t nWords(static_cast<std::size_t>(state.range(0)) * 8u / W);
+	std::vector<hvuint8_t> buf(static_cast<std::size_t>(state.range(0)));
+	RandomEngine engine(W);
+	for (auto &b : buf) {
+		b = static_cast<hvuint8_t>(engine());
+	}
+	std::vector<hvuint32_t> checks(nWords);
+	ecc.encode(buf.data(), nWords, checks.data());
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(ecc.decode(buf.data(), nWords, checks.data()));
+	}
+	state.SetBytesProcessed(
+			static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+#define HV_ECC_BENCH(W) \
+	BENCHMARK_TEMPLATE(BM_SecdedEncode, W); \
+	BENCHMARK_TEMPLATE(BM_SecdedDecode, W); \
+	BENCHMARK_TEMPLATE(BM_ParityTreeEncode, W); \
+	BENCHMARK_TEMPLATE(BM_SecdedBatchDecode, W)->Arg(4096)
+
+HV_ECC_BENCH(64);
+HV_ECC_BENCH(128);
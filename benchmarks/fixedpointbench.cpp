@@ -0,0 +1,77 @@
+/**
+ * @file fixedpointbench.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Fixed-point benchmarks against hand-written integer scaling
+ */
+
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "fixedpoint.h"
+#include "random.h"
+
+using namespace ::hv::common;
+
+#ifdef HV_HAS_INT128
+
+#define N_TAPS 64u
+
+/**
+ * 64-tap FIR: Q1.15 samples and coefficients, 40-bit accumulator, output
+ * rounded and saturated to Q1.15
+ */
+static void BM_FixedPointFir(benchmark::State &state) {
+	const FixedPointFormat q15(16u, 1, true, FX_RND, FX_SAT);
+	const FixedPointFormat accFmt(40u, 9);
+	RandomEngine rng(1u);
+	std::vector<FixedPoint> x, h;
+	for (unsigned int i = 0u; i < N_TAPS; i++) {
+		x.push_back(FixedPoint(q15));
+		x.back().setRaw(static_cast<hvint64_t>(rng()));
+		h.push_back(FixedPoint(q15));
+		h.back().setRaw(static_cast<hvint64_t>(rng()));
+	}
+	FixedPoint acc(accFmt), prod(accFmt), y(q15);
+	for (auto _ : state) {
+		acc = 0.0;
+		for (unsigned int i = 0u; i < N_TAPS; i++) {
+			prod.mul(x[i], h[i]);
+			acc += prod;
+		}
+		y = acc;
+		benchmark::DoNotOptimize(y.getRaw());
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * N_TAPS);
+}
+
+/**
+ * Same FIR with native integers and explicit scaling, rounding and
+ * saturation
+ */
+static void BM_IntegerFir(benchmark::State &state) {
+	RandomEngine rng(1u);
+	std::vector<hvint16_t> x, h;
+	for (unsigned int i = 0u; i < N_TAPS; i++) {
+		x.push_back(static_cast<hvint16_t>(rng()));
+		h.push_back(static_cast<hvint16_t>(rng()));
+	}
+	for (auto _ : state) {
+		hvint64_t acc(0);
+		for (unsigned int i = 0u; i < N_TAPS; i++) {
+			acc += static_cast<hvint32_t>(x[i]) * h[i];
+			// 40-bit wrap-around accumulator
+			acc = static_cast<hvint64_t>(static_cast<hvuint64_t>(acc) << 24) >> 24;
+		}
+		hvint64_t y((acc + (1 << 14)) >> 15);
+		y = y > 32767 ? 32767 : (y < -32768 ? -32768 : y);
+		benchmark::DoNotOptimize(y);
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * N_TAPS);
+}
+
+BENCHMARK(BM_FixedPointFir);
+BENCHMARK(BM_IntegerFir);
+
+#endif // HV_HAS_INT128
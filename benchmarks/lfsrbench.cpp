@@ -0,0 +1,71 @@
+/**
+ * @file lfsrbench.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief LFSR/PRBS benchmarks against a BitVector shift-and-XOR register
+ */
+
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "lfsr.h"
+
+using namespace ::hv::common;
+
+/**
+ * Word-parallel generation into a 64 KiB buffer
+ */
+static void BM_PrbsGenerate(benchmark::State &state) {
+	Lfsr lfsr(Lfsr::prbs(static_cast<unsigned int>(state.range(0))));
+	const std::size_t N_BITS(64u * 1024u * 8u);
+	std::vector<hvuint64_t> buf(N_BITS / 64u);
+	for (auto _ : state) {
+		lfsr.generate(buf.data(), N_BITS);
+		benchmark::ClobberMemory();
+	}
+	state.SetBytesProcessed(
+			static_cast<int64_t>(state.iterations()) * N_BITS / 8);
+}
+
+/**
+ * One step per simulated UI
+ */
+static void BM_PrbsStep(benchmark::State &state) {
+	Lfsr lfsr(Lfsr::prbs(static_cast<unsigned int>(state.range(0))));
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(lfsr.step());
+	}
+}
+
+/**
+ * Shift plus XOR of operator[] taps, as written by hand in models
+ */
+static void BM_PrbsBitVectorShift(benchmark::State &state) {
+	const unsigned int order(static_cast<unsigned int>(state.range(0)));
+	const unsigned int tap(static_cast<unsigned int>(state.range(1)));
+	BitVector reg(~BitVector(static_cast<BitVector::bvsize_t>(order), false));
+	const BitVector &creg(reg);
+	for (auto _ : state) {
+		const bool bit(
+				static_cast<bool>(creg[order - 1u])
+						!= static_cast<bool>(creg[tap - 1u]));
+		reg <<= 1u;
+		reg[0] = bit;
+		benchmark::DoNotOptimize(bit);
+	}
+}
+
+static void BM_PrbsAdvance(benchmark::State &state) {
+	Lfsr lfsr(Lfsr::prbs(31u));
+	lfsr.advance(static_cast<hvuint64_t>(state.range(0)));
+	for (auto _ : state) {
+		lfsr.advance(static_cast<hvuint64_t>(state.range(0)));
+		benchmark::ClobberMemory();
+	}
+}
+
+BENCHMARK(BM_PrbsGenerate)->Arg(7)->Arg(15)->Arg(23)->Arg(31);
+BENCHMARK(BM_PrbsStep)->Arg(7)->Arg(31);
+BENCHMARK(BM_PrbsBitVectorShift)->Args( { 7, 6 })->Args( { 31, 28 });
+BENCHMARK(BM_PrbsAdvance)->Arg(1000)->Arg(1000000000);
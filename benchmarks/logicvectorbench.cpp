@@ -0,0 +1,134 @@
+/**
+ * @file logicvectorbench.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief LogicVector benchmarks against sc_dt::sc_lv
+ */
+
+#include <string>
+#include <systemc>
+#include "benchmark/benchmark.h"
+#include "logicvector.h"
+#include "random.h"
+
+using namespace ::hv::common;
+
+/**
+ * Random four-state string, identical for a given seed
+ * @param size String length
+ * @param seed Random seed
+ * @return String of 0s, 1s, Xs and Zs
+ */
+static std::string randLogicStr(const std::size_t &size,
+		const hvuint64_t &seed) {
+	static const char LOGIC_CHARS[] = { '0', '1', 'Z', 'X' };
+	RandomEngine engine(seed);
+	std::string ret(size, '0');
+	for (std::size_t i = 0u; i < size; i++) {
+		// Mostly known values, as in a typical simulation
+		const hvuint64_t r(engine() % 16u);
+		ret[i] = LOGIC_CHARS[r < 14u ? r & 1u : r - 12u];
+	}
+	return ret;
+}
+
+template<int W> static void BM_LogicVectorAnd(benchmark::State &state) {
+	LogicVector a(randLogicStr(W, 1u)), b(randLogicStr(W, 2u));
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(a &= b);
+		benchmark::ClobberMemory();
+	}
+}
+
+template<int W> static void BM_ScLvAnd(benchmark::State &state) {
+	sc_dt::sc_lv<W> a(randLogicStr(W, 1u).c_str()), b(
+			randLogicStr(W, 2u).c_str());
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(a &= b);
+		benchmark::ClobberMemory();
+	}
+}
+
+template<int W> static void BM_LogicVectorOr(benchmark::State &state) {
+	LogicVector a(randLogicStr(W, 1u)), b(randLogicStr(W, 2u));
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(a |= b);
+		benchmark::ClobberMemory();
+	}
+}
+
+template<int W> static void BM_ScLvOr(benchmark::State &state) {
+	sc_dt::sc_lv<W> a(randLogicStr(W, 1u).c_str()), b(
+			randLogicStr(W, 2u).c_str());
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(a |= b);
+		benchmark::ClobberMemory();
+	}
+}
+
+template<int W> static void BM_LogicVectorXor(benchmark::State &state) {
+	LogicVector a(randLogicStr(W, 1u)), b(randLogicStr(W, 2u));
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(a ^= b);
+		benchmark::ClobberMemory();
+	}
+}
+
+template<int W> static void BM_ScLvXor(benchmark::State &state) {
+	sc_dt::sc_lv<W> a(randLogicStr(W, 1u).c_str()), b(
+			randLogicStr(W, 2u).c_str());
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(a ^= b);
+		benchmark::ClobberMemory();
+	}
+}
+
+template<int W> static void BM_LogicVectorNot(benchmark::State &state) {
+	LogicVector a(randLogicStr(W, 1u));
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(a = ~a);
+		benchmark::ClobberMemory();
+	}
+}
+
+template<int W> static void BM_ScLvNot(benchmark::State &state) {
+	sc_dt::sc_lv<W> a(randLogicStr(W, 1u).c_str());
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(a = ~a);
+		benchmark::ClobberMemory();
+	}
+}
+
+template<int W> static void BM_LogicVectorIsFullyKnown(
+		benchmark::State &state) {
+	const LogicVector a(W, LOGIC_1);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(a.isFullyKnown());
+	}
+}
+
+template<int W> static void BM_ScLvIs01(benchmark::State &state) {
+	const sc_dt::sc_lv<W> a(std::string(W, '1').c_str());
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(a.is_01());
+	}
+}
+
+#define HV_BENCH_LOGIC(W) \
+	BENCHMARK_TEMPLATE(BM_LogicVectorAnd, W); \
+	BENCHMARK_TEMPLATE(BM_ScLvAnd, W); \
+	BENCHMARK_TEMPLATE(BM_LogicVectorOr, W); \
+	BENCHMARK_TEMPLATE(BM_ScLvOr, W); \
+	BENCHMARK_TEMPLATE(BM_LogicVectorXor, W); \
+	BENCHMARK_TEMPLATE(BM_ScLvXor, W); \
+	BENCHMARK_TEMPLATE(BM_LogicVectorNot, W); \
+	BENCHMARK_TEMPLATE(BM_ScLvNot, W); \
+	BENCHMARK_TEMPLATE(BM_LogicVectorIsFullyKnown, W); \
+	BENCHMARK_TEMPLATE(BM_ScLvIs01, W)
+
+HV_BENCH_LOGIC(8);
+HV_BENCH_LOGIC(64);
+HV_BENCH_LOGIC(512);
+HV_BENCH_LOGIC(4096);
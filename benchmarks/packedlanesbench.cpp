@@ -0,0 +1,81 @@
+/**
+ * @file packedlanesbench.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Packed-lane benchmarks against lane slicing through operator()
+ */
+
+#include "benchmark/benchmark.h"
+#include "packedlanes.h"
+
+using namespace ::hv::common;
+
+/**
+ * Lane-wise addition of two registers
+ */
+template<typename T> static void BM_PackedLanesAdd(benchmark::State &state) {
+	const BitVector::bvsize_t size(
+			static_cast<BitVector::bvsize_t>(state.range(0)));
+	BitVector a(size, false), b(size, false), r(size, false);
+	a.rand();
+	b.rand();
+	PackedLanes<T> lanes(r);
+	for (auto _ : state) {
+		lanes.add(a, b);
+		benchmark::ClobberMemory();
+	}
+	state.SetBytesProcessed(
+			static_cast<int64_t>(state.iterations()) * (size / 8));
+}
+
+/**
+ * Masked lane-wise signed maximum
+ */
+template<typename T> static void BM_PackedLanesMaskedMax(
+		benchmark::State &state) {
+	const BitVector::bvsize_t size(
+			static_cast<BitVector::bvsize_t>(state.range(0)));
+	BitVector a(size, false), b(size, false), r(size, false), mask(
+			static_cast<BitVector::bvsize_t>(size / BITWIDTH_OF(T)), false);
+	a.rand();
+	b.rand();
+	mask.rand();
+	PackedLanes<T> lanes(r);
+	for (auto _ : state) {
+		lanes.maxSigned(a, b, mask);
+		benchmark::ClobberMemory();
+	}
+	state.SetBytesProcessed(
+			static_cast<int64_t>(state.iterations()) * (size / 8));
+}
+
+/**
+ * Lane-wise addition through BitVector slices, as written by hand in models
+ */
+template<typename T> static void BM_SlicedLanesAdd(benchmark::State &state) {
+	const BitVector::bvsize_t size(
+			static_cast<BitVector::bvsize_t>(state.range(0)));
+	const unsigned int W(BITWIDTH_OF(T));
+	BitVector a(size, false), b(size, false), r(size, false);
+	a.rand();
+	b.rand();
+	const BitVector &ca(a), &cb(b);
+	for (auto _ : state) {
+		for (unsigned int i = 0u; i < size / W; i++) {
+			const T x(static_cast<T>(static_cast<hvuint64_t>(ca((i + 1u) * W - 1u, i * W))));
+			const T y(static_cast<T>(static_cast<hvuint64_t>(cb((i + 1u) * W - 1u, i * W))));
+			r((i + 1u) * W - 1u, i * W) = static_cast<hvuint64_t>(static_cast<T>(x + y));
+		}
+		benchmark::ClobberMemory();
+	}
+	state.SetBytesProcessed(
+			static_cast<int64_t>(state.iterations()) * (size / 8));
+}
+
+BENCHMARK_TEMPLATE(BM_PackedLanesAdd, hvuint8_t)->Arg(128)->Arg(512)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_PackedLanesAdd, hvuint32_t)->Arg(128)->Arg(512)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_PackedLanesMaskedMax, hvuint16_t)->Arg(512);
+BENCHMARK_TEMPLATE(BM_SlicedLanesAdd, hvuint8_t)->Arg(128)->Arg(512);
+BENCHMARK_TEMPLATE(BM_SlicedLanesAdd, hvuint32_t)->Arg(128)->Arg(512);
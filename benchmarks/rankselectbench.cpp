@@ -0,0 +1,118 @@
+/**
+ * @file rankselectbench.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Rank/select index benchmarks against cell scanning
+ */
+
+#include <limits>
+#include "benchmark/benchmark.h"
+#include "rankselect.h"
+
+using namespace ::hv::common;
+
+typedef BitVector::bvsize_t bvsize_t;
+
+/**
+ * Bitmap size: 4M bits with 32-bit BitVector sizes (HV_BV_WIDE_SIZE), else
+ * the largest BitVector
+ */
+#define BITMAP_SIZE (std::numeric_limits<bvsize_t>::max() > (1u << 22) ? \
+		(1u << 22) : static_cast<hvuint32_t>(std::numeric_limits<bvsize_t>::max()))
+
+/**
+ * Rank queries at pseudo-random positions
+ */
+static void BM_RankSelectIndexRank(benchmark::State &state) {
+	BitVector bv(BITMAP_SIZE, false);
+	bv.rand();
+	const RankSelectIndex index(bv);
+	index.count();
+	RandomEngine rng(1u);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(
+				index.rank1(static_cast<bvsize_t>(rng() % BITMAP_SIZE)));
+	}
+}
+
+/**
+ * Select queries at pseudo-random ranks
+ */
+static void BM_RankSelectIndexSelect(benchmark::State &state) {
+	BitVector bv(BITMAP_SIZE, false);
+	bv.rand();
+	const RankSelectIndex index(bv);
+	const bvsize_t ones(index.count());
+	RandomEngine rng(1u);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(
+				index.select1(static_cast<bvsize_t>(rng() % ones)));
+	}
+}
+
+/**
+ * Alternating bit writes and select queries, as in a page allocator
+ */
+static void BM_RankSelectIndexSetSelect(benchmark::State &state) {
+	BitVector bv(BITMAP_SIZE, false);
+	bv.rand();
+	RankSelectIndex index(bv);
+	RandomEngine rng(1u);
+	for (auto _ : state) {
+		const hvuint64_t r(rng());
+		index.set(static_cast<bvsize_t>(r % BITMAP_SIZE), (r >> 32) & 1u);
+		benchmark::DoNotOptimize(
+				index.select1(static_cast<bvsize_t>((r >> 33) % (BITMAP_SIZE / 4u))));
+	}
+}
+
+/**
+ * Rank queries scanning cells with popcount
+ */
+static void BM_ScanRank(benchmark::State &state) {
+	BitVector bv(BITMAP_SIZE, false);
+	bv.rand();
+	const BitVector::bvdata_t *d(bv.getDataAddress());
+	RandomEngine rng(1u);
+	for (auto _ : state) {
+		const unsigned int pos(static_cast<unsigned int>(rng() % BITMAP_SIZE));
+		unsigned int r(0u);
+		for (unsigned int i = 0u; i < pos / 32u; i++) {
+			r += popCount(d[i]);
+		}
+		r += popCount(d[pos / 32u] & ((1u << (pos % 32u)) - 1u));
+		benchmark::DoNotOptimize(r);
+	}
+}
+
+/**
+ * Select queries scanning cells with popcount
+ */
+static void BM_ScanSelect(benchmark::State &state) {
+	BitVector bv(BITMAP_SIZE, false);
+	bv.rand();
+	const RankSelectIndex index(bv);
+	const bvsize_t ones(index.count());
+	const BitVector::bvdata_t *d(bv.getDataAddress());
+	RandomEngine rng(1u);
+	for (auto _ : state) {
+		unsigned int k(static_cast<unsigned int>(rng() % ones));
+		unsigned int i(0u);
+		while (k >= popCount(d[i])) {
+			k -= popCount(d[i++]);
+		}
+		BitVector::bvdata_t x(d[i]);
+		for (; k; k--) {
+			x &= x - 1u;
+		}
+		benchmark::DoNotOptimize(i * 32u + countTrailingZeros(x));
+	}
+}
+
+BENCHMARK(BM_RankSelectIndexRank);
+BENCHMARK(BM_RankSelectIndexSelect);
+BENCHMARK(BM_RankSelectIndexSetSelect);
+BENCHMARK(BM_ScanRank);
+BENCHMARK(BM_ScanSelect);
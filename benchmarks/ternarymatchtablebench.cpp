@@ -0,0 +1,110 @@
+/**
+ * @file ternarymatchtablebench.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Ternary match table benchmarks against a loop over BitVector pairs
+ */
+
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "ternarymatchtable.h"
+
+using namespace ::hv::common;
+
+namespace {
+
+/**
+ * Routing-table-like entries: random prefixes of 8 to width bits, MSB cleared
+ */
+void buildEntries(const BitVector::bvsize_t &width, const std::size_t &n,
+		std::vector<BitVector> &values, std::vector<BitVector> &masks) {
+	for (std::size_t i = 0u; i < n; i++) {
+		BitVector v(width, false);
+		v.rand();
+		v[width - 1u] = false;
+		const BitVector::bvsize_t prefix(
+				static_cast<BitVector::bvsize_t>(8u + (i * 7919u) % (width - 7u)));
+		const BitVector m(
+				(~BitVector(width, false)) << static_cast<unsigned int>(width - prefix));
+		values.push_back(v & m);
+		masks.push_back(m);
+	}
+}
+
+} // namespace
+
+/**
+ * Lookups missing every entry: full table scan
+ */
+static void BM_TernaryMatchTableLookup(benchmark::State &state) {
+	const BitVector::bvsize_t width(
+			static_cast<BitVector::bvsize_t>(state.range(0)));
+	const std::size_t n(static_cast<std::size_t>(state.range(1)));
+	std::vector<BitVector> values, masks;
+	buildEntries(width, n, values, masks);
+	TernaryMatchTable table(width);
+	for (std::size_t i = 0u; i < n; i++) {
+		table.insert(values[i], masks[i]);
+	}
+	BitVector key(width, false);
+	key.rand();
+	key[width - 1u] = true;
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(table.lookup(key));
+	}
+	state.SetItemsProcessed(
+			static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(n));
+}
+
+/**
+ * Value/mask pairs compared one by one, as written by hand in models
+ */
+static void BM_TernaryMatchBitVectorLoop(benchmark::State &state) {
+	const BitVector::bvsize_t width(
+			static_cast<BitVector::bvsize_t>(state.range(0)));
+	const std::size_t n(static_cast<std::size_t>(state.range(1)));
+	std::vector<BitVector> values, masks;
+	buildEntries(width, n, values, masks);
+	BitVector key(width, false);
+	key.rand();
+	key[width - 1u] = true;
+	for (auto _ : state) {
+		std::size_t hit(n);
+		for (std::size_t i = 0u; i < n; i++) {
+			if (!((key ^ values[i]) & masks[i])) {
+				hit = i;
+				break;
+			}
+		}
+		benchmark::DoNotOptimize(hit);
+	}
+	state.SetItemsProcessed(
+			static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(n));
+}
+
+/**
+ * Insertion and removal of one entry in the middle of a full table
+ */
+static void BM_TernaryMatchTableUpdate(benchmark::State &state) {
+	const BitVector::bvsize_t width(
+			static_cast<BitVector::bvsize_t>(state.range(0)));
+	const std::size_t n(static_cast<std::size_t>(state.range(1)));
+	std::vector<BitVector> values, masks;
+	buildEntries(width, n, values, masks);
+	TernaryMatchTable table(width);
+	for (std::size_t i = 0u; i < n; i++) {
+		table.insert(values[i], masks[i], static_cast<hvint32_t>(i % 2u));
+	}
+	for (auto _ : state) {
+		table.erase(table.insert(values[0], masks[0], 1));
+	}
+}
+
+BENCHMARK(BM_TernaryMatchTableLookup)->Args( { 32, 10000 })->Args(
+		{ 128, 10000 });
+BENCHMARK(BM_TernaryMatchBitVectorLoop)->Args( { 32, 10000 })->Args(
+		{ 128, 10000 });
+BENCHMARK(BM_TernaryMatchTableUpdate)->Args( { 32, 10000 })->Args(
+		{ 128, 10000 });
@@ -0,0 +1,85 @@
+/**
+ * @file vcdwriterbench.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief VCD writer benchmarks against toString() and iostreams
+ */
+
+#include <fstream>
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "vcdwriter.h"
+
+using namespace ::hv::common;
+
+#define N_SIGNALS 64u
+
+/**
+ * Signals of 1 to 128 bits
+ */
+static std::vector<BitVector> makeSignals() {
+	std::vector<BitVector> ret;
+	for (unsigned int i = 0u; i < N_SIGNALS; i++) {
+		ret.push_back(
+				BitVector(static_cast<BitVector::bvsize_t>(1u + (i * 37u) % 128u),
+						false));
+	}
+	return ret;
+}
+
+/**
+ * Changes one signal out of 8 per sample
+ */
+static void change(std::vector<BitVector> &sigs, const hvuint64_t &t) {
+	for (unsigned int i = static_cast<unsigned int>(t % 8u); i < N_SIGNALS; i +=
+			8u) {
+		sigs[i].getDataAddress()[0] ^= static_cast<BitVector::bvdata_t>(t | 1u);
+	}
+}
+
+/**
+ * VcdWriter sampling all signals
+ */
+static void BM_VcdWriter(benchmark::State &state) {
+	std::vector<BitVector> sigs(makeSignals());
+	VcdWriter vcd(std::string("/dev/null"), "1 ps", state.range(0) != 0);
+	for (unsigned int i = 0u; i < N_SIGNALS; i++) {
+		vcd.addSignal("top", "s" + std::to_string(i), sigs[i]);
+	}
+	hvuint64_t t(0u);
+	for (auto _ : state) {
+		change(sigs, t);
+		vcd.sample(t++);
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * N_SIGNALS);
+}
+
+/**
+ * Comparison with copies and toString() written through iostreams
+ */
+static void BM_VcdToString(benchmark::State &state) {
+	std::vector<BitVector> sigs(makeSignals()), prev(sigs);
+	std::ofstream os("/dev/null");
+	hvuint64_t t(0u);
+	for (auto _ : state) {
+		change(sigs, t);
+		bool timeWritten(false);
+		for (unsigned int i = 0u; i < N_SIGNALS; i++) {
+			if (sigs[i] != prev[i]) {
+				if (!timeWritten) {
+					os << '#' << t << '\n';
+					timeWritten = true;
+				}
+				os << 'b' << sigs[i].toString() << ' ' << i << '\n';
+				prev[i] = sigs[i];
+			}
+		}
+		t++;
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * N_SIGNALS);
+}
+
+BENCHMARK(BM_VcdWriter)->Arg(0)->Arg(1);
+BENCHMARK(BM_VcdToString);
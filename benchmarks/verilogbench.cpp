@@ -0,0 +1,104 @@
+/**
+ * @file verilogbench.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Verilog literal benchmarks: register reset values loaded through
+ * fromVerilog() against binary string construction
+ */
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "benchmark/benchmark.h"
+#include "verilog.h"
+
+using namespace ::hv::common;
+
+#define N_LITERALS 100000u
+
+/**
+ * Random 32'hXXXX_XXXX reset values
+ */
+static std::vector<std::string> resetLiterals() {
+	RandomEngine rng(1u);
+	std::vector<std::string> ret(N_LITERALS);
+	char buf[16];
+	for (std::string &s : ret) {
+		const unsigned int v = static_cast<unsigned int>(rng());
+		std::snprintf(buf, sizeof(buf), "32'h%04X_%04X", v >> 16u, v & 0xFFFFu);
+		s = buf;
+	}
+	return ret;
+}
+
+/**
+ * Hexadecimal digits of a 32'h literal expanded to a binary string, as
+ * register description scripts do before building a BitVector
+ */
+static std::string hexLiteralToBinary(const std::string &src) {
+	static const char *const nibbles[16] = { "0000", "0001", "0010", "0011",
+			"0100", "0101", "0110", "0111", "1000", "1001", "1010", "1011",
+			"1100", "1101", "1110", "1111" };
+	std::string ret;
+	for (std::size_t i = src.find('h') + 1u; i < src.size(); ++i) {
+		const char c = src[i];
+		if (c == '_') {
+			continue;
+		}
+		ret += nibbles[c <= '9' ? c - '0' : (c | 0x20) - 'a' + 10];
+	}
+	return ret;
+}
+
+/**
+ * 100k reset values parsed with fromVerilog()
+ */
+static void BM_VerilogParse(benchmark::State &state) {
+	const std::vector<std::string> literals(resetLiterals());
+	BitVector bv(32u);
+	for (auto _ : state) {
+		for (const std::string &s : literals) {
+			fromVerilog(s, bv);
+			benchmark::DoNotOptimize(bv);
+		}
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * N_LITERALS);
+}
+
+/**
+ * Same through a binary string and the BitVector string constructor
+ */
+static void BM_VerilogBinaryString(benchmark::State &state) {
+	const std::vector<std::string> literals(resetLiterals());
+	BitVector bv(32u);
+	for (auto _ : state) {
+		for (const std::string &s : literals) {
+			bv = BitVector(hexLiteralToBinary(s));
+			benchmark::DoNotOptimize(bv);
+		}
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * N_LITERALS);
+}
+
+/**
+ * 100k reset values printed with toVerilog()
+ */
+static void BM_VerilogPrint(benchmark::State &state) {
+	const std::vector<std::string> literals(resetLiterals());
+	std::vector<BitVector> values(N_LITERALS);
+	for (unsigned int i = 0u; i < N_LITERALS; ++i) {
+		fromVerilog(literals[i], values[i]);
+	}
+	for (auto _ : state) {
+		for (const BitVector &bv : values) {
+			benchmark::DoNotOptimize(toVerilog(bv, 'h', true));
+		}
+	}
+	state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * N_LITERALS);
+}
+
+BENCHMARK(BM_VerilogParse);
+BENCHMARK(BM_VerilogBinaryString);
+BENCHMARK(BM_VerilogPrint);
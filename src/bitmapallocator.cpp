@@ -0,0 +1,385 @@
+/**
+ * @file bitmapallocator.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Contiguous run allocator over a BitVector bitmap
+ */
+
+#include "hvutils.h"
+#include "bitmapallocator.h"
+
+namespace hv {
+namespace common {
+
+typedef BitVector::bvdata_t bvdata_t;
+
+const BitmapAllocator::bvsize_t BitmapAllocator::npos;
+
+#define HV_BA_CELL_BITS (BITWIDTH_OF(bvdata_t))
+
+/**
+ * Number of bits covered by a word of the empty cell summary
+ */
+#define HV_BA_EMPTY_SPAN (64u * HV_BA_CELL_BITS)
+
+/**
+ * Round a position up to a multiple of an alignment
+ */
+static inline hvuint64_t alignUp(const hvuint32_t &pos,
+		const hvuint32_t &alignment) {
+	return (static_cast<hvuint64_t>(pos) + alignment - 1u) / alignment
+			* alignment;
+}
+
+BitmapAllocator::BitmapAllocator(const bvsize_t &size,
+		const hvallocpolicy_t &policy) :
+		bitmap(size, false), policy(policy), freeCount(size) {
+	HV_ASSERT(size > 0u, "Bitmap allocator size must be non-zero");
+	const hvuint32_t nCells(bitmap.getArraySize());
+	hvuint32_t nBits(nCells);
+	do {
+		nonFull.push_back(std::vector<hvuint64_t>((nBits + 63u) / 64u, 0u));
+		nBits = (nBits + 63u) / 64u;
+	} while (nBits > 1u);
+	empty.assign((nCells + 63u) / 64u, 0u);
+	for (hvuint32_t c = 0u; c < nCells; c++) {
+		this->updateCell(c);
+	}
+}
+
+BitmapAllocator::~BitmapAllocator() {
+}
+
+BitmapAllocator::bvsize_t BitmapAllocator::getSize() const {
+	return bitmap.getSize();
+}
+
+hvallocpolicy_t BitmapAllocator::getPolicy() const {
+	return policy;
+}
+
+void BitmapAllocator::setPolicy(const hvallocpolicy_t &policy) {
+	this->policy = policy;
+}
+
+BitmapAllocator::bvsize_t BitmapAllocator::getFreeCount() const {
+	return static_cast<bvsize_t>(freeCount);
+}
+
+const BitVector& BitmapAllocator::getBitmap() const {
+	return bitmap;
+}
+
+BitmapAllocator::bvsize_t BitmapAllocator::allocateRun(const bvsize_t &n,
+		const bvsize_t &alignment) {
+	HV_ASSERT(n > 0u && alignment > 0u,
+			"Run length ({}) and alignment ({}) must be non-zero", n, alignment);
+	if (n > freeCount) {
+		return npos;
+	}
+	const hvuint32_t size(bitmap.getSize());
+
+	if (policy == ALLOC_FIRST_FIT) {
+		const hvuint32_t start(this->findRun(0u, n, alignment));
+		if (start >= size) {
+			return npos;
+		}
+		this->fill(start, n, true);
+		return static_cast<bvsize_t>(start);
+	}
+
+	// Best fit: visiting every free run the request fits in
+	bool found(false);
+	hvuint32_t best(0u), bestLength(0u);
+	hvuint32_t pos(0u);
+	for (;;) {
+		const hvuint32_t start(this->findRun(pos, n, alignment));
+		if (start >= size) {
+			break;
+		}
+		const hvuint32_t runStart(this->findRunStart(start, pos));
+		const hvuint32_t end(this->findAllocated(start + n, size));
+		if (!found || (end - runStart < bestLength)) {
+			found = true;
+			best = start;
+			bestLength = end - runStart;
+			if (bestLength == n) {
+				break;
+			}
+		}
+		pos = end + 1u;
+	}
+	if (!found) {
+		return npos;
+	}
+	this->fill(best, n, true);
+	return static_cast<bvsize_t>(best);
+}
+
+bool BitmapAllocator::allocateAt(const bvsize_t &start, const bvsize_t &n) {
+	if (!this->isFree(start, n)) {
+		return false;
+	}
+	this->fill(start, n, true);
+	return true;
+}
+
+void BitmapAllocator::free(const bvsize_t &start, const bvsize_t &n) {
+	HV_ASSERT(
+			static_cast<hvuint32_t>(start) + n <= bitmap.getSize()
+					&& this->findFree(start) >= static_cast<hvuint32_t>(start) + n,
+			"Run [{}, {}) is not allocated", start,
+			static_cast<hvuint32_t>(start) + n);
+	this->fill(start, n, false);
+}
+
+bool BitmapAllocator::isFree(const bvsize_t &start, const bvsize_t &n) const {
+	const hvuint32_t end(static_cast<hvuint32_t>(start) + n);
+	return (end <= bitmap.getSize())
+			&& (this->findAllocated(start, end) == end);
+}
+
+hvuint32_t BitmapAllocator::findNonFullCell(const hvuint32_t &cell) const {
+	hvuint32_t i(cell);
+	unsigned int l(0u);
+	for (;;) {
+		const hvuint32_t w(i / 64u);
+		if (w >= nonFull[l].size()) {
+			return ~0u;
+		}
+		const hvuint64_t x(nonFull[l][w] & (~0ULL << (i % 64u)));
+		if (x) {
+			// Going down to the first cell
+			hvuint32_t ret(w * 64u + countTrailingZeros(x));
+			while (l > 0u) {
+				l--;
+				ret = ret * 64u + countTrailingZeros(nonFull[l][ret]);
+			}
+			return ret;
+		}
+		if (l + 1u == nonFull.size()) {
+			return ~0u;
+		}
+		// Next word of the current level
+		i = w + 1u;
+		l++;
+	}
+}
+
+hvuint32_t BitmapAllocator::findRun(const hvuint32_t &pos,
+		const hvuint32_t &n, const hvuint32_t &alignment) const {
+	const hvuint32_t size(bitmap.getSize());
+	const hvuint32_t nCells(bitmap.getArraySize());
+	if (pos >= size) {
+		return size;
+	}
+
+	if ((n <= HV_BA_CELL_BITS) && (alignment <= HV_BA_CELL_BITS)
+			&& !(alignment & (alignment - 1u))) {
+		// Short runs: free bits of two cells in a 64-bit window, ANDed with
+		// shifted copies of themselves so that bit p tells whether bits p to
+		// p + n - 1 are free
+		const bvdata_t alignMask(
+				static_cast<bvdata_t>(0xFFFFFFFFULL / ((1ULL << alignment) - 1u)));
+		hvuint32_t c(pos / HV_BA_CELL_BITS);
+		bvdata_t startMask(
+				static_cast<bvdata_t>(~static_cast<bvdata_t>(0u)
+						<< (pos % HV_BA_CELL_BITS)) & alignMask);
+		while (c < nCells) {
+			const bvdata_t lo(this->freeBits(c));
+			if (!lo) {
+				c = this->findNonFullCell(c + 1u);
+				if (c == ~0u) {
+					return size;
+				}
+				startMask = alignMask;
+				continue;
+			}
+			hvuint64_t r(
+					lo
+							| (c + 1u < nCells ?
+									static_cast<hvuint64_t>(this->freeBits(c + 1u))
+											<< HV_BA_CELL_BITS :
+									0u));
+			for (hvuint32_t len = 1u; len < n;) {
+				const hvuint32_t step(len < n - len ? len : n - len);
+				r &= r >> step;
+				len += step;
+			}
+			r &= startMask;
+			if (r) {
+				return c * HV_BA_CELL_BITS + countTrailingZeros(r);
+			}
+			c++;
+			startMask = alignMask;
+		}
+		return size;
+	}
+
+	hvuint32_t p(pos);
+	for (;;) {
+		hvuint32_t runStart;
+		if (n >= 2u * HV_BA_CELL_BITS - 1u) {
+			// Long runs hold an entirely free cell: starting from the first one
+			const hvuint32_t e(
+					this->findEmptyCell(
+							(p + HV_BA_CELL_BITS - 1u) / HV_BA_CELL_BITS));
+			if (e == ~0u) {
+				return size;
+			}
+			runStart = this->findRunStart(e * HV_BA_CELL_BITS, p);
+		} else {
+			runStart = this->findFree(p);
+		}
+		const hvuint64_t start(alignUp(runStart, alignment));
+		if (start + n > size) {
+			return size;
+		}
+		const hvuint32_t s(static_cast<hvuint32_t>(start));
+		const hvuint32_t end(this->findAllocated(s, s + n));
+		if (end == s + n) {
+			return s;
+		}
+		// Bit end is allocated
+		p = end + 1u;
+	}
+}
+
+hvuint32_t BitmapAllocator::findEmptyCell(const hvuint32_t &cell) const {
+	hvuint32_t w(cell / 64u);
+	if (w >= empty.size()) {
+		return ~0u;
+	}
+	hvuint64_t x(empty[w] & (~0ULL << (cell % 64u)));
+	while (!x) {
+		if (++w >= empty.size()) {
+			return ~0u;
+		}
+		x = empty[w];
+	}
+	return w * 64u + countTrailingZeros(x);
+}
+
+hvuint32_t BitmapAllocator::findRunStart(const hvuint32_t &pos,
+		const hvuint32_t &floor) const {
+	const bvdata_t *d(bitmap.getDataAddress());
+	hvuint32_t i(pos);
+	while (i > floor) {
+		const hvuint32_t c((i - 1u) / HV_BA_CELL_BITS);
+		const hvuint32_t base(c * HV_BA_CELL_BITS);
+		const hvuint32_t lo(floor > base ? floor : base);
+		const bvdata_t x(
+				d[c] & HV_LSB_MASK_GEN(bvdata_t, i - base)
+						& ~HV_LSB_MASK_GEN(bvdata_t, lo - base));
+		if (x) {
+			return base + 64u - countLeadingZeros(x);
+		}
+		i = lo;
+	}
+	return floor;
+}
+
+hvuint32_t BitmapAllocator::findFree(const hvuint32_t &pos) const {
+	const hvuint32_t size(bitmap.getSize());
+	if (pos >= size) {
+		return size;
+	}
+	const bvdata_t *d(bitmap.getDataAddress());
+	const hvuint32_t nCells(bitmap.getArraySize());
+	hvuint32_t c(pos / HV_BA_CELL_BITS);
+	bvdata_t x(
+			~d[c] & static_cast<bvdata_t>(~static_cast<bvdata_t>(0u)
+					<< (pos % HV_BA_CELL_BITS)));
+	if (!x) {
+		c = this->findNonFullCell(c + 1u);
+		if (c == ~0u) {
+			return size;
+		}
+		x = ~d[c];
+	}
+	if (c + 1u == nCells) {
+		x &= bitmap.getmaskLastCell();
+		if (!x) {
+			return size;
+		}
+	}
+	return c * HV_BA_CELL_BITS + countTrailingZeros(x);
+}
+
+hvuint32_t BitmapAllocator::findAllocated(const hvuint32_t &pos,
+		const hvuint32_t &limit) const {
+	const bvdata_t *d(bitmap.getDataAddress());
+	hvuint32_t i(pos);
+	while (i < limit) {
+		const hvuint32_t c(i / HV_BA_CELL_BITS);
+		if (!(i % HV_BA_EMPTY_SPAN) && (limit - i >= HV_BA_EMPTY_SPAN)
+				&& (empty[c / 64u] == ~0ULL)) {
+			i += HV_BA_EMPTY_SPAN;
+			continue;
+		}
+		const bvdata_t x(
+				d[c] & static_cast<bvdata_t>(~static_cast<bvdata_t>(0u)
+						<< (i % HV_BA_CELL_BITS)));
+		if (x) {
+			const hvuint32_t ret(c * HV_BA_CELL_BITS + countTrailingZeros(x));
+			return ret < limit ? ret : limit;
+		}
+		i = (c + 1u) * HV_BA_CELL_BITS;
+	}
+	return limit;
+}
+
+void BitmapAllocator::fill(const hvuint32_t &start, const hvuint32_t &n,
+		const bool &value) {
+	bvdata_t *d(bitmap.getDataAddress());
+	const hvuint32_t end(start + n);
+	for (hvuint32_t c = start / HV_BA_CELL_BITS;
+			c * HV_BA_CELL_BITS < end; c++) {
+		const hvuint32_t base(c * HV_BA_CELL_BITS);
+		const unsigned int lo(start > base ? start - base : 0u);
+		const unsigned int hi(
+				end - base < HV_BA_CELL_BITS ? end - base : HV_BA_CELL_BITS);
+		const bvdata_t m(
+				HV_LSB_MASK_GEN(bvdata_t, hi) & ~HV_LSB_MASK_GEN(bvdata_t, lo));
+		d[c] = value ? d[c] | m : d[c] & ~m;
+		this->updateCell(c);
+	}
+	freeCount = value ? freeCount - n : freeCount + n;
+}
+
+BitVector::bvdata_t BitmapAllocator::freeBits(const hvuint32_t &cell) const {
+	const bvdata_t x(~bitmap.getDataAddress()[cell]);
+	return cell + 1u == bitmap.getArraySize() ? x & bitmap.getmaskLastCell() : x;
+}
+
+void BitmapAllocator::updateCell(const hvuint32_t &cell) {
+	const bvdata_t valid(
+			cell + 1u == bitmap.getArraySize() ?
+					bitmap.getmaskLastCell() :
+					static_cast<bvdata_t>(~static_cast<bvdata_t>(0u)));
+	const bvdata_t x(
+			static_cast<const BitVector&>(bitmap).getDataAddress()[cell] & valid);
+	const hvuint64_t m(1ULL << (cell % 64u));
+	empty[cell / 64u] = x ? empty[cell / 64u] & ~m : empty[cell / 64u] | m;
+
+	// Propagating the non-full flag while words change between zero and
+	// non-zero
+	hvuint32_t i(cell);
+	bool flag(x != valid);
+	for (unsigned int l = 0u; l < nonFull.size(); l++) {
+		hvuint64_t &w(nonFull[l][i / 64u]);
+		const bool wasSet(w != 0u);
+		const hvuint64_t b(1ULL << (i % 64u));
+		w = flag ? w | b : w & ~b;
+		if (wasSet == (w != 0u)) {
+			break;
+		}
+		flag = w != 0u;
+		i /= 64u;
+	}
+}
+
+} // namespace common
+} // namespace hv
@@ -0,0 +1,212 @@
+/**
+ * @file bitmapallocator.h
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Contiguous run allocator over a BitVector bitmap
+ */
+
+#ifndef HV_BITMAP_ALLOCATOR_H
+#define HV_BITMAP_ALLOCATOR_H
+
+#include <vector>
+#include "datatypes.h"
+#include "bitvector.h"
+
+namespace hv {
+namespace common {
+
+/**
+ * Allocation policies
+ */
+typedef enum {
+	ALLOC_FIRST_FIT, // Lowest suitable position
+	ALLOC_BEST_FIT   // Smallest free run the request fits in, lowest first
+} hvallocpolicy_t;
+
+/**
+ * Bitmap run allocator
+ *
+ * Allocates runs of contiguous bits, e.g. pages, IOMMU entries or DMA
+ * descriptors, in a bitmap where 1s are allocated bits.
+ *
+ * Two summary bitmaps are kept next to the BitVector: one bit per cell
+ * telling whether the cell has a free bit, organized as a hierarchy of
+ * 64-bit words so that full regions are skipped in a few word reads, and
+ * one bit per cell telling whether the cell is entirely free, so that long
+ * free runs are measured 2048 bits at a time. Runs of up to 32 bits are
+ * searched a cell at a time by ANDing the free bits with shifted copies of
+ * themselves; runs of 63 bits or more always hold an entirely free cell and
+ * are searched from those.
+ */
+class BitmapAllocator {
+public:
+	typedef BitVector::bvsize_t bvsize_t;
+
+	/**
+	 * Position returned when allocation fails
+	 */
+	static const bvsize_t npos = BitVector::npos;
+
+	/**
+	 * Constructor, all bits free
+	 * @param size Number of allocatable bits
+	 * @param policy Allocation policy
+	 */
+	explicit BitmapAllocator(const bvsize_t &size,
+			const hvallocpolicy_t &policy = ALLOC_FIRST_FIT);
+
+	virtual ~BitmapAllocator();
+
+	//** Accessors **//
+	/**
+	 * Get number of allocatable bits
+	 * @return Bitmap size
+	 */
+	bvsize_t getSize() const;
+
+	/**
+	 * Get allocation policy
+	 * @return Allocation policy
+	 */
+	hvallocpolicy_t getPolicy() const;
+
+	/**
+	 * Set allocation policy, used by the following allocations
+	 * @param policy Allocation policy
+	 */
+	void setPolicy(const hvallocpolicy_t &policy);
+
+	/**
+	 * Get number of free bits
+	 * @return Number of free bits
+	 */
+	bvsize_t getFreeCount() const;
+
+	/**
+	 * Get allocation bitmap
+	 * @return Bitmap, 1s for allocated bits
+	 */
+	const BitVector& getBitmap() const;
+
+	/**
+	 * Allocate a run of contiguous bits
+	 * @param n Run length (non-zero)
+	 * @param alignment Run start alignment (non-zero)
+	 * @return Run start, npos if no free run fits
+	 */
+	bvsize_t allocateRun(const bvsize_t &n, const bvsize_t &alignment = 1u);
+
+	/**
+	 * Allocate a given run, e.g. a reserved region
+	 * @param start Run start
+	 * @param n Run length
+	 * @return True if the run was free and is now allocated
+	 */
+	bool allocateAt(const bvsize_t &start, const bvsize_t &n);
+
+	/**
+	 * Free an allocated run
+	 * @param start Run start
+	 * @param n Run length
+	 */
+	void free(const bvsize_t &start, const bvsize_t &n);
+
+	/**
+	 * Check whether a run is free
+	 * @param start Run start
+	 * @param n Run length
+	 * @return True if all bits of the run are free
+	 */
+	bool isFree(const bvsize_t &start, const bvsize_t &n) const;
+
+protected:
+	/**
+	 * First cell at or after a given one having a free bit
+	 * @return Cell index, ~0 if none
+	 */
+	hvuint32_t findNonFullCell(const hvuint32_t &cell) const;
+
+	/**
+	 * First-fit search
+	 * @param pos Lowest start position
+	 * @param n Run length
+	 * @param alignment Run start alignment
+	 * @return Lowest aligned start at or after pos of n free bits, size if
+	 * none
+	 */
+	hvuint32_t findRun(const hvuint32_t &pos, const hvuint32_t &n,
+			const hvuint32_t &alignment) const;
+
+	/**
+	 * First entirely free cell at or after a given one
+	 * @return Cell index, ~0 if none
+	 */
+	hvuint32_t findEmptyCell(const hvuint32_t &cell) const;
+
+	/**
+	 * Start of the free run ending at a position
+	 * @param pos Position following the run
+	 * @param floor Lowest position returned
+	 * @return Position following the last allocated bit in [floor, pos),
+	 * floor if none
+	 */
+	hvuint32_t findRunStart(const hvuint32_t &pos, const hvuint32_t &floor) const;
+
+	/**
+	 * First free bit at or after a position
+	 * @return Position, size if none
+	 */
+	hvuint32_t findFree(const hvuint32_t &pos) const;
+
+	/**
+	 * First allocated bit in [pos, limit)
+	 * @return Position, limit if none
+	 */
+	hvuint32_t findAllocated(const hvuint32_t &pos,
+			const hvuint32_t &limit) const;
+
+	/**
+	 * Set or clear a run and update summaries
+	 */
+	void fill(const hvuint32_t &start, const hvuint32_t &n, const bool &value);
+
+	/**
+	 * Free bits of a cell, bits beyond size cleared
+	 */
+	BitVector::bvdata_t freeBits(const hvuint32_t &cell) const;
+
+	/**
+	 * Update summaries of a cell
+	 */
+	void updateCell(const hvuint32_t &cell);
+
+	/**
+	 * Allocation bitmap
+	 */
+	BitVector bitmap;
+
+	hvallocpolicy_t policy;
+
+	/**
+	 * Number of free bits
+	 */
+	hvuint32_t freeCount;
+
+	/**
+	 * Cells having a free bit, level 0 being one bit per cell and level l
+	 * one bit per word of level l - 1, up to a single word
+	 */
+	std::vector<std::vector<hvuint64_t> > nonFull;
+
+	/**
+	 * Cells entirely free
+	 */
+	std::vector<hvuint64_t> empty;
+};
+
+} // namespace common
+} // namespace hv
+
+#endif // HV_BITMAP_ALLOCATOR_H
@@ -7,326 +7,531 @@
  * @brief Class for efficient and intuitive bit vector representation and manipulation
  */
 
+#ifndef HV_BITVECTOR_CPP
+#define HV_BITVECTOR_CPP
+
+#include <atomic>
+#include <new>
 #include "bitvector.h"
+#include "bitvectorjournal.h"
 
 namespace hv {
 namespace common {
 
-BitVector::BitVector() :
+/**
+ * Header of dynamically allocated cell arrays
+ *
+ * Copies sharing an array hold one reference each.
+ */
+struct BitVector::Buffer {
+	std::atomic<std::size_t> refs;
+};
+
+HV_BV_INLINE BitVector::Buffer* BitVector::bufferOf(const bvdata_t *cells) {
+	return reinterpret_cast<Buffer*>(const_cast<bvdata_t*>(cells)) - 1;
+}
+
+HV_BV_INLINE BitVector::bvdata_t* BitVector::allocateCells(const bvsize_t &n) {
+	void *p(malloc(sizeof(Buffer) + n * sizeof(bvdata_t)));
+	if (p == nullptr) {
+		HV_LOG_ERROR("BitVector allocation error");
+		HV_EXIT_FAILURE();
+	}
+	Buffer *b(new (p) Buffer);
+	b->refs.store(1u, std::memory_order_relaxed);
+	return reinterpret_cast<bvdata_t*>(b + 1);
+}
+
+HV_BV_INLINE void BitVector::releaseCells(bvdata_t *cells) {
+	Buffer *b(bufferOf(cells));
+	// A sole owner needs no atomic decrement
+	if ((b->refs.load(std::memory_order_acquire) == 1u)
+			|| (b->refs.fetch_sub(1u, std::memory_order_acq_rel) == 1u)) {
+		b->~Buffer();
+		free(b);
+	}
+}
+
+HV_BV_INLINE BitVector::BitVector() :
 		parent(nullptr), data(staticData), binSize(32u), arraySize(
 				HV_BV_ARRAY_SIZE(32u)), lowIndex(0u), highIndex(31u), maskLastCell(
-				HV_BV_MASK_LAST_CELL(32u)) {
+				HV_BV_MASK_LAST_CELL(32u)), journaled(false) {
 	this->instantiationChecks(32u);
 	this->operator =(0u);
 }
 
-BitVector::BitVector(const bvsize_t &size, const bool &value,
+HV_BV_INLINE BitVector::BitVector(const bvsize_t &size, const bool &value,
 		BitVector *parentPtr, const bvsize_t &lowIndexSelect,
 		const bvsize_t &highIndexSelect) :
 		parent(parentPtr), data(staticData), binSize(size), arraySize(
 				HV_BV_ARRAY_SIZE(size)), lowIndex(lowIndexSelect), highIndex(
 				parent == nullptr ? size - 1u : highIndexSelect), maskLastCell(
-				HV_BV_MASK_LAST_CELL(size)) {
+				HV_BV_MASK_LAST_CELL(size)), journaled(false) {
 
 	this->instantiationChecks(size);
 	this->operator =(value);
 }
 
-BitVector::BitVector(const bvsize_t &size, const hvuint8_t &value,
+HV_BV_INLINE BitVector::BitVector(const bvsize_t &size, const hvuint8_t &value,
 		BitVector *parentPtr, const bvsize_t &lowIndexSelect,
 		const bvsize_t &highIndexSelect) :
 		parent(parentPtr), data(staticData), binSize(size), arraySize(
 				HV_BV_ARRAY_SIZE(size)), lowIndex(lowIndexSelect), highIndex(
 				parent == nullptr ? size - 1u : highIndexSelect), maskLastCell(
-				HV_BV_MASK_LAST_CELL(size)) {
+				HV_BV_MASK_LAST_CELL(size)), journaled(false) {
 
 	this->instantiationChecks(size);
 	this->operator =(value);
 }
 
-BitVector::BitVector(const bvsize_t &size, const hvuint16_t &value,
+HV_BV_INLINE BitVector::BitVector(const bvsize_t &size, const hvuint16_t &value,
 		BitVector *parentPtr, const bvsize_t &lowIndexSelect,
 		const bvsize_t &highIndexSelect) :
 		parent(parentPtr), data(staticData), binSize(size), arraySize(
 				HV_BV_ARRAY_SIZE(size)), lowIndex(lowIndexSelect), highIndex(
 				parent == nullptr ? size - 1u : highIndexSelect), maskLastCell(
-				HV_BV_MASK_LAST_CELL(size)) {
+				HV_BV_MASK_LAST_CELL(size)), journaled(false) {
 
 	this->instantiationChecks(size);
 	this->operator =(value);
 }
 
-BitVector::BitVector(const bvsize_t &size, const hvuint32_t &value,
+HV_BV_INLINE BitVector::BitVector(const bvsize_t &size, const hvuint32_t &value,
 		BitVector *parentPtr, const bvsize_t &lowIndexSelect,
 		const bvsize_t &highIndexSelect) :
 		parent(parentPtr), data(staticData), binSize(size), arraySize(
 				HV_BV_ARRAY_SIZE(size)), lowIndex(lowIndexSelect), highIndex(
 				parent == nullptr ? size - 1u : highIndexSelect), maskLastCell(
-				HV_BV_MASK_LAST_CELL(size)) {
+				HV_BV_MASK_LAST_CELL(size)), journaled(false) {
 
 	this->instantiationChecks(size);
 	this->operator =(value);
 }
 
-BitVector::BitVector(const bvsize_t &size, const hvuint64_t &value,
+HV_BV_INLINE BitVector::BitVector(const bvsize_t &size, const hvuint64_t &value,
 		BitVector *parentPtr, const bvsize_t &lowIndexSelect,
 		const bvsize_t &highIndexSelect) :
 		parent(parentPtr), data(staticData), binSize(size), arraySize(
 				HV_BV_ARRAY_SIZE(size)), lowIndex(lowIndexSelect), highIndex(
 				parent == nullptr ? size - 1u : highIndexSelect), maskLastCell(
-				HV_BV_MASK_LAST_CELL(size)) {
+				HV_BV_MASK_LAST_CELL(size)), journaled(false) {
 
 	this->instantiationChecks(size);
 	this->operator =(value);
 }
 
-BitVector::BitVector(const bvsize_t &size, const hvint8_t &value,
+HV_BV_INLINE BitVector::BitVector(const bvsize_t &size, const hvint8_t &value,
 		BitVector *parentPtr, const bvsize_t &lowIndexSelect,
 		const bvsize_t &highIndexSelect) :
 		parent(parentPtr), data(staticData), binSize(size), arraySize(
 				HV_BV_ARRAY_SIZE(size)), lowIndex(lowIndexSelect), highIndex(
 				parent == nullptr ? size - 1u : highIndexSelect), maskLastCell(
-				HV_BV_MASK_LAST_CELL(size)) {
+				HV_BV_MASK_LAST_CELL(size)), journaled(false) {
 
 	this->instantiationChecks(size);
 	this->operator =(value);
 }
 
-BitVector::BitVector(const bvsize_t &size, const hvint16_t &value,
+HV_BV_INLINE BitVector::BitVector(const bvsize_t &size, const hvint16_t &value,
 		BitVector *parentPtr, const bvsize_t &lowIndexSelect,
 		const bvsize_t &highIndexSelect) :
 		parent(parentPtr), data(staticData), binSize(size), arraySize(
 				HV_BV_ARRAY_SIZE(size)), lowIndex(lowIndexSelect), highIndex(
 				parent == nullptr ? size - 1u : highIndexSelect), maskLastCell(
-				HV_BV_MASK_LAST_CELL(size)) {
+				HV_BV_MASK_LAST_CELL(size)), journaled(false) {
 
 	this->instantiationChecks(size);
 	this->operator =(value);
 }
 
-BitVector::BitVector(const bvsize_t &size, const hvint32_t &value,
+HV_BV_INLINE BitVector::BitVector(const bvsize_t &size, const hvint32_t &value,
 		BitVector *parentPtr, const bvsize_t &lowIndexSelect,
 		const bvsize_t &highIndexSelect) :
 		parent(parentPtr), data(staticData), binSize(size), arraySize(
 				HV_BV_ARRAY_SIZE(size)), lowIndex(lowIndexSelect), highIndex(
 				parent == nullptr ? size - 1u : highIndexSelect), maskLastCell(
-				HV_BV_MASK_LAST_CELL(size)) {
+				HV_BV_MASK_LAST_CELL(size)), journaled(false) {
 
 	this->instantiationChecks(size);
 	this->operator =(value);
 }
 
-BitVector::BitVector(const bvsize_t &size, const hvint64_t &value,
+HV_BV_INLINE BitVector::BitVector(const bvsize_t &size, const hvint64_t &value,
 		BitVector *parentPtr, const bvsize_t &lowIndexSelect,
 		const bvsize_t &highIndexSelect) :
 		parent(parentPtr), data(staticData), binSize(size), arraySize(
 				HV_BV_ARRAY_SIZE(size)), lowIndex(lowIndexSelect), highIndex(
 				parent == nullptr ? size - 1u : highIndexSelect), maskLastCell(
-				HV_BV_MASK_LAST_CELL(size)) {
+				HV_BV_MASK_LAST_CELL(size)), journaled(false) {
 
 	this->instantiationChecks(size);
 	this->operator =(value);
 }
 
-BitVector::BitVector(const bvsize_t &size, const std::string &value,
+#ifdef HV_HAS_INT128
+HV_BV_INLINE BitVector::BitVector(const bvsize_t &size, const hvuint128_t &value,
 		BitVector *parentPtr, const bvsize_t &lowIndexSelect,
 		const bvsize_t &highIndexSelect) :
 		parent(parentPtr), data(staticData), binSize(size), arraySize(
 				HV_BV_ARRAY_SIZE(size)), lowIndex(lowIndexSelect), highIndex(
 				parent == nullptr ? size - 1u : highIndexSelect), maskLastCell(
-				HV_BV_MASK_LAST_CELL(size)) {
+				HV_BV_MASK_LAST_CELL(size)), journaled(false) {
+
 	this->instantiationChecks(size);
-	this->fromString(value);
+	this->operator =(value);
 }
 
-BitVector::BitVector(const bvsize_t &size, const BitVector &value,
+HV_BV_INLINE BitVector::BitVector(const bvsize_t &size, const hvint128_t &value,
 		BitVector *parentPtr, const bvsize_t &lowIndexSelect,
 		const bvsize_t &highIndexSelect) :
 		parent(parentPtr), data(staticData), binSize(size), arraySize(
 				HV_BV_ARRAY_SIZE(size)), lowIndex(lowIndexSelect), highIndex(
 				parent == nullptr ? size - 1u : highIndexSelect), maskLastCell(
-				HV_BV_MASK_LAST_CELL(size)) {
+				HV_BV_MASK_LAST_CELL(size)), journaled(false) {
+
 	this->instantiationChecks(size);
 	this->operator =(value);
 }
+#endif
+
+HV_BV_INLINE BitVector::BitVector(const bvsize_t &size, const std::string &value,
+		BitVector *parentPtr, const bvsize_t &lowIndexSelect,
+		const bvsize_t &highIndexSelect) :
+		parent(parentPtr), data(staticData), binSize(size), arraySize(
+				HV_BV_ARRAY_SIZE(size)), lowIndex(lowIndexSelect), highIndex(
+				parent == nullptr ? size - 1u : highIndexSelect), maskLastCell(
+				HV_BV_MASK_LAST_CELL(size)), journaled(false) {
+	this->instantiationChecks(size);
+	this->fromString(value);
+}
+
+HV_BV_INLINE BitVector::BitVector(const bvsize_t &size, const BitVector &value,
+		BitVector *parentPtr, const bvsize_t &lowIndexSelect,
+		const bvsize_t &highIndexSelect) :
+		parent(parentPtr), data(staticData), binSize(size), arraySize(
+				HV_BV_ARRAY_SIZE(size)), lowIndex(lowIndexSelect), highIndex(
+				parent == nullptr ? size - 1u : highIndexSelect), maskLastCell(
+				HV_BV_MASK_LAST_CELL(size)), journaled(false) {
+	this->instantiationChecks(size);
+	// Cells are copied: the result is often written directly
+	this->assign(value);
+	this->updateParent();
+}
 
-BitVector::BitVector(const bool &value) :
+HV_BV_INLINE BitVector::BitVector(const bool &value) :
 		BitVector(1, value) {
 }
 
-BitVector::BitVector(const hvuint8_t &value) :
+HV_BV_INLINE BitVector::BitVector(const hvuint8_t &value) :
 		BitVector(8, value) {
 }
 
-BitVector::BitVector(const hvuint16_t &value) :
+HV_BV_INLINE BitVector::BitVector(const hvuint16_t &value) :
 		BitVector(16, value) {
 }
 
-BitVector::BitVector(const hvuint32_t &value) :
+HV_BV_INLINE BitVector::BitVector(const hvuint32_t &value) :
 		BitVector(32, value) {
 }
 
-BitVector::BitVector(const hvuint64_t &value) :
+HV_BV_INLINE BitVector::BitVector(const hvuint64_t &value) :
 		BitVector(64, value) {
 }
 
-BitVector::BitVector(const hvint8_t &value) :
+HV_BV_INLINE BitVector::BitVector(const hvint8_t &value) :
 		BitVector(8, value) {
 }
 
-BitVector::BitVector(const hvint16_t &value) :
+HV_BV_INLINE BitVector::BitVector(const hvint16_t &value) :
 		BitVector(16, value) {
 }
 
-BitVector::BitVector(const hvint32_t &value) :
+HV_BV_INLINE BitVector::BitVector(const hvint32_t &value) :
 		BitVector(32, value) {
 }
 
-BitVector::BitVector(const hvint64_t &value) :
+HV_BV_INLINE BitVector::BitVector(const hvint64_t &value) :
 		BitVector(64, value) {
 }
 
-BitVector::BitVector(const std::string &value) :
+#ifdef HV_HAS_INT128
+HV_BV_INLINE BitVector::BitVector(const hvuint128_t &value) :
+		BitVector(128, value) {
+}
+
+HV_BV_INLINE BitVector::BitVector(const hvint128_t &value) :
+		BitVector(128, value) {
+}
+#endif
+
+HV_BV_INLINE BitVector::BitVector(const std::string &value) :
 		BitVector(value.length(), value) {
 }
 
-BitVector::BitVector(const BitVector &src) :
-		BitVector(src.binSize, src, src.parent, src.lowIndex, src.highIndex) {
+HV_BV_INLINE BitVector::BitVector(const BitVector &src) :
+		parent(src.parent), data(staticData), binSize(src.binSize), arraySize(
+				src.arraySize), lowIndex(src.lowIndex), highIndex(
+				parent == nullptr ? src.binSize - 1u : src.highIndex), maskLastCell(
+				src.maskLastCell), journaled(false) {
+	if (src.isShareable()) {
+		data = src.data;
+		bufferOf(data)->refs.fetch_add(1u, std::memory_order_relaxed);
+	} else {
+		this->instantiationChecks(binSize);
+		this->operator =(src);
+	}
 }
 
-BitVector::~BitVector() {
+HV_BV_INLINE BitVector::~BitVector() {
+	if (journaled) {
+		BitVectorJournal::forget(*this);
+	}
 	if (data != &(staticData[0])) {
-		free(data);
+		releaseCells(data);
 	}
 }
 
-BitVector::bvsize_t BitVector::getSize() const {
+HV_BV_INLINE BitVector::bvsize_t BitVector::getSize() const {
 	return this->binSize;
 }
 
-BitVector::bvsize_t BitVector::getArraySize() const {
+HV_BV_INLINE BitVector::bvsize_t BitVector::getArraySize() const {
 	return this->arraySize;
 }
 
-BitVector::bvdata_t BitVector::getmaskLastCell() const {
+HV_BV_INLINE BitVector::bvdata_t BitVector::getmaskLastCell() const {
 	return this->maskLastCell;
 }
 
-BitVector* BitVector::getParentAddress() const {
+HV_BV_INLINE BitVector* BitVector::getParentAddress() const {
 	return this->parent;
 }
-BitVector::bvsize_t BitVector::getLowIndex() const {
+HV_BV_INLINE void BitVector::syncParent() {
+	this->updateParent();
+}
+HV_BV_INLINE BitVector::bvsize_t BitVector::getLowIndex() const {
 	return this->lowIndex;
 }
-BitVector::bvsize_t BitVector::getHighIndex() const {
+HV_BV_INLINE BitVector::bvsize_t BitVector::getHighIndex() const {
 	return this->highIndex;
 }
 
-BitVector::bvdata_t* BitVector::getDataAddress() {
-	return this->data;
+HV_BV_INLINE void BitVector::setJournaled(const bool &enable) {
+	this->journaled = enable;
+}
+
+HV_BV_INLINE bool BitVector::isJournaled() const {
+	return this->journaled;
+}
+
+HV_BV_INLINE void BitVector::setShareThreshold(const bvsize_t &bitwidth) {
+	shareThreshold() = bitwidth;
 }
 
-BitVector::operator bool() const {
+HV_BV_INLINE BitVector::bvsize_t BitVector::getShareThreshold() {
+	return shareThreshold();
+}
+
+HV_BV_INLINE bool BitVector::isShared() const {
+	return (data != staticData)
+			&& (bufferOf(data)->refs.load(std::memory_order_acquire) > 1u);
+}
+
+HV_BV_INLINE BitVector::operator bool() const {
 	return !this->operator !();
 }
 
-BitVector::operator hvuint8_t() const {
+HV_BV_INLINE BitVector::operator hvuint8_t() const {
 	return this->getData<hvuint8_t>();
 }
 
-BitVector::operator hvuint16_t() const {
+HV_BV_INLINE BitVector::operator hvuint16_t() const {
 	return this->getData<hvuint16_t>();
 }
 
-BitVector::operator hvuint32_t() const {
+HV_BV_INLINE BitVector::operator hvuint32_t() const {
 	return this->getData<hvuint32_t>();
 }
 
-BitVector::operator hvuint64_t() const {
+HV_BV_INLINE BitVector::operator hvuint64_t() const {
 	return this->getData<hvuint64_t>();
 }
 
-BitVector::operator hvint8_t() const {
+HV_BV_INLINE BitVector::operator hvint8_t() const {
 	return this->getData<hvint8_t>();
 }
 
-BitVector::operator hvint16_t() const {
+HV_BV_INLINE BitVector::operator hvint16_t() const {
 	return this->getData<hvint16_t>();
 }
 
-BitVector::operator hvint32_t() const {
+HV_BV_INLINE BitVector::operator hvint32_t() const {
 	return this->getData<hvint32_t>();
 }
 
-BitVector::operator hvint64_t() const {
+HV_BV_INLINE BitVector::operator hvint64_t() const {
 	return this->getData<hvint64_t>();
 }
 
-BitVector::operator std::string() const {
+#ifdef HV_HAS_INT128
+HV_BV_INLINE BitVector::operator hvuint128_t() const {
+	return this->getData<hvuint128_t>();
+}
+
+HV_BV_INLINE BitVector::operator hvint128_t() const {
+	return this->getData<hvint128_t>();
+}
+#endif
+
+HV_BV_INLINE BitVector::operator std::string() const {
 	return this->toString();
 }
 
-BitVector& BitVector::operator =(const bool &src) {
+HV_BV_INLINE BitVector& BitVector::operator =(const bool &src) {
+	if (journaled) {
+		BitVectorJournal::recordAll(*this);
+	}
 	this->setData<bool>(src);
 	this->updateParent();
 	return *this;
 }
 
-BitVector& BitVector::operator =(const hvuint8_t &src) {
+HV_BV_INLINE BitVector& BitVector::operator =(const hvuint8_t &src) {
+	if (journaled) {
+		BitVectorJournal::recordAll(*this);
+	}
 	this->setData<hvuint8_t>(src);
 	this->updateParent();
 	return *this;
 }
 
-BitVector& BitVector::operator =(const hvuint16_t &src) {
+HV_BV_INLINE BitVector& BitVector::operator =(const hvuint16_t &src) {
+	if (journaled) {
+		BitVectorJournal::recordAll(*this);
+	}
 	this->setData<hvuint16_t>(src);
 	this->updateParent();
 	return *this;
 }
 
-BitVector& BitVector::operator =(const hvuint32_t &src) {
+HV_BV_INLINE BitVector& BitVector::operator =(const hvuint32_t &src) {
+	if (journaled) {
+		BitVectorJournal::recordAll(*this);
+	}
 	this->setData<hvuint32_t>(src);
 	this->updateParent();
 	return *this;
 }
 
-BitVector& BitVector::operator =(const hvuint64_t &src) {
+HV_BV_INLINE BitVector& BitVector::operator =(const hvuint64_t &src) {
+	if (journaled) {
+		BitVectorJournal::recordAll(*this);
+	}
 	this->setData<hvuint64_t>(src);
 	this->updateParent();
 	return *this;
 }
 
-BitVector& BitVector::operator =(const hvint8_t &src) {
+HV_BV_INLINE BitVector& BitVector::operator =(const hvint8_t &src) {
+	if (journaled) {
+		BitVectorJournal::recordAll(*this);
+	}
 	this->setData<hvint8_t>(src);
 	this->updateParent();
 	return *this;
 }
 
-BitVector& BitVector::operator =(const hvint16_t &src) {
+HV_BV_INLINE BitVector& BitVector::operator =(const hvint16_t &src) {
+	if (journaled) {
+		BitVectorJournal::recordAll(*this);
+	}
 	this->setData<hvint16_t>(src);
 	this->updateParent();
 	return *this;
 }
 
-BitVector& BitVector::operator =(const hvint32_t &src) {
+HV_BV_INLINE BitVector& BitVector::operator =(const hvint32_t &src) {
+	if (journaled) {
+		BitVectorJournal::recordAll(*this);
+	}
 	this->setData<hvint32_t>(src);
 	this->updateParent();
 	return *this;
 }
 
-BitVector& BitVector::operator =(const hvint64_t &src) {
+HV_BV_INLINE BitVector& BitVector::operator =(const hvint64_t &src) {
+	if (journaled) {
+		BitVectorJournal::recordAll(*this);
+	}
 	this->setData<hvint64_t>(src);
 	this->updateParent();
 	return *this;
 }
 
-BitVector& BitVector::operator =(const std::string &src) {
+#ifdef HV_HAS_INT128
+HV_BV_INLINE BitVector& BitVector::operator =(const hvuint128_t &src) {
+	if (journaled) {
+		BitVectorJournal::recordAll(*this);
+	}
+	this->setData<hvuint128_t>(src);
+	this->updateParent();
+	return *this;
+}
+
+HV_BV_INLINE BitVector& BitVector::operator =(const hvint128_t &src) {
+	if (journaled) {
+		BitVectorJournal::recordAll(*this);
+	}
+	this->setData<hvint128_t>(src);
+	this->updateParent();
+	return *this;
+}
+#endif
+
+HV_BV_INLINE BitVector& BitVector::operator =(const std::string &src) {
+	if (journaled) {
+		BitVectorJournal::recordAll(*this);
+	}
 	this->fromString(src);
 	this->updateParent();
 	return *this;
 }
 
-BitVector& BitVector::operator =(const BitVector &src) {
+HV_BV_INLINE void BitVector::journalAssignment(const BitVector &src) {
+	const bvdata_t *s(src.data);
+	for (bvsize_t i = 0u; i < arraySize; i++) {
+		bvdata_t w(0u);
+		if ((src.binSize >= binSize) || (i + 1u < src.arraySize)) {
+			w = s[i];
+		} else if (i + 1u == src.arraySize) {
+			w = s[i] & src.maskLastCell;
+		}
+		if (w != data[i]) {
+			BitVectorJournal::record(*this, i);
+		}
+	}
+}
+
+HV_BV_INLINE BitVector& BitVector::operator =(const BitVector &src) {
+	if (journaled) {
+		this->journalAssignment(src);
+	}
+	if ((src.binSize == binSize) && src.isShareable()) {
+		if (data != src.data) {
+			bufferOf(src.data)->refs.fetch_add(1u, std::memory_order_relaxed);
+			releaseCells(data);
+			data = src.data;
+		}
+		this->updateParent();
+		return *this;
+	}
+	this->assign(src);
+	this->updateParent();
+	return *this;
+}
+
+HV_BV_INLINE void BitVector::assign(const BitVector &src) {
+	this->unshare();
 	if (src.binSize >= binSize) {
 		for (bvsize_t i = 0u; i < arraySize; i++) {
 			data[i] = src.data[i];
@@ -341,11 +546,9 @@ BitVector& BitVector::operator =(const BitVector &src) {
 			data[i] = static_cast<bvdata_t>(0u);
 		}
 	}
-	this->updateParent();
-	return *this;
 }
 
-BitVector BitVector::operator <<(const hvuint32_t &nShift) const {
+HV_BV_INLINE BitVector BitVector::operator <<(const hvuint32_t &nShift) const {
 	// Case 1: no shifting
 	BitVector ret(binSize, *this);
 	// Case 2: shifting larger than size
@@ -383,14 +586,14 @@ BitVector BitVector::operator <<(const hvuint32_t &nShift) const {
 	return ret;
 }
 
-BitVector BitVector::operator <<(const hvint32_t &nShift) const {
+HV_BV_INLINE BitVector BitVector::operator <<(const hvint32_t &nShift) const {
 	if (nShift >= 0) {
 		return operator <<(static_cast<hvuint32_t>(nShift));
 	}
 	return operator >>(static_cast<hvuint32_t>(-nShift));
 }
 
-BitVector BitVector::operator >>(const hvuint32_t &nShift) const {
+HV_BV_INLINE BitVector BitVector::operator >>(const hvuint32_t &nShift) const {
 	// Case 1: no shifting
 	BitVector ret(binSize, *this);
 	// Case 2: shifting larger than size
@@ -427,38 +630,38 @@ BitVector BitVector::operator >>(const hvuint32_t &nShift) const {
 	return ret;
 }
 
-BitVector BitVector::operator >>(const hvint32_t &nShift) const {
+HV_BV_INLINE BitVector BitVector::operator >>(const hvint32_t &nShift) const {
 	if (nShift >= 0) {
 		return operator >>(static_cast<hvuint32_t>(nShift));
 	}
 	return operator <<(static_cast<hvuint32_t>(-nShift));
 }
 
-BitVector& BitVector::operator<<=(const hvuint32_t &nShift) {
+HV_BV_INLINE BitVector& BitVector::operator<<=(const hvuint32_t &nShift) {
 	this->operator =(this->operator <<(nShift));
 	return *this;
 }
 
-BitVector& BitVector::operator <<=(const hvint32_t &nShift) {
+HV_BV_INLINE BitVector& BitVector::operator <<=(const hvint32_t &nShift) {
 	if (nShift >= 0) {
 		return this->operator <<=(static_cast<hvuint32_t>(nShift));
 	}
 	return this->operator >>=(static_cast<hvuint32_t>(-nShift));
 }
 
-BitVector& BitVector::operator>>=(const hvuint32_t &nShift) {
+HV_BV_INLINE BitVector& BitVector::operator>>=(const hvuint32_t &nShift) {
 	this->operator =(this->operator >>(nShift));
 	return *this;
 }
 
-BitVector& BitVector::operator >>=(const hvint32_t &nShift) {
+HV_BV_INLINE BitVector& BitVector::operator >>=(const hvint32_t &nShift) {
 	if (nShift >= 0) {
 		return this->operator >>=(static_cast<hvuint32_t>(nShift));
 	}
 	return this->operator <<=(static_cast<hvuint32_t>(-nShift));
 }
 
-bool BitVector::operator !() const {
+HV_BV_INLINE bool BitVector::operator !() const {
 	bool ret(false);
 	for (bvsize_t i = 0; i < arraySize - 1; i++) {
 		ret |= data[i];
@@ -467,15 +670,15 @@ bool BitVector::operator !() const {
 	return !ret;
 }
 
-bool BitVector::operator &&(const BitVector &op2) const {
+HV_BV_INLINE bool BitVector::operator &&(const BitVector &op2) const {
 	return !((this->operator !()) || (!op2));
 }
 
-bool BitVector::operator ||(const BitVector &op2) const {
+HV_BV_INLINE bool BitVector::operator ||(const BitVector &op2) const {
 	return !((this->operator !()) && (!op2));
 }
 
-bool BitVector::operator ==(const BitVector &op2) const {
+HV_BV_INLINE bool BitVector::operator ==(const BitVector &op2) const {
 	bool ret(true);
 	bool op1SmallerThanOp2(binSize <= op2.binSize);
 	bvsize_t nFullCells(HV_MIN(arraySize, op2.arraySize) - 1u);
@@ -517,11 +720,11 @@ bool BitVector::operator ==(const BitVector &op2) const {
 	return ret;
 }
 
-bool BitVector::operator !=(const BitVector &op2) const {
+HV_BV_INLINE bool BitVector::operator !=(const BitVector &op2) const {
 	return !this->operator ==(op2);
 }
 
-BitVector BitVector::operator ~() const {
+HV_BV_INLINE BitVector BitVector::operator ~() const {
 	BitVector ret(binSize, 0u);
 	for (bvsize_t i = 0u; i < arraySize; i++) {
 		ret.data[i] = ~data[i];
@@ -529,7 +732,7 @@ BitVector BitVector::operator ~() const {
 	return ret;
 }
 
-BitVector BitVector::operator &(const BitVector &op2) const {
+HV_BV_INLINE BitVector BitVector::operator &(const BitVector &op2) const {
 	bvsize_t retSize(HV_MAX(binSize, op2.binSize));
 	bvsize_t minArraySize(HV_MIN(arraySize, op2.arraySize));
 	bool op1SmallerThanOp2(binSize <= op2.binSize);
@@ -546,7 +749,7 @@ BitVector BitVector::operator &(const BitVector &op2) const {
 	return ret;
 }
 
-BitVector BitVector::operator |(const BitVector &op2) const {
+HV_BV_INLINE BitVector BitVector::operator |(const BitVector &op2) const {
 	bvsize_t retSize(HV_MAX(binSize, op2.binSize));
 	bvsize_t minArraySize(HV_MIN(arraySize, op2.arraySize));
 	bool op1SmallerThanOp2(binSize <= op2.binSize);
@@ -565,7 +768,7 @@ BitVector BitVector::operator |(const BitVector &op2) const {
 		}
 	} else {
 		ret.data[minArraySize - 1u] = data[minArraySize - 1u]
-				| (op2.data[minArraySize - 1u] & op2.arraySize);
+				| (op2.data[minArraySize - 1u] & op2.maskLastCell);
 		for (bvsize_t i = minArraySize; i < arraySize; i++) {
 			ret.data[i] = data[i];
 		}
@@ -573,7 +776,7 @@ BitVector BitVector::operator |(const BitVector &op2) const {
 	return ret;
 }
 
-BitVector BitVector::operator ^(const BitVector &op2) const {
+HV_BV_INLINE BitVector BitVector::operator ^(const BitVector &op2) const {
 	bvsize_t retSize(HV_MAX(binSize, op2.binSize));
 	bvsize_t minArraySize(HV_MIN(arraySize, op2.arraySize));
 	bool op1SmallerThanOp2(binSize <= op2.binSize);
@@ -581,39 +784,160 @@ BitVector BitVector::operator ^(const BitVector &op2) const {
 	for (bvsize_t i = 0u; i < minArraySize - 1u; i++) {
 		ret.data[i] = data[i] ^ op2.data[i];
 	}
-	ret.data[minArraySize - 1u] =
-			op1SmallerThanOp2 ?
-					(data[minArraySize - 1u] ^ op2.data[minArraySize - 1u])
-							& maskLastCell :
-					(data[minArraySize - 1u] ^ op2.data[minArraySize - 1u])
-							& op2.maskLastCell;
+	if (arraySize == op2.arraySize) {
+		ret.data[minArraySize - 1u] = (data[minArraySize - 1u] & maskLastCell)
+				^ (op2.data[minArraySize - 1u] & op2.maskLastCell);
+	} else if (op1SmallerThanOp2) {
+		ret.data[minArraySize - 1u] = (data[minArraySize - 1u] & maskLastCell)
+				^ op2.data[minArraySize - 1u];
+		for (bvsize_t i = minArraySize; i < op2.arraySize; i++) {
+			ret.data[i] = op2.data[i];
+		}
+	} else {
+		ret.data[minArraySize - 1u] = data[minArraySize - 1u]
+				^ (op2.data[minArraySize - 1u] & op2.maskLastCell);
+		for (bvsize_t i = minArraySize; i < arraySize; i++) {
+			ret.data[i] = data[i];
+		}
+	}
 	return ret;
 }
 
-BitVector& BitVector::operator &=(const BitVector &op2) {
+HV_BV_INLINE BitVector& BitVector::operator &=(const BitVector &op2) {
 	this->operator =(this->operator &(op2));
 	return *this;
 }
 
-BitVector& BitVector::operator |=(const BitVector &op2) {
+HV_BV_INLINE BitVector& BitVector::operator |=(const BitVector &op2) {
 	this->operator =(this->operator |(op2));
 	return *this;
 }
 
-BitVector& BitVector::operator ^=(const BitVector &op2) {
+HV_BV_INLINE BitVector& BitVector::operator ^=(const BitVector &op2) {
 	this->operator =(this->operator ^(op2));
 	return *this;
 }
 
-BitVector BitVector::operator +(const BitVector &op2) const {
-	BitVector ret(binSize + op2.binSize, op2);
-	BitVector tmp(binSize + op2.binSize, *this);
-	tmp <<= op2.binSize;
-	ret |= tmp;
+/**
+ * Number of cells covered by a scalar operand
+ */
+#define HV_BV_SCALAR_CELLS (BITWIDTH_OF(BitVector::bvscalar_t) / BITWIDTH_OF(HV_BV_BASE_TYPE))
+
+HV_BV_INLINE BitVector::bvdata_t BitVector::scalarCell(const bvscalar_t &value,
+		const bvsize_t &i) {
+	return i < HV_BV_SCALAR_CELLS ?
+			static_cast<bvdata_t>(value >> (i * BITWIDTH_OF(bvdata_t))) :
+			static_cast<bvdata_t>(0u);
+}
+
+HV_BV_INLINE bool BitVector::isEqualScalar(const bvscalar_t &value) const {
+	for (bvsize_t i = 0u; i < arraySize - 1u; i++) {
+		if (data[i] != scalarCell(value, i)) {
+			return false;
+		}
+	}
+	if ((data[arraySize - 1u] & maskLastCell)
+			!= scalarCell(value, arraySize - 1u)) {
+		return false;
+	}
+	// Scalar bits beyond the last cell must be 0
+	return (arraySize >= HV_BV_SCALAR_CELLS)
+			|| !(value >> (arraySize * BITWIDTH_OF(bvdata_t)));
+}
+
+HV_BV_INLINE BitVector BitVector::andScalar(const bvscalar_t &value) const {
+	BitVector ret(binSize, false);
+	const bvsize_t n(
+			HV_MIN(arraySize, static_cast<bvsize_t>(HV_BV_SCALAR_CELLS)));
+	for (bvsize_t i = 0u; i < n; i++) {
+		ret.data[i] = data[i] & scalarCell(value, i);
+	}
+	ret.data[arraySize - 1u] &= maskLastCell;
+	return ret;
+}
+
+HV_BV_INLINE BitVector BitVector::orScalar(const bvscalar_t &value,
+		const bvsize_t &width) const {
+	return this->scalarOp(value, width, false);
+}
+
+HV_BV_INLINE BitVector BitVector::xorScalar(const bvscalar_t &value,
+		const bvsize_t &width) const {
+	return this->scalarOp(value, width, true);
+}
+
+HV_BV_INLINE BitVector BitVector::scalarOp(const bvscalar_t &value, const bvsize_t &width,
+		const bool &isXor) const {
+	BitVector ret(HV_MAX(binSize, width), false);
+	for (bvsize_t i = 0u; i < arraySize - 1u; i++) {
+		ret.data[i] = data[i];
+	}
+	ret.data[arraySize - 1u] = data[arraySize - 1u] & maskLastCell;
+	const bvsize_t n(
+			HV_MIN(ret.arraySize, static_cast<bvsize_t>(HV_BV_SCALAR_CELLS)));
+	for (bvsize_t i = 0u; i < n; i++) {
+		ret.data[i] =
+				isXor ? ret.data[i] ^ scalarCell(value, i) :
+						ret.data[i] | scalarCell(value, i);
+	}
+	ret.data[ret.arraySize - 1u] &= ret.maskLastCell;
 	return ret;
 }
 
-BitVector BitVector::operator ()(const bvsize_t &ind1, const bvsize_t &ind2) {
+HV_BV_INLINE BitVector& BitVector::andEqualScalar(const bvscalar_t &value) {
+	this->unshare();
+	for (bvsize_t i = 0u; i < arraySize; i++) {
+		const bvdata_t w(data[i] & scalarCell(value, i));
+		if (journaled && (w != data[i])) {
+			BitVectorJournal::record(*this, i);
+		}
+		data[i] = w;
+	}
+	this->updateParent();
+	return *this;
+}
+
+HV_BV_INLINE BitVector& BitVector::orEqualScalar(const bvscalar_t &value) {
+	this->unshare();
+	const bvsize_t n(
+			HV_MIN(arraySize, static_cast<bvsize_t>(HV_BV_SCALAR_CELLS)));
+	for (bvsize_t i = 0u; i < n; i++) {
+		bvdata_t w(data[i] | scalarCell(value, i));
+		if (i == arraySize - 1u) {
+			w &= maskLastCell;
+		}
+		if (journaled && (w != data[i])) {
+			BitVectorJournal::record(*this, i);
+		}
+		data[i] = w;
+	}
+	this->updateParent();
+	return *this;
+}
+
+HV_BV_INLINE BitVector& BitVector::xorEqualScalar(const bvscalar_t &value) {
+	this->unshare();
+	const bvsize_t n(
+			HV_MIN(arraySize, static_cast<bvsize_t>(HV_BV_SCALAR_CELLS)));
+	for (bvsize_t i = 0u; i < n; i++) {
+		bvdata_t w(data[i] ^ scalarCell(value, i));
+		if (i == arraySize - 1u) {
+			w &= maskLastCell;
+		}
+		if (journaled && (w != data[i])) {
+			BitVectorJournal::record(*this, i);
+		}
+		data[i] = w;
+	}
+	this->updateParent();
+	return *this;
+}
+
+HV_BV_INLINE BitVector BitVector::operator +(const BitVector &op2) const {
+	return concat(*this, op2);
+}
+
+HV_BV_INLINE BitVector BitVector::operator ()(const bvsize_t &ind1, const bvsize_t &ind2) {
 	bool ind1SupInd2 = ind1 > ind2;
 	bvsize_t ind1Tmp = ind1SupInd2 ? ind2 : ind1;
 	bvsize_t ind2Tmp = ind1SupInd2 ? ind1 : ind2;
@@ -625,7 +949,7 @@ BitVector BitVector::operator ()(const bvsize_t &ind1, const bvsize_t &ind2) {
 
 }
 
-BitVector BitVector::operator ()(const bvsize_t &ind1,
+HV_BV_INLINE BitVector BitVector::operator ()(const bvsize_t &ind1,
 		const bvsize_t &ind2) const {
 	bool ind1SupInd2 = ind1 > ind2;
 	bvsize_t ind1Tmp = ind1SupInd2 ? ind2 : ind1;
@@ -636,34 +960,32 @@ BitVector BitVector::operator ()(const bvsize_t &ind1,
 	return BitVector(ind2Tmp - ind1Tmp + 1u, this->operator >>(ind1Tmp));
 }
 
-BitVector BitVector::operator [](const bvsize_t &ind) {
+HV_BV_INLINE BitVector BitVector::operator [](const bvsize_t &ind) {
 	HV_ASSERT((0u <= ind) && (ind < binSize),
 			"Index out of scope ({}) is not in (0,{})", ind, (binSize - 1u));
 	return BitVector(1u, this->operator >>(ind), this, ind, ind);
 }
 
-BitVector BitVector::operator [](const bvsize_t &ind) const {
+HV_BV_INLINE BitVector BitVector::operator [](const bvsize_t &ind) const {
 	HV_ASSERT((0u <= ind) && (ind < binSize),
 			"Index out of scope ({}) is not in (0,{})", ind, (binSize - 1u));
 	return BitVector(1u, this->operator >>(ind));
 }
 
-void BitVector::rand() {
-	// rand numbers are set by slices of 16 bits
-	const bvsize_t HOW_MANY_RAND_NUMBERS_IN_A_CELL(sizeof(bvdata_t) / 2);
-	const hvuint32_t sixteenBitsMask(
-			static_cast<hvuint32_t>(~static_cast<hvuint16_t>(0u)));
-	for (bvsize_t i = 0; i < arraySize; i++) {
-		bvdata_t tmp = static_cast<bvdata_t>(::std::rand() & sixteenBitsMask);
-		for (bvsize_t j = 1; j < HOW_MANY_RAND_NUMBERS_IN_A_CELL; j++) {
-			tmp <<= 16;
-			tmp |= static_cast<bvdata_t>(::std::rand() & sixteenBitsMask);
-		}
-		data[i] = tmp;
+HV_BV_INLINE void BitVector::rand() {
+	this->rand(RandomEngine::getThreadEngine());
+}
+
+HV_BV_INLINE void BitVector::rand(RandomEngine &engine) {
+	if (journaled) {
+		BitVectorJournal::recordAll(*this);
 	}
+	this->unshare();
+	// Whole cells are filled at once
+	engine.fill(data, arraySize);
 }
 
-void BitVector::fromString(const std::string &src) {
+HV_BV_INLINE void BitVector::fromString(const std::string &src) {
 	this->reset();
 	bvsize_t dataCpt(0u);
 	bvsize_t arrayCpt(0u);
@@ -687,7 +1009,7 @@ void BitVector::fromString(const std::string &src) {
 	}
 }
 
-std::string BitVector::toString() const {
+HV_BV_INLINE std::string BitVector::toString() const {
 
 	std::string ret = "";
 	bvdata_t mask(1u);
@@ -716,15 +1038,15 @@ std::string BitVector::toString() const {
 	return ret;
 }
 
-std::ostream& operator <<(std::ostream &strm, const BitVector &bv) {
+HV_BV_INLINE std::ostream& operator <<(std::ostream &strm, const BitVector &bv) {
 	return strm << bv.toString();
 }
 
-BitVector BitVector::copy() const {
+HV_BV_INLINE BitVector BitVector::copy() const {
 	return BitVector(binSize, *this);
 }
 
-BitVector BitVector::flip() const {
+HV_BV_INLINE BitVector BitVector::flip() const {
 	BitVector ret(binSize, 0u);
 	// Copy is inevitable to keep const qualifier
 	BitVector tmp(*this);
@@ -734,7 +1056,7 @@ BitVector BitVector::flip() const {
 	return ret;
 }
 
-BitVector BitVector::strip() const {
+HV_BV_INLINE BitVector BitVector::strip() const {
 
 	if (this->operator !()) {
 		return BitVector(1u, 0u);
@@ -754,11 +1076,58 @@ BitVector BitVector::strip() const {
 	return BitVector(binSize - nZeros, tmp);
 }
 
-void BitVector::resize(bvsize_t newSize) {
+#ifndef HV_BV_HEADER_ONLY_INCLUSION
+const BitVector::bvsize_t BitVector::npos;
+#endif
+
+HV_BV_INLINE BitVector::bvsize_t BitVector::findNextSet(const bvsize_t &from,
+		const bool &wrap) const {
+	if (from >= binSize) {
+		return wrap ? this->findSetInRange(0u, binSize) : npos;
+	}
+	const bvsize_t ret(this->findSetInRange(from, binSize));
+	if ((ret != npos) || !wrap) {
+		return ret;
+	}
+	return this->findSetInRange(0u, from);
+}
+
+HV_BV_INLINE BitVector::bvsize_t BitVector::priorityEncode() const {
+	return this->findSetInRange(0u, binSize);
+}
+
+HV_BV_INLINE BitVector::bvsize_t BitVector::oneHotEncode() const {
+	const bvsize_t ret(this->findSetInRange(0u, binSize));
+	if ((ret == npos) || (this->findSetInRange(ret + 1u, binSize) != npos)) {
+		return npos;
+	}
+	return ret;
+}
+
+HV_BV_INLINE bool BitVector::isOneHot() const {
+	return this->oneHotEncode() != npos;
+}
+
+HV_BV_INLINE BitVector BitVector::oneHotDecode(const bvsize_t &index,
+		const bvsize_t &width) {
+	BitVector ret(width, 0u);
+	if (index < width) {
+		ret.data[HV_BV_ABS_POS_TO_ARRAY_INDEX(index)] = HV_BIT_MASK_GEN(
+				bvdata_t, HV_BV_ABS_POS_TO_REL_POS(index));
+	}
+	return ret;
+}
+
+HV_BV_INLINE void BitVector::resize(bvsize_t newSize) {
 	if (parent != nullptr) {
 		HV_LOG_ERROR("You can't resize a BitVector which has a parent");
 		HV_EXIT_FAILURE();
 	}
+	if (journaled) {
+		// Cell indexes are changing: the records are not valid anymore
+		BitVectorJournal::forget(*this);
+	}
+	this->unshare();
 	bvsize_t newArraySize = HV_BV_ARRAY_SIZE(newSize);
 	lowIndex = 0u;
 	highIndex = newSize - 1u;
@@ -773,7 +1142,7 @@ void BitVector::resize(bvsize_t newSize) {
 			for (bvsize_t i = 0u; i < newArraySize; i++) {
 				staticData[i] = data[i];
 			}
-			free(data);
+			releaseCells(data);
 			data = staticData;
 		}
 		// Else there is nothing to do
@@ -786,17 +1155,12 @@ void BitVector::resize(bvsize_t newSize) {
 		if (newArraySize > arraySize) {
 			// Memory reallocation could be necessary
 			if (newArraySize > HV_BV_MAX_STATIC_ARRAY_SIZE) {
-				bvdata_t* dataTmp = (bvdata_t*) malloc(
-						newArraySize * sizeof(bvdata_t));
-				if (dataTmp == nullptr) {
-					std::cerr << "Allocation error" << std::endl;
-					exit(EXIT_FAILURE);
-				}
+				bvdata_t* dataTmp = allocateCells(newArraySize);
 				for (bvsize_t i = 0u; i < arraySize; i++) {
 					dataTmp[i] = data[i];
 				}
 				if (arraySize > HV_BV_MAX_STATIC_ARRAY_SIZE) {
-					free(data);
+					releaseCells(data);
 				}
 				data = dataTmp;
 			}
@@ -810,19 +1174,37 @@ void BitVector::resize(bvsize_t newSize) {
 	binSize = newSize;
 }
 
-void BitVector::instantiationChecks(const bvsize_t &size) {
+HV_BV_INLINE void BitVector::instantiationChecks(const bvsize_t &size) {
 	// Checking size and switching to dynamic if needed
 	HV_ASSERT(size > 0, "BitVector size must be > 0");
 	if (size > HV_BV_MAX_STATIC_BITWIDTH) {
-		data = (bvdata_t*) malloc(arraySize * sizeof(bvdata_t));
-		if (data == nullptr) {
-			std::cerr << "Allocation error" << std::endl;
-			exit(EXIT_FAILURE);
-		}
+		data = allocateCells(arraySize);
+	}
+}
+
+HV_BV_INLINE BitVector::bvsize_t& BitVector::shareThreshold() {
+	static bvsize_t threshold(HV_BV_SHARE_DEFAULT_THRESHOLD);
+	return threshold;
+}
+
+HV_BV_INLINE bool BitVector::isShareable() const {
+	return (data != staticData) && shareThreshold()
+			&& (binSize >= shareThreshold());
+}
+
+HV_BV_INLINE void BitVector::detach() {
+	if (bufferOf(data)->refs.load(std::memory_order_acquire) == 1u) {
+		return;
 	}
+	bvdata_t *cells(allocateCells(arraySize));
+	for (bvsize_t i = 0u; i < arraySize; i++) {
+		cells[i] = data[i];
+	}
+	releaseCells(data);
+	data = cells;
 }
 
-void BitVector::updateParent() {
+HV_BV_INLINE void BitVector::updateParent() {
 	if (parent != nullptr) {
 		BitVector bvTmp(parent->binSize, *this);
 		BitVector maskTmp(binSize, 0u);
@@ -835,19 +1217,148 @@ void BitVector::updateParent() {
 	}
 }
 
-BitVector::bvsize_t BitVector::getLastCellSize() const {
+HV_BV_INLINE BitVector::bvsize_t BitVector::getLastCellSize() const {
 	bvsize_t nBitsLastCell(binSize % BITWIDTH_OF(bvdata_t));
 	if (!nBitsLastCell)
 		nBitsLastCell = BITWIDTH_OF(bvdata_t);
 	return nBitsLastCell;
 }
 
-void BitVector::reset() {
+HV_BV_INLINE void BitVector::reset() {
+	this->unshare();
 	for (bvsize_t i = 0u; i < arraySize; i++) {
 		data[i] = static_cast<bvdata_t>(0u);
 	}
 }
 
+HV_BV_INLINE void BitVector::orAt(const BitVector &src, const bvsize_t &offset) {
+	this->unshare();
+	const bvsize_t cell(HV_BV_ABS_POS_TO_ARRAY_INDEX(offset));
+	const bvsize_t shift(HV_BV_ABS_POS_TO_REL_POS(offset));
+	for (bvsize_t i = 0u; i < src.arraySize; i++) {
+		const bvdata_t w(
+				i == src.arraySize - 1u ? src.data[i] & src.maskLastCell :
+						src.data[i]);
+		data[cell + i] |= w << shift;
+		if (shift && (cell + i + 1u < arraySize)) {
+			data[cell + i + 1u] |= w >> (BITWIDTH_OF(bvdata_t) - shift);
+		}
+	}
+}
+
+HV_BV_INLINE hvuint32_t BitVector::concatSize(const BitVector &op) {
+	return static_cast<hvuint32_t>(op.binSize);
+}
+
+HV_BV_INLINE void BitVector::concatDeposit(const bvsize_t &end, const BitVector &op) {
+	this->orAt(op, end - op.binSize);
+}
+
+HV_BV_INLINE BitVector::bvsize_t BitVector::findSetInRange(const bvsize_t &lo,
+		const bvsize_t &hi) const {
+	if (lo >= hi) {
+		return npos;
+	}
+	// Masked ctz over cells: bits below lo, at or above hi (and beyond
+	// binSize) are ignored
+	const bvsize_t first(HV_BV_ABS_POS_TO_ARRAY_INDEX(lo));
+	const bvsize_t last(HV_BV_ABS_POS_TO_ARRAY_INDEX((hi - 1u)));
+	const bvdata_t lastMask(
+			HV_LSB_MASK_GEN(bvdata_t, HV_BV_ABS_POS_TO_REL_POS((hi - 1u)) + 1u));
+	bvdata_t cell(
+			data[first] & HV_MSB_MASK_GEN(bvdata_t, HV_BV_ABS_POS_TO_REL_POS(lo)));
+	for (bvsize_t i = first;; cell = data[++i]) {
+		if (i == last) {
+			cell &= lastMask;
+		}
+		if (cell) {
+			return static_cast<bvsize_t>(i * BITWIDTH_OF(bvdata_t)
+					+ countTrailingZeros(cell));
+		}
+		if (i == last) {
+			return npos;
+		}
+	}
+}
+
+/**
+ * Number of BitVector cells in a 64-bit word
+ */
+#define HV_BV_CELLS_PER_WORD64 (BITWIDTH_OF(hvuint64_t) / BITWIDTH_OF(HV_BV_BASE_TYPE))
+
+HV_BV_INLINE void toWords(const BitVector &src, hvuint64_t *dst,
+		const std::size_t &nWords) {
+	const BitVector::bvdata_t *p(src.getDataAddress());
+	const std::size_t n(src.getArraySize());
+	for (std::size_t i = 0u; i < nWords; i++) {
+		dst[i] = 0u;
+	}
+	for (std::size_t c = 0u; (c < n) && (c / HV_BV_CELLS_PER_WORD64 < nWords);
+			c++) {
+		const BitVector::bvdata_t cell(
+				c + 1u == n ? p[c] & src.getmaskLastCell() : p[c]);
+		dst[c / HV_BV_CELLS_PER_WORD64] |= static_cast<hvuint64_t>(cell)
+				<< (c % HV_BV_CELLS_PER_WORD64 * BITWIDTH_OF(BitVector::bvdata_t));
+	}
+}
+
+HV_BV_INLINE void fromWords(const hvuint64_t *src, const std::size_t &nBits,
+		BitVector &dst) {
+	BitVector::bvdata_t *p(dst.getDataAddress());
+	const std::size_t n(dst.getArraySize());
+	const std::size_t nSrc(
+			nBits ? (nBits - 1u) / BITWIDTH_OF(BitVector::bvdata_t) + 1u : 0u);
+	for (std::size_t c = 0u; c < n; c++) {
+		p[c] = c < nSrc ?
+				static_cast<BitVector::bvdata_t>(src[c / HV_BV_CELLS_PER_WORD64]
+						>> (c % HV_BV_CELLS_PER_WORD64
+								* BITWIDTH_OF(BitVector::bvdata_t))) :
+				static_cast<BitVector::bvdata_t>(0u);
+	}
+	if ((nSrc > 0u) && (nSrc <= n)) {
+		p[nSrc - 1u] &= HV_LSB_MASK_GEN(BitVector::bvdata_t,
+				(nBits - 1u) % BITWIDTH_OF(BitVector::bvdata_t) + 1u);
+	}
+	dst.syncParent();
+}
+
+HV_BV_INLINE void toWords(const BitVector &src, hvuint32_t *dst,
+		const std::size_t &nWords) {
+	const BitVector::bvdata_t *p(src.getDataAddress());
+	const std::size_t n(src.getArraySize());
+	const std::size_t nCopy(n < nWords ? n : nWords);
+	for (std::size_t c = 0u; c < nCopy; c++) {
+		dst[c] = p[c];
+	}
+	if (nCopy == n) {
+		dst[n - 1u] &= src.getmaskLastCell();
+	}
+	for (std::size_t c = nCopy; c < nWords; c++) {
+		dst[c] = 0u;
+	}
+}
+
+HV_BV_INLINE void fromWords(const hvuint32_t *src, const std::size_t &nBits,
+		BitVector &dst) {
+	BitVector::bvdata_t *p(dst.getDataAddress());
+	const std::size_t n(dst.getArraySize());
+	const std::size_t nSrc(
+			nBits ? (nBits - 1u) / BITWIDTH_OF(BitVector::bvdata_t) + 1u : 0u);
+	const std::size_t nCopy(nSrc < n ? nSrc : n);
+	for (std::size_t c = 0u; c < nCopy; c++) {
+		p[c] = src[c];
+	}
+	if ((nSrc > 0u) && (nSrc <= n)) {
+		p[nSrc - 1u] &= HV_LSB_MASK_GEN(BitVector::bvdata_t,
+				(nBits - 1u) % BITWIDTH_OF(BitVector::bvdata_t) + 1u);
+	}
+	for (std::size_t c = nCopy; c < n; c++) {
+		p[c] = static_cast<BitVector::bvdata_t>(0u);
+	}
+	dst.syncParent();
+}
+
 } // namespace common
 } // namespace hv
 
+#endif // HV_BITVECTOR_CPP
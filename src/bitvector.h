@@ -13,11 +13,13 @@
 #include <cstdlib>
 #include <iostream>
 #include <string>
+#include <vector>
 #include <algorithm>
 #include <ctime>
 #include <cci_configuration>
 #include "datatypes.h"
 #include "hvutils.h"
+#include "random.h"
 
 /**
  * BitVector base type for binary number representation
@@ -52,9 +54,15 @@
  * The given type must be able to handle unsigned numbers of at least
  * HV_BV_MAX_BITWIDTH bits (128 by default)
  *
- * Default: hvuint8_t (can handle up to 256 bits)
+ * Default: hvuint16_t (can handle up to 65535 bits). The CMake option
+ * HV_BV_WIDE_SIZE defines it as hvuint32_t for the library and its users,
+ * for larger vectors such as memory bitmaps. bvsize_t is part of the
+ * BitVector layout: the macro must be the same for the library and its
+ * users.
  */
+#ifndef HV_BV_SIZE_TYPE
 #define HV_BV_SIZE_TYPE hvuint16_t
+#endif
 
 /**
  * BitVector's array size resolution for a w-bit BitVector
@@ -91,6 +99,30 @@
 #define HV_BV_STR_MSB_FIRST
 #endif
 
+/**
+ * Header-only mode
+ *
+ * If HV_BV_HEADER_ONLY is defined (CMake option HV_BV_HEADER_ONLY), the
+ * BitVector implementation is included at the end of this header as inline
+ * definitions, so that small operations can be inlined into models without
+ * link-time optimization. The library is still needed for the other modules.
+ * The macro must be the same for the library and its users.
+ */
+#ifdef HV_BV_HEADER_ONLY
+#define HV_BV_INLINE inline
+#else
+#define HV_BV_INLINE
+#endif
+
+/**
+ * Default minimum size in bits of BitVectors sharing their storage on copy
+ *
+ * 0 disables sharing (see BitVector::setShareThreshold()).
+ */
+#ifndef HV_BV_SHARE_DEFAULT_THRESHOLD
+#define HV_BV_SHARE_DEFAULT_THRESHOLD 0u
+#endif
+
 namespace hv {
 namespace common {
 
@@ -102,6 +134,15 @@ public:
 	typedef HV_BV_SIZE_TYPE bvsize_t;
 	typedef HV_BV_BASE_TYPE bvdata_t;
 
+	/**
+	 * Widest integer operand of the scalar operators
+	 */
+#ifdef HV_HAS_INT128
+	typedef hvuint128_t bvscalar_t;
+#else
+	typedef hvuint64_t bvscalar_t;
+#endif
+
 	//** Constructors **//
 
 	/**
@@ -218,6 +259,32 @@ public:
 			BitVector *parentPtr = nullptr, const bvsize_t &lowIndexSelect = 0,
 			const bvsize_t &highIndexSelect = 0);
 
+#ifdef HV_HAS_INT128
+	/**
+	 * Constructor from hvuint128_t value
+	 * @param size Binary vector size
+	 * @param value Initial value (default: 0)
+	 * @param parentPtr Direct parent address (default: nullptr)
+	 * @param lowIndexSelect Inferior index of sub-vector (default: 0)
+	 * @param highIndexSelect Superior index of sub-vector (default: size-1)
+	 */
+	BitVector(const bvsize_t &size, const hvuint128_t &value,
+			BitVector *parentPtr = nullptr, const bvsize_t &lowIndexSelect = 0,
+			const bvsize_t &highIndexSelect = 0);
+
+	/**
+	 * Constructor from hvint128_t value
+	 * @param size Binary vector size
+	 * @param value Initial value (default: 0)
+	 * @param parentPtr Direct parent address (default: nullptr)
+	 * @param lowIndexSelect Inferior index of sub-vector (default: 0)
+	 * @param highIndexSelect Superior index of sub-vector (default: size-1)
+	 */
+	BitVector(const bvsize_t &size, const hvint128_t &value,
+			BitVector *parentPtr = nullptr, const bvsize_t &lowIndexSelect = 0,
+			const bvsize_t &highIndexSelect = 0);
+#endif
+
 	/**
 	 * Constructor from std::string value
 	 *
@@ -300,6 +367,20 @@ public:
 	 */
 	BitVector(const hvint64_t &value);
 
+#ifdef HV_HAS_INT128
+	/**
+	 * Constructor from hvuint128_t
+	 * @param value Assignment value
+	 */
+	BitVector(const hvuint128_t &value);
+
+	/**
+	 * Constructor from hvint128_t
+	 * @param value Assignment value
+	 */
+	BitVector(const hvint128_t &value);
+#endif
+
 	/**
 	 * Constructor from std::string
 	 * @param value Assignment value
@@ -309,7 +390,8 @@ public:
 	/**
 	 * Copy constructor
 	 *
-	 * Be careful : everything is copied, including parent!
+	 * Be careful : everything is copied, including parent! The copy is not
+	 * journaled.
 	 * To copy only value, use the multi-arguments constructor
 	 * @param src Copy source
 	 */
@@ -348,6 +430,12 @@ public:
 	 */
 	BitVector* getParentAddress() const;
 
+	/**
+	 * Propagate direct writes through getDataAddress() to the parent
+	 * BitVector, if any
+	 */
+	void syncParent();
+
 	/**
 	 * Get low index of represented (sub-)BitVector
 	 * @return Low index
@@ -362,10 +450,58 @@ public:
 
 	/**
 	 * Get data address
+	 *
+	 * Shared storage is copied first, since the cells may be written
+	 * through the returned address.
 	 * @return Data address
 	 */
 	bvdata_t* getDataAddress();
 
+	/**
+	 * Get data address - const version
+	 *
+	 * Bits of the last cell beyond the BitVector size are not guaranteed
+	 * to be 0: apply getmaskLastCell() before using it.
+	 * @return Data address
+	 */
+	const bvdata_t* getDataAddress() const;
+
+	/**
+	 * Enable or disable write journaling (see BitVectorJournal)
+	 * @param enable true to journal writes to this BitVector
+	 */
+	void setJournaled(const bool &enable);
+
+	/**
+	 * Check whether writes are journaled
+	 * @return true if writes are journaled
+	 */
+	bool isJournaled() const;
+
+	/**
+	 * Set the minimum size of BitVectors sharing their storage on copy
+	 *
+	 * Copies of BitVectors of at least this size (and of more than
+	 * HV_BV_MAX_STATIC_BITWIDTH bits) share a reference-counted cell array
+	 * with their source until one of them is written, so that snapshots of
+	 * wide registers are made in constant time. 0 disables sharing. The
+	 * setting is global and only affects copies made after the call.
+	 * @param bitwidth Minimum size in bits
+	 */
+	static void setShareThreshold(const bvsize_t &bitwidth);
+
+	/**
+	 * Get the minimum size of BitVectors sharing their storage on copy
+	 * @return Minimum size in bits (0 if sharing is disabled)
+	 */
+	static bvsize_t getShareThreshold();
+
+	/**
+	 * Check whether storage is shared with other BitVectors
+	 * @return true if the cell array is shared
+	 */
+	bool isShared() const;
+
 	//** Casts **//
 	/**
 	 * Cast to bool
@@ -412,6 +548,18 @@ public:
 	 */
 	operator hvint64_t() const;
 
+#ifdef HV_HAS_INT128
+	/**
+	 * Cast to hvuint128_t
+	 */
+	operator hvuint128_t() const;
+
+	/**
+	 * Cast to hvint128_t
+	 */
+	operator hvint128_t() const;
+#endif
+
 	/**
 	 * Cast to std::string
 	 */
@@ -483,6 +631,22 @@ public:
 	 */
 	BitVector& operator =(const hvint64_t &src);
 
+#ifdef HV_HAS_INT128
+	/**
+	 * Assignment from hvuint128_t
+	 * @param src Source for assignment
+	 * @return Reference to this
+	 */
+	BitVector& operator =(const hvuint128_t &src);
+
+	/**
+	 * Assignment from hvint128_t
+	 * @param src Source for assignment
+	 * @return Reference to this
+	 */
+	BitVector& operator =(const hvint128_t &src);
+#endif
+
 	/**
 	 * Assignment from std::string
 	 *
@@ -648,6 +812,61 @@ public:
 	 */
 	BitVector& operator ^=(const BitVector &op2);
 
+	// Scalar operations
+	// Fast paths of the integer operators defined below the class: the
+	// operand is applied to the first cells (up to 128 bits), the other
+	// cells being treated as zero, without BitVector construction.
+	/**
+	 * Equal comparison with a zero-extended unsigned value
+	 * @param value Right-hand operand
+	 * @return True if equal, false else
+	 */
+	bool isEqualScalar(const bvscalar_t &value) const;
+
+	/**
+	 * Binary AND with a zero-extended unsigned value
+	 * @param value Right-hand operand
+	 * @return Binary AND result, same size as this
+	 */
+	BitVector andScalar(const bvscalar_t &value) const;
+
+	/**
+	 * Binary OR with a zero-extended unsigned value
+	 * @param value Right-hand operand
+	 * @param width Right-hand operand size
+	 * @return Binary OR result, size of the largest operand
+	 */
+	BitVector orScalar(const bvscalar_t &value, const bvsize_t &width) const;
+
+	/**
+	 * Binary XOR with a zero-extended unsigned value
+	 * @param value Right-hand operand
+	 * @param width Right-hand operand size
+	 * @return Binary XOR result, size of the largest operand
+	 */
+	BitVector xorScalar(const bvscalar_t &value, const bvsize_t &width) const;
+
+	/**
+	 * Binary AND with a zero-extended unsigned value and assignment
+	 * @param value Right-hand operand
+	 * @return Reference to this
+	 */
+	BitVector& andEqualScalar(const bvscalar_t &value);
+
+	/**
+	 * Binary OR with a zero-extended unsigned value and assignment
+	 * @param value Right-hand operand
+	 * @return Reference to this
+	 */
+	BitVector& orEqualScalar(const bvscalar_t &value);
+
+	/**
+	 * Binary XOR with a zero-extended unsigned value and assignment
+	 * @param value Right-hand operand
+	 * @return Reference to this
+	 */
+	BitVector& xorEqualScalar(const bvscalar_t &value);
+
 	// Concatenation
 	/**
 	 * Concatenation operator
@@ -659,6 +878,20 @@ public:
 	 */
 	BitVector operator +(const BitVector &op2) const;
 
+	/**
+	 * N-ary concatenation
+	 *
+	 * concat(a, b, c) is equivalent to a + b + c, but the result is sized
+	 * once and each operand is deposited at its final offset, with no
+	 * intermediate BitVector. First operand is set to MSB side, last
+	 * operand to LSB side.
+	 * @param op1 First operand (MSB side)
+	 * @param ops Other operands
+	 * @return Concatenated BitVector
+	 */
+	template<typename ... Ts> static BitVector concat(const BitVector &op1,
+			const Ts &... ops);
+
 	// Vector and bit selection
 	/**
 	 * Vector selection
@@ -711,10 +944,19 @@ public:
 	/**
 	 * Applies a random value to BitVector
 	 *
-	 * All bits are set whether to 0 or 1 with a 0.5 probability
+	 * All bits are set whether to 0 or 1 with a 0.5 probability.
+	 * Numbers are drawn from the calling thread's RandomEngine.
 	 */
 	void rand();
 
+	/**
+	 * Applies a random value to BitVector from a given engine
+	 *
+	 * All bits are set whether to 0 or 1 with a 0.5 probability
+	 * @param engine Random engine
+	 */
+	void rand(RandomEngine &engine);
+
 	// String manipulation
 	/**
 	 * Assignment from string
@@ -771,6 +1013,49 @@ public:
 	 */
 	BitVector strip() const;
 
+	// Bit search
+	/**
+	 * Index returned by bit search functions when no bit is found
+	 */
+	static const bvsize_t npos = static_cast<bvsize_t>(~0u);
+
+	/**
+	 * Finds the first bit set at or after a given position
+	 * E.g. for round-robin arbitration, findNextSet(last + 1, true) returns
+	 * the next requester after the last granted one.
+	 * @param from Start position
+	 * @param wrap If true, search continues from bit 0 up to from - 1
+	 * @return Index of the bit found, npos if none
+	 */
+	bvsize_t findNextSet(const bvsize_t &from, const bool &wrap = false) const;
+
+	/**
+	 * Priority encoder (bit 0 has the highest priority)
+	 * @return Index of the lowest bit set, npos if BitVector is 0
+	 */
+	bvsize_t priorityEncode() const;
+
+	/**
+	 * One-hot encoder
+	 * @return Index of the only bit set, npos if BitVector is not one-hot
+	 */
+	bvsize_t oneHotEncode() const;
+
+	/**
+	 * Checks whether exactly one bit is set
+	 * @return True if BitVector is one-hot
+	 */
+	bool isOneHot() const;
+
+	/**
+	 * One-hot decoder
+	 * @param index Index of the bit to set
+	 * @param width BitVector size
+	 * @return BitVector of given size with only bit index set (0 if index
+	 * is out of range)
+	 */
+	static BitVector oneHotDecode(const bvsize_t &index, const bvsize_t &width);
+
 //** BitVector resizing **//
 	/**
 	 * Resizes BitVector to a given size.
@@ -819,6 +1104,78 @@ protected:
 	template<typename T> T _getData(dataHandleHelper<T, true>) const;
 	template<typename T> T _getData(dataHandleHelper<T, false>) const;
 
+	/**
+	 * Copy of the cells, zero-extended or truncated, with a scalar operand
+	 * applied to the first cells by OR or XOR
+	 */
+	BitVector scalarOp(const bvscalar_t &value, const bvsize_t &width,
+			const bool &isXor) const;
+
+	/**
+	 * Cell of a zero-extended scalar operand
+	 * @param value Scalar operand
+	 * @param i Cell index
+	 * @return Cell value
+	 */
+	static bvdata_t scalarCell(const bvscalar_t &value, const bvsize_t &i);
+
+	/**
+	 * Journal the cells which an assignment from src changes
+	 * @param src Assignment source
+	 */
+	void journalAssignment(const BitVector &src);
+
+	/**
+	 * Storage sharing threshold (see setShareThreshold())
+	 */
+	static bvsize_t& shareThreshold();
+
+	/**
+	 * Check whether copies of this BitVector share its storage
+	 */
+	bool isShareable() const;
+
+	/**
+	 * Copy the cells of src, zero-extended or truncated, without sharing
+	 * them
+	 */
+	void assign(const BitVector &src);
+
+	/**
+	 * Take private ownership of the cells before a write
+	 */
+	void unshare();
+
+	/**
+	 * Copy shared cells into a private array
+	 */
+	void detach();
+
+	/**
+	 * Header of dynamically allocated cell arrays
+	 */
+	struct Buffer;
+
+	/**
+	 * Get the header of a dynamically allocated cell array
+	 * @param cells Cell array
+	 * @return Array header
+	 */
+	static Buffer* bufferOf(const bvdata_t *cells);
+
+	/**
+	 * Allocate a cell array with one reference
+	 * @param n Number of cells
+	 * @return Cell array
+	 */
+	static bvdata_t* allocateCells(const bvsize_t &n);
+
+	/**
+	 * Drop a reference to a cell array, freeing it with the last one
+	 * @param cells Cell array
+	 */
+	static void releaseCells(bvdata_t *cells);
+
 	/**
 	 * Get the number of bits of last cell in data array
 	 * @return The number of bits of last cell in data array
@@ -830,6 +1187,29 @@ protected:
 	 */
 	void reset();
 
+	/**
+	 * Bitwise OR of a BitVector at a given offset, word by word
+	 *
+	 * Used to deposit operands into a zeroed BitVector. src must fit:
+	 * offset + src size <= size.
+	 * @param src Source BitVector
+	 * @param offset Bit offset of src LSB
+	 */
+	void orAt(const BitVector &src, const bvsize_t &offset);
+
+	// Helpers for concat(...)
+	static hvuint32_t concatSize(const BitVector &op);
+	template<typename ... Ts> static hvuint32_t concatSize(
+			const BitVector &op, const Ts &... ops);
+	void concatDeposit(const bvsize_t &end, const BitVector &op);
+
+	/**
+	 * Finds the first bit set in [lo, hi)
+	 */
+	bvsize_t findSetInRange(const bvsize_t &lo, const bvsize_t &hi) const;
+	template<typename ... Ts> void concatDeposit(const bvsize_t &end,
+			const BitVector &op, const Ts &... ops);
+
 	/**
 	 * Parent BitVector for sub-vectors
 	 *
@@ -839,6 +1219,8 @@ protected:
 
 	/**
 	 * Data address
+	 *
+	 * Dynamically allocated arrays are preceded by their reference count.
 	 */
 	bvdata_t* data;
 
@@ -862,10 +1244,95 @@ protected:
 	 * Mask for last array cell
 	 */
 	bvdata_t maskLastCell;
+
+	/**
+	 * Writes are recorded in the thread's BitVectorJournal
+	 */
+	bool journaled;
 };
 
+//** BitVector to/from 64-bit words **//
+/**
+ * Copy a BitVector to 64-bit words
+ * Bits beyond the BitVector size are set to 0.
+ * @param src Source BitVector
+ * @param dst Destination words, least significant first
+ * @param nWords Number of destination words
+ */
+void toWords(const BitVector &src, hvuint64_t *dst, const std::size_t &nWords);
+
+/**
+ * Copy 64-bit words to a BitVector
+ * Destination size is kept: source is truncated or extended with 0s.
+ * @param src Source words, least significant first
+ * @param nBits Number of valid bits in source words
+ * @param dst Destination BitVector
+ */
+void fromWords(const hvuint64_t *src, const std::size_t &nBits,
+		BitVector &dst);
+
+//** BitVector to/from 32-bit words **//
+/**
+ * Copy a BitVector to 32-bit words (one word per cell)
+ * Bits beyond the BitVector size are set to 0.
+ * @param src Source BitVector
+ * @param dst Destination words, least significant first
+ * @param nWords Number of destination words
+ */
+void toWords(const BitVector &src, hvuint32_t *dst, const std::size_t &nWords);
+
+/**
+ * Copy 32-bit words to a BitVector (one word per cell)
+ * Destination size is kept: source is truncated or extended with 0s.
+ * Source words may be the destination cells themselves.
+ * @param src Source words, least significant first
+ * @param nBits Number of valid bits in source words
+ * @param dst Destination BitVector
+ */
+void fromWords(const hvuint32_t *src, const std::size_t &nBits,
+		BitVector &dst);
+
 // Template methods definitions
+template<typename ... Ts> BitVector BitVector::concat(const BitVector &op1,
+		const Ts &... ops) {
+	const hvuint32_t size(concatSize(op1, ops...));
+	HV_ASSERT(size <= static_cast<bvsize_t>(~0u),
+			"Concatenation size {} exceeds BitVector maximum size", size);
+	BitVector ret(static_cast<bvsize_t>(size), false);
+	ret.concatDeposit(ret.binSize, op1, ops...);
+	return ret;
+}
+
+template<typename ... Ts> hvuint32_t BitVector::concatSize(
+		const BitVector &op, const Ts &... ops) {
+	return static_cast<hvuint32_t>(op.binSize) + concatSize(ops...);
+}
+
+template<typename ... Ts> void BitVector::concatDeposit(const bvsize_t &end,
+		const BitVector &op, const Ts &... ops) {
+	const bvsize_t offset(end - op.binSize);
+	this->orAt(op, offset);
+	this->concatDeposit(offset, ops...);
+}
+
+inline void BitVector::unshare() {
+	// Static arrays are never shared
+	if (data != staticData) {
+		this->detach();
+	}
+}
+
+inline BitVector::bvdata_t* BitVector::getDataAddress() {
+	this->unshare();
+	return this->data;
+}
+
+inline const BitVector::bvdata_t* BitVector::getDataAddress() const {
+	return this->data;
+}
+
 template<typename T> void BitVector::setData(const T &src) {
+	this->unshare();
 	this->_setData(dataHandleHelper<T, sizeof(T) <= sizeof(bvdata_t)>(), src);
 }
 
@@ -892,11 +1359,11 @@ template<typename T> void BitVector::_setData(dataHandleHelper<T, false>,
 	const bvsize_t HOW_BIGGER = sizeof(T) / sizeof(bvdata_t);
 	T srcTmp(src);
 	bvsize_t cpt;
-	for (cpt = 0; cpt < HOW_BIGGER; cpt++) {
+	for (cpt = 0; (cpt < HOW_BIGGER) && (cpt < arraySize); cpt++) {
 		data[cpt] = static_cast<bvdata_t>(srcTmp);
 		srcTmp >>= BITWIDTH_OF(bvdata_t);
 	}
-	for (bvsize_t i = HOW_BIGGER; i < arraySize; i++) {
+	for (bvsize_t i = cpt; i < arraySize; i++) {
 		data[i] = 0;
 	}
 }
@@ -933,8 +1400,42 @@ template<typename T> T BitVector::_getData(dataHandleHelper<T, false>) const {
 	return ret;
 }
 
+/**
+ * N-ary concatenation (see BitVector::concat)
+ * @param op1 First operand (MSB side)
+ * @param ops Other operands
+ * @return Concatenated BitVector
+ */
+template<typename ... Ts> inline BitVector concat(const BitVector &op1,
+		const Ts &... ops) {
+	return BitVector::concat(op1, ops...);
+}
+
 // Interoperability
 
+/**
+ * Integer operands: size and value of the BitVector they would be converted
+ * to, used by the scalar fast paths
+ */
+template<typename T> struct bv_scalar {
+	static BitVector::bvsize_t width() {
+		return static_cast<BitVector::bvsize_t>(BITWIDTH_OF(T));
+	}
+	static BitVector::bvscalar_t bits(const T &value) {
+		return static_cast<BitVector::bvscalar_t>(value)
+				& HV_LSB_MASK_GEN(BitVector::bvscalar_t, BITWIDTH_OF(T));
+	}
+};
+
+template<> struct bv_scalar<bool> {
+	static BitVector::bvsize_t width() {
+		return static_cast<BitVector::bvsize_t>(1u);
+	}
+	static BitVector::bvscalar_t bits(const bool &value) {
+		return value ? 1u : 0u;
+	}
+};
+
 // OPERATOR ==
 template<typename T> inline bool bv_operator_isequal1(const BitVector &a,
 		const T &b) {
@@ -948,15 +1449,26 @@ template<typename T> inline bool bv_operator_isequal2(const T &a,
 
 #define BV_OP_ISEQUAL(T) inline bool operator == (const BitVector &a, const T &b) {return bv_operator_isequal1(a, b);} \
 inline bool operator == (const T &a, const BitVector &b) {return bv_operator_isequal2(a, b);}
-BV_OP_ISEQUAL(bool)
-BV_OP_ISEQUAL(hvuint8_t)
-BV_OP_ISEQUAL(hvuint16_t)
-BV_OP_ISEQUAL(hvuint32_t)
-BV_OP_ISEQUAL(hvuint64_t)
-BV_OP_ISEQUAL(hvint8_t)
-BV_OP_ISEQUAL(hvint16_t)
-BV_OP_ISEQUAL(hvint32_t)
-BV_OP_ISEQUAL(hvint64_t)
+template<typename T> inline bool bv_operator_isequal_scalar(
+		const BitVector &a, const T &b) {
+	return a.isEqualScalar(bv_scalar<T>::bits(b));
+}
+
+#define BV_OP_ISEQUAL_SCALAR(T) inline bool operator == (const BitVector &a, const T &b) {return bv_operator_isequal_scalar(a, b);} \
+inline bool operator == (const T &a, const BitVector &b) {return bv_operator_isequal_scalar(b, a);}
+BV_OP_ISEQUAL_SCALAR(bool)
+BV_OP_ISEQUAL_SCALAR(hvuint8_t)
+BV_OP_ISEQUAL_SCALAR(hvuint16_t)
+BV_OP_ISEQUAL_SCALAR(hvuint32_t)
+BV_OP_ISEQUAL_SCALAR(hvuint64_t)
+BV_OP_ISEQUAL_SCALAR(hvint8_t)
+BV_OP_ISEQUAL_SCALAR(hvint16_t)
+BV_OP_ISEQUAL_SCALAR(hvint32_t)
+BV_OP_ISEQUAL_SCALAR(hvint64_t)
+#ifdef HV_HAS_INT128
+BV_OP_ISEQUAL_SCALAR(hvuint128_t)
+BV_OP_ISEQUAL_SCALAR(hvint128_t)
+#endif
 BV_OP_ISEQUAL(std::string)
 
 // OPERATOR !=
@@ -972,15 +1484,26 @@ template<typename T> inline bool bv_operator_isdifferent2(const T &a,
 
 #define BV_OP_ISDIFFERENT(T) inline bool operator != (const BitVector &a, const T &b) {return bv_operator_isdifferent1(a, b);} \
 inline bool operator != (const T &a, const BitVector &b) {return bv_operator_isdifferent2(a, b);}
-BV_OP_ISDIFFERENT(bool)
-BV_OP_ISDIFFERENT(hvuint8_t)
-BV_OP_ISDIFFERENT(hvuint16_t)
-BV_OP_ISDIFFERENT(hvuint32_t)
-BV_OP_ISDIFFERENT(hvuint64_t)
-BV_OP_ISDIFFERENT(hvint8_t)
-BV_OP_ISDIFFERENT(hvint16_t)
-BV_OP_ISDIFFERENT(hvint32_t)
-BV_OP_ISDIFFERENT(hvint64_t)
+template<typename T> inline bool bv_operator_isdifferent_scalar(
+		const BitVector &a, const T &b) {
+	return !a.isEqualScalar(bv_scalar<T>::bits(b));
+}
+
+#define BV_OP_ISDIFFERENT_SCALAR(T) inline bool operator != (const BitVector &a, const T &b) {return bv_operator_isdifferent_scalar(a, b);} \
+inline bool operator != (const T &a, const BitVector &b) {return bv_operator_isdifferent_scalar(b, a);}
+BV_OP_ISDIFFERENT_SCALAR(bool)
+BV_OP_ISDIFFERENT_SCALAR(hvuint8_t)
+BV_OP_ISDIFFERENT_SCALAR(hvuint16_t)
+BV_OP_ISDIFFERENT_SCALAR(hvuint32_t)
+BV_OP_ISDIFFERENT_SCALAR(hvuint64_t)
+BV_OP_ISDIFFERENT_SCALAR(hvint8_t)
+BV_OP_ISDIFFERENT_SCALAR(hvint16_t)
+BV_OP_ISDIFFERENT_SCALAR(hvint32_t)
+BV_OP_ISDIFFERENT_SCALAR(hvint64_t)
+#ifdef HV_HAS_INT128
+BV_OP_ISDIFFERENT_SCALAR(hvuint128_t)
+BV_OP_ISDIFFERENT_SCALAR(hvint128_t)
+#endif
 BV_OP_ISDIFFERENT(std::string)
 
 // OPERATOR &&
@@ -996,15 +1519,26 @@ template<typename T> inline bool bv_operator_booland2(const T &a,
 
 #define BV_OP_BOOLAND(T) inline bool operator && (const BitVector &a, const T &b) {return bv_operator_booland1(a, b);} \
 inline bool operator && (const T &a, const BitVector &b) {return bv_operator_booland2(a, b);}
-BV_OP_BOOLAND(bool)
-BV_OP_BOOLAND(hvuint8_t)
-BV_OP_BOOLAND(hvuint16_t)
-BV_OP_BOOLAND(hvuint32_t)
-BV_OP_BOOLAND(hvuint64_t)
-BV_OP_BOOLAND(hvint8_t)
-BV_OP_BOOLAND(hvint16_t)
-BV_OP_BOOLAND(hvint32_t)
-BV_OP_BOOLAND(hvint64_t)
+template<typename T> inline bool bv_operator_booland_scalar(
+		const BitVector &a, const T &b) {
+	return !(!a) && (bv_scalar<T>::bits(b) != 0u);
+}
+
+#define BV_OP_BOOLAND_SCALAR(T) inline bool operator && (const BitVector &a, const T &b) {return bv_operator_booland_scalar(a, b);} \
+inline bool operator && (const T &a, const BitVector &b) {return bv_operator_booland_scalar(b, a);}
+BV_OP_BOOLAND_SCALAR(bool)
+BV_OP_BOOLAND_SCALAR(hvuint8_t)
+BV_OP_BOOLAND_SCALAR(hvuint16_t)
+BV_OP_BOOLAND_SCALAR(hvuint32_t)
+BV_OP_BOOLAND_SCALAR(hvuint64_t)
+BV_OP_BOOLAND_SCALAR(hvint8_t)
+BV_OP_BOOLAND_SCALAR(hvint16_t)
+BV_OP_BOOLAND_SCALAR(hvint32_t)
+BV_OP_BOOLAND_SCALAR(hvint64_t)
+#ifdef HV_HAS_INT128
+BV_OP_BOOLAND_SCALAR(hvuint128_t)
+BV_OP_BOOLAND_SCALAR(hvint128_t)
+#endif
 BV_OP_BOOLAND(std::string)
 
 // OPERATOR ||
@@ -1020,15 +1554,26 @@ template<typename T> inline bool bv_operator_boolor2(const T &a,
 
 #define BV_OP_BOOLOR(T) inline bool operator || (const BitVector &a, const T &b) {return bv_operator_boolor1(a, b);} \
 inline bool operator || (const T &a, const BitVector &b) {return bv_operator_boolor2(a, b);}
-BV_OP_BOOLOR(bool)
-BV_OP_BOOLOR(hvuint8_t)
-BV_OP_BOOLOR(hvuint16_t)
-BV_OP_BOOLOR(hvuint32_t)
-BV_OP_BOOLOR(hvuint64_t)
-BV_OP_BOOLOR(hvint8_t)
-BV_OP_BOOLOR(hvint16_t)
-BV_OP_BOOLOR(hvint32_t)
-BV_OP_BOOLOR(hvint64_t)
+template<typename T> inline bool bv_operator_boolor_scalar(
+		const BitVector &a, const T &b) {
+	return (bv_scalar<T>::bits(b) != 0u) || !(!a);
+}
+
+#define BV_OP_BOOLOR_SCALAR(T) inline bool operator || (const BitVector &a, const T &b) {return bv_operator_boolor_scalar(a, b);} \
+inline bool operator || (const T &a, const BitVector &b) {return bv_operator_boolor_scalar(b, a);}
+BV_OP_BOOLOR_SCALAR(bool)
+BV_OP_BOOLOR_SCALAR(hvuint8_t)
+BV_OP_BOOLOR_SCALAR(hvuint16_t)
+BV_OP_BOOLOR_SCALAR(hvuint32_t)
+BV_OP_BOOLOR_SCALAR(hvuint64_t)
+BV_OP_BOOLOR_SCALAR(hvint8_t)
+BV_OP_BOOLOR_SCALAR(hvint16_t)
+BV_OP_BOOLOR_SCALAR(hvint32_t)
+BV_OP_BOOLOR_SCALAR(hvint64_t)
+#ifdef HV_HAS_INT128
+BV_OP_BOOLOR_SCALAR(hvuint128_t)
+BV_OP_BOOLOR_SCALAR(hvint128_t)
+#endif
 BV_OP_BOOLOR(std::string)
 
 // OPERATOR &
@@ -1044,15 +1589,26 @@ template<typename T> inline BitVector bv_operator_bitwiseand2(const T &a,
 
 #define BV_OP_BITWISEAND(T) inline BitVector operator & (const BitVector &a, const T &b) {return bv_operator_bitwiseand1(a, b);} \
 inline BitVector operator & (const T &a, const BitVector &b) {return bv_operator_bitwiseand2(a, b);}
-BV_OP_BITWISEAND(bool)
-BV_OP_BITWISEAND(hvuint8_t)
-BV_OP_BITWISEAND(hvuint16_t)
-BV_OP_BITWISEAND(hvuint32_t)
-BV_OP_BITWISEAND(hvuint64_t)
-BV_OP_BITWISEAND(hvint8_t)
-BV_OP_BITWISEAND(hvint16_t)
-BV_OP_BITWISEAND(hvint32_t)
-BV_OP_BITWISEAND(hvint64_t)
+template<typename T> inline BitVector bv_operator_bitwiseand_scalar(
+		const BitVector &a, const T &b) {
+	return a.andScalar(bv_scalar<T>::bits(b));
+}
+
+#define BV_OP_BITWISEAND_SCALAR(T) inline BitVector operator & (const BitVector &a, const T &b) {return bv_operator_bitwiseand_scalar(a, b);} \
+inline BitVector operator & (const T &a, const BitVector &b) {return bv_operator_bitwiseand_scalar(b, a);}
+BV_OP_BITWISEAND_SCALAR(bool)
+BV_OP_BITWISEAND_SCALAR(hvuint8_t)
+BV_OP_BITWISEAND_SCALAR(hvuint16_t)
+BV_OP_BITWISEAND_SCALAR(hvuint32_t)
+BV_OP_BITWISEAND_SCALAR(hvuint64_t)
+BV_OP_BITWISEAND_SCALAR(hvint8_t)
+BV_OP_BITWISEAND_SCALAR(hvint16_t)
+BV_OP_BITWISEAND_SCALAR(hvint32_t)
+BV_OP_BITWISEAND_SCALAR(hvint64_t)
+#ifdef HV_HAS_INT128
+BV_OP_BITWISEAND_SCALAR(hvuint128_t)
+BV_OP_BITWISEAND_SCALAR(hvint128_t)
+#endif
 BV_OP_BITWISEAND(std::string)
 
 // OPERATOR |
@@ -1068,15 +1624,26 @@ template<typename T> inline BitVector bv_operator_bitwiseor2(const T &a,
 
 #define BV_OP_BITWISEOR(T) inline BitVector operator | (const BitVector &a, const T &b) {return bv_operator_bitwiseor1(a, b);} \
 inline BitVector operator | (const T &a, const BitVector &b) {return bv_operator_bitwiseor2(a, b);}
-BV_OP_BITWISEOR(bool)
-BV_OP_BITWISEOR(hvuint8_t)
-BV_OP_BITWISEOR(hvuint16_t)
-BV_OP_BITWISEOR(hvuint32_t)
-BV_OP_BITWISEOR(hvuint64_t)
-BV_OP_BITWISEOR(hvint8_t)
-BV_OP_BITWISEOR(hvint16_t)
-BV_OP_BITWISEOR(hvint32_t)
-BV_OP_BITWISEOR(hvint64_t)
+template<typename T> inline BitVector bv_operator_bitwiseor_scalar(
+		const BitVector &a, const T &b) {
+	return a.orScalar(bv_scalar<T>::bits(b), bv_scalar<T>::width());
+}
+
+#define BV_OP_BITWISEOR_SCALAR(T) inline BitVector operator | (const BitVector &a, const T &b) {return bv_operator_bitwiseor_scalar(a, b);} \
+inline BitVector operator | (const T &a, const BitVector &b) {return bv_operator_bitwiseor_scalar(b, a);}
+BV_OP_BITWISEOR_SCALAR(bool)
+BV_OP_BITWISEOR_SCALAR(hvuint8_t)
+BV_OP_BITWISEOR_SCALAR(hvuint16_t)
+BV_OP_BITWISEOR_SCALAR(hvuint32_t)
+BV_OP_BITWISEOR_SCALAR(hvuint64_t)
+BV_OP_BITWISEOR_SCALAR(hvint8_t)
+BV_OP_BITWISEOR_SCALAR(hvint16_t)
+BV_OP_BITWISEOR_SCALAR(hvint32_t)
+BV_OP_BITWISEOR_SCALAR(hvint64_t)
+#ifdef HV_HAS_INT128
+BV_OP_BITWISEOR_SCALAR(hvuint128_t)
+BV_OP_BITWISEOR_SCALAR(hvint128_t)
+#endif
 BV_OP_BITWISEOR(std::string)
 
 // OPERATOR ^
@@ -1092,15 +1659,26 @@ template<typename T> inline BitVector bv_operator_bitwisexor2(const T &a,
 
 #define BV_OP_BITWISEXOR(T) inline BitVector operator ^ (const BitVector &a, const T &b) {return bv_operator_bitwisexor1(a, b);} \
 inline BitVector operator ^ (const T &a, const BitVector &b) {return bv_operator_bitwisexor2(a, b);}
-BV_OP_BITWISEXOR(bool)
-BV_OP_BITWISEXOR(hvuint8_t)
-BV_OP_BITWISEXOR(hvuint16_t)
-BV_OP_BITWISEXOR(hvuint32_t)
-BV_OP_BITWISEXOR(hvuint64_t)
-BV_OP_BITWISEXOR(hvint8_t)
-BV_OP_BITWISEXOR(hvint16_t)
-BV_OP_BITWISEXOR(hvint32_t)
-BV_OP_BITWISEXOR(hvint64_t)
+template<typename T> inline BitVector bv_operator_bitwisexor_scalar(
+		const BitVector &a, const T &b) {
+	return a.xorScalar(bv_scalar<T>::bits(b), bv_scalar<T>::width());
+}
+
+#define BV_OP_BITWISEXOR_SCALAR(T) inline BitVector operator ^ (const BitVector &a, const T &b) {return bv_operator_bitwisexor_scalar(a, b);} \
+inline BitVector operator ^ (const T &a, const BitVector &b) {return bv_operator_bitwisexor_scalar(b, a);}
+BV_OP_BITWISEXOR_SCALAR(bool)
+BV_OP_BITWISEXOR_SCALAR(hvuint8_t)
+BV_OP_BITWISEXOR_SCALAR(hvuint16_t)
+BV_OP_BITWISEXOR_SCALAR(hvuint32_t)
+BV_OP_BITWISEXOR_SCALAR(hvuint64_t)
+BV_OP_BITWISEXOR_SCALAR(hvint8_t)
+BV_OP_BITWISEXOR_SCALAR(hvint16_t)
+BV_OP_BITWISEXOR_SCALAR(hvint32_t)
+BV_OP_BITWISEXOR_SCALAR(hvint64_t)
+#ifdef HV_HAS_INT128
+BV_OP_BITWISEXOR_SCALAR(hvuint128_t)
+BV_OP_BITWISEXOR_SCALAR(hvint128_t)
+#endif
 BV_OP_BITWISEXOR(std::string)
 
 // Operator &=
@@ -1119,6 +1697,10 @@ BV_OP_BITWISEANDEQUAL(hvint8_t)
 BV_OP_BITWISEANDEQUAL(hvint16_t)
 BV_OP_BITWISEANDEQUAL(hvint32_t)
 BV_OP_BITWISEANDEQUAL(hvint64_t)
+#ifdef HV_HAS_INT128
+BV_OP_BITWISEANDEQUAL(hvuint128_t)
+BV_OP_BITWISEANDEQUAL(hvint128_t)
+#endif
 // Specialization for std::string
 inline std::string& operator &=(std::string &a, const BitVector &b) {
 	BitVector tmp(a);
@@ -1127,6 +1709,27 @@ inline std::string& operator &=(std::string &a, const BitVector &b) {
 	return a;
 }
 
+// Operator &= with a BitVector left-hand operand: scalar fast path
+// (sub-vector temporaries use the member operator)
+template<typename T> inline BitVector& bv_operator_bitwiseandequal_scalar(
+		BitVector &a, const T &b) {
+	return a.andEqualScalar(bv_scalar<T>::bits(b));
+}
+#define BV_OP_BITWISEANDEQUAL_SCALAR(T) inline BitVector& operator &= (BitVector &a, const T &b) {return bv_operator_bitwiseandequal_scalar(a, b);}
+BV_OP_BITWISEANDEQUAL_SCALAR(bool)
+BV_OP_BITWISEANDEQUAL_SCALAR(hvuint8_t)
+BV_OP_BITWISEANDEQUAL_SCALAR(hvuint16_t)
+BV_OP_BITWISEANDEQUAL_SCALAR(hvuint32_t)
+BV_OP_BITWISEANDEQUAL_SCALAR(hvuint64_t)
+BV_OP_BITWISEANDEQUAL_SCALAR(hvint8_t)
+BV_OP_BITWISEANDEQUAL_SCALAR(hvint16_t)
+BV_OP_BITWISEANDEQUAL_SCALAR(hvint32_t)
+BV_OP_BITWISEANDEQUAL_SCALAR(hvint64_t)
+#ifdef HV_HAS_INT128
+BV_OP_BITWISEANDEQUAL_SCALAR(hvuint128_t)
+BV_OP_BITWISEANDEQUAL_SCALAR(hvint128_t)
+#endif
+
 // Operator |=
 // Only one, the other one is achieved by implicit conversion
 template<typename T> inline T& bv_operator_bitwiseorequal(T &a,
@@ -1143,6 +1746,10 @@ BV_OP_BITWISEOREQUAL(hvint8_t)
 BV_OP_BITWISEOREQUAL(hvint16_t)
 BV_OP_BITWISEOREQUAL(hvint32_t)
 BV_OP_BITWISEOREQUAL(hvint64_t)
+#ifdef HV_HAS_INT128
+BV_OP_BITWISEOREQUAL(hvuint128_t)
+BV_OP_BITWISEOREQUAL(hvint128_t)
+#endif
 // Specialization for std::string
 inline std::string& operator |=(std::string &a, const BitVector &b) {
 	BitVector tmp(a);
@@ -1151,6 +1758,27 @@ inline std::string& operator |=(std::string &a, const BitVector &b) {
 	return a;
 }
 
+// Operator |= with a BitVector left-hand operand: scalar fast path
+// (sub-vector temporaries use the member operator)
+template<typename T> inline BitVector& bv_operator_bitwiseorequal_scalar(
+		BitVector &a, const T &b) {
+	return a.orEqualScalar(bv_scalar<T>::bits(b));
+}
+#define BV_OP_BITWISEOREQUAL_SCALAR(T) inline BitVector& operator |= (BitVector &a, const T &b) {return bv_operator_bitwiseorequal_scalar(a, b);}
+BV_OP_BITWISEOREQUAL_SCALAR(bool)
+BV_OP_BITWISEOREQUAL_SCALAR(hvuint8_t)
+BV_OP_BITWISEOREQUAL_SCALAR(hvuint16_t)
+BV_OP_BITWISEOREQUAL_SCALAR(hvuint32_t)
+BV_OP_BITWISEOREQUAL_SCALAR(hvuint64_t)
+BV_OP_BITWISEOREQUAL_SCALAR(hvint8_t)
+BV_OP_BITWISEOREQUAL_SCALAR(hvint16_t)
+BV_OP_BITWISEOREQUAL_SCALAR(hvint32_t)
+BV_OP_BITWISEOREQUAL_SCALAR(hvint64_t)
+#ifdef HV_HAS_INT128
+BV_OP_BITWISEOREQUAL_SCALAR(hvuint128_t)
+BV_OP_BITWISEOREQUAL_SCALAR(hvint128_t)
+#endif
+
 // Operator ^=
 // Only one, the other one is achieved by implicit conversion
 template<typename T> inline T& bv_operator_bitwisexorequal(T &a,
@@ -1167,6 +1795,10 @@ BV_OP_BITWISEXOREQUAL(hvint8_t)
 BV_OP_BITWISEXOREQUAL(hvint16_t)
 BV_OP_BITWISEXOREQUAL(hvint32_t)
 BV_OP_BITWISEXOREQUAL(hvint64_t)
+#ifdef HV_HAS_INT128
+BV_OP_BITWISEXOREQUAL(hvuint128_t)
+BV_OP_BITWISEXOREQUAL(hvint128_t)
+#endif
 // Specialization for std::string
 inline std::string& operator ^=(std::string &a, const BitVector &b) {
 	BitVector tmp(a);
@@ -1175,6 +1807,27 @@ inline std::string& operator ^=(std::string &a, const BitVector &b) {
 	return a;
 }
 
+// Operator ^= with a BitVector left-hand operand: scalar fast path
+// (sub-vector temporaries use the member operator)
+template<typename T> inline BitVector& bv_operator_bitwisexorequal_scalar(
+		BitVector &a, const T &b) {
+	return a.xorEqualScalar(bv_scalar<T>::bits(b));
+}
+#define BV_OP_BITWISEXOREQUAL_SCALAR(T) inline BitVector& operator ^= (BitVector &a, const T &b) {return bv_operator_bitwisexorequal_scalar(a, b);}
+BV_OP_BITWISEXOREQUAL_SCALAR(bool)
+BV_OP_BITWISEXOREQUAL_SCALAR(hvuint8_t)
+BV_OP_BITWISEXOREQUAL_SCALAR(hvuint16_t)
+BV_OP_BITWISEXOREQUAL_SCALAR(hvuint32_t)
+BV_OP_BITWISEXOREQUAL_SCALAR(hvuint64_t)
+BV_OP_BITWISEXOREQUAL_SCALAR(hvint8_t)
+BV_OP_BITWISEXOREQUAL_SCALAR(hvint16_t)
+BV_OP_BITWISEXOREQUAL_SCALAR(hvint32_t)
+BV_OP_BITWISEXOREQUAL_SCALAR(hvint64_t)
+#ifdef HV_HAS_INT128
+BV_OP_BITWISEXOREQUAL_SCALAR(hvuint128_t)
+BV_OP_BITWISEXOREQUAL_SCALAR(hvint128_t)
+#endif
+
 // Operator +
 template<typename T> inline BitVector bv_operator_concat1(const BitVector &a,
 		const T &b) {
@@ -1197,6 +1850,10 @@ BV_OP_PLUS(hvint8_t)
 BV_OP_PLUS(hvint16_t)
 BV_OP_PLUS(hvint32_t)
 BV_OP_PLUS(hvint64_t)
+#ifdef HV_HAS_INT128
+BV_OP_PLUS(hvuint128_t)
+BV_OP_PLUS(hvint128_t)
+#endif
 BV_OP_PLUS(std::string)
 
 } // namespace common
@@ -1250,5 +1907,207 @@ struct cci_value_converter<::hv::common::BitVector> {
 };
 } // namespace cci
 
+namespace fmt {
+/**
+ * fmt formatter for BitVector
+ *
+ * Digits are written directly to the output: no string is built, and a
+ * message filtered out by the log level costs nothing. Format specs are
+ * [#][_][type]:
+ * - type: b (binary), x or X (hexadecimal), d (decimal). Without type,
+ *   the output is the same as toString().
+ * - #: 0b, 0x or 0X prefix
+ * - _: digits grouped by 4 (binary, hexadecimal) or 3 (decimal)
+ * Binary and hexadecimal outputs hold all the digits of the size, leading
+ * zeros included.
+ *
+ * Example: HV_LOG_DEBUG("ctrl = {:#_x}", reg) logs "ctrl = 0x0012_3456"
+ */
+template<>
+struct formatter<::hv::common::BitVector> {
+	typedef ::hv::common::BitVector::bvsize_t bvsize_t;
+	typedef ::hv::common::BitVector::bvdata_t bvdata_t;
+	typedef ::hv::common::hvuint32_t hvuint32_t;
+	typedef ::hv::common::hvuint64_t hvuint64_t;
+
+	/**
+	 * Cells of at most this size are converted to decimal on the stack
+	 */
+	static constexpr bvsize_t maxStackCells = 64u;
+
+	char presentation;
+	bool prefix;
+	bool grouped;
+
+	formatter() :
+			presentation('\0'), prefix(false), grouped(false) {
+	}
+
+	template<typename ParseContext>
+	auto parse(ParseContext &ctx) -> decltype(ctx.begin()) {
+		auto it(ctx.begin());
+		const auto end(ctx.end());
+		if ((it != end) && (*it == '#')) {
+			prefix = true;
+			++it;
+		}
+		if ((it != end) && (*it == '_')) {
+			grouped = true;
+			++it;
+		}
+		if ((it != end)
+				&& ((*it == 'b') || (*it == 'x') || (*it == 'X') || (*it == 'd'))) {
+			presentation = *it++;
+		} else if (prefix || grouped) {
+			presentation = 'b';
+		}
+		if ((it != end) && (*it != '}')) {
+			FMT_THROW(format_error("invalid format specifier for BitVector"));
+		}
+		return it;
+	}
+
+	template<typename FormatContext>
+	auto format(const ::hv::common::BitVector &bv, FormatContext &ctx) const
+	-> decltype(ctx.out()) {
+		auto out(ctx.out());
+		switch (presentation) {
+		case 'x':
+		case 'X':
+			return this->formatHex(bv, out);
+		case 'd':
+			return this->formatDec(bv, out);
+		case 'b':
+			return this->formatBin(bv, out, true);
+		default:
+#ifdef HV_BV_STR_MSB_FIRST
+			return this->formatBin(bv, out, true);
+#else
+			return this->formatBin(bv, out, false);
+#endif
+		}
+	}
+
+private:
+	/**
+	 * Writes digit k (counted from the LSB side), followed by a separator
+	 * if it starts a group
+	 */
+	template<typename OutputIt>
+	OutputIt put(OutputIt out, const char &c, const hvuint32_t &k,
+			const hvuint32_t &group) const {
+		*out++ = c;
+		if (grouped && k && !(k % group)) {
+			*out++ = '_';
+		}
+		return out;
+	}
+
+	template<typename OutputIt>
+	OutputIt formatBin(const ::hv::common::BitVector &bv, OutputIt out,
+			const bool &msbFirst) const {
+		const bvdata_t *cells(bv.getDataAddress());
+		const hvuint32_t n(bv.getSize());
+		if (prefix) {
+			*out++ = '0';
+			*out++ = 'b';
+		}
+		for (hvuint32_t i = 0u; i < n; i++) {
+			const hvuint32_t k(msbFirst ? n - 1u - i : i);
+			const char c(((cells[HV_BV_ABS_POS_TO_ARRAY_INDEX(k)]
+					>> HV_BV_ABS_POS_TO_REL_POS(k)) & 1u) ? '1' : '0');
+			out = this->put(out, c, k, 4u);
+		}
+		return out;
+	}
+
+	template<typename OutputIt>
+	OutputIt formatHex(const ::hv::common::BitVector &bv, OutputIt out) const {
+		const char *digits(
+				presentation == 'X' ? "0123456789ABCDEF" : "0123456789abcdef");
+		const bvdata_t *cells(bv.getDataAddress());
+		const hvuint32_t n((bv.getSize() + 3u) / 4u);
+		const bvsize_t last(bv.getArraySize() - 1u);
+		if (prefix) {
+			*out++ = '0';
+			*out++ = presentation;
+		}
+		for (hvuint32_t k = n; k-- > 0u;) {
+			const bvsize_t cell(HV_BV_ABS_POS_TO_ARRAY_INDEX(4u * k));
+			const bvdata_t w(
+					cell == last ? cells[cell] & bv.getmaskLastCell() : cells[cell]);
+			out = this->put(out,
+					digits[(w >> HV_BV_ABS_POS_TO_REL_POS(4u * k)) & 0xFu], k, 4u);
+		}
+		return out;
+	}
+
+	template<typename OutputIt>
+	OutputIt formatDec(const ::hv::common::BitVector &bv, OutputIt out) const {
+		// Base 10^9 chunks are divided out of a copy of the cells, LSB first
+		bvsize_t nCells(bv.getArraySize());
+		const hvuint32_t maxChunks(bv.getSize() / 29u + 1u);
+		bvdata_t stackCells[maxStackCells];
+		hvuint32_t stackChunks[maxStackCells];
+		std::vector<bvdata_t> heapCells;
+		std::vector<hvuint32_t> heapChunks;
+		bvdata_t *cells(stackCells);
+		hvuint32_t *chunks(stackChunks);
+		if ((nCells > maxStackCells) || (maxChunks > maxStackCells)) {
+			heapCells.resize(nCells);
+			heapChunks.resize(maxChunks);
+			cells = heapCells.data();
+			chunks = heapChunks.data();
+		}
+		const bvdata_t *src(bv.getDataAddress());
+		for (bvsize_t i = 0u; i < nCells; i++) {
+			cells[i] = src[i];
+		}
+		cells[nCells - 1u] &= bv.getmaskLastCell();
+		while (nCells && !cells[nCells - 1u]) {
+			nCells--;
+		}
+		hvuint32_t nChunks(0u);
+		do {
+			hvuint64_t rem(0u);
+			for (bvsize_t i = nCells; i-- > 0u;) {
+				const hvuint64_t cur((rem << BITWIDTH_OF(bvdata_t)) | cells[i]);
+				cells[i] = static_cast<bvdata_t>(cur / 1000000000u);
+				rem = cur % 1000000000u;
+			}
+			chunks[nChunks++] = static_cast<hvuint32_t>(rem);
+			while (nCells && !cells[nCells - 1u]) {
+				nCells--;
+			}
+		} while (nCells);
+
+		// Most significant chunk without its leading zeros
+		char head[9];
+		hvuint32_t nHead(0u);
+		for (hvuint32_t c = chunks[nChunks - 1u]; c || !nHead; c /= 10u) {
+			head[nHead++] = static_cast<char>('0' + c % 10u);
+		}
+		hvuint32_t k(nHead + 9u * (nChunks - 1u));
+		while (nHead) {
+			out = this->put(out, head[--nHead], --k, 3u);
+		}
+		for (hvuint32_t j = nChunks - 1u; j-- > 0u;) {
+			hvuint32_t div(100000000u);
+			for (hvuint32_t d = 0u; d < 9u; d++, div /= 10u) {
+				out = this->put(out,
+						static_cast<char>('0' + (chunks[j] / div) % 10u), --k, 3u);
+			}
+		}
+		return out;
+	}
+};
+} // namespace fmt
+
+#ifdef HV_BV_HEADER_ONLY
+#define HV_BV_HEADER_ONLY_INCLUSION
+#include "bitvector.cpp"
+#undef HV_BV_HEADER_ONLY_INCLUSION
+#endif
+
 #endif // HV_BITVECTOR_H
 
@@ -0,0 +1,58 @@
+/**
+ * @file bitvector_std.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Word-level conversions between BitVector and std::bitset/std::vector<bool>
+ */
+
+#include "bitvector_std.h"
+
+namespace hv {
+namespace common {
+
+typedef BitVector::bvsize_t bvsize_t;
+
+void fromStd(const std::vector<bool> &src, BitVector &dst) {
+	if (src.empty()) {
+		fromWords(static_cast<const hvuint64_t*>(nullptr), 0u, dst);
+		return;
+	}
+	std::vector<hvuint64_t> buf;
+	fromWords(BoolVectorWords<>::read(src, buf), src.size(), dst);
+}
+
+void toStd(const BitVector &src, std::vector<bool> &dst) {
+	if (dst.empty()) {
+		return;
+	}
+	const std::size_t nWords(HV_STD_N_WORDS(dst.size()));
+	std::vector<hvuint64_t> buf;
+	hvuint64_t *words(BoolVectorWords<>::write(dst, buf));
+	toWords(src, words, nWords);
+	if (dst.size() % 64u) {
+		// Bits beyond size are kept at 0
+		words[nWords - 1u] &= HV_LSB_MASK_GEN(hvuint64_t, dst.size() % 64u);
+	}
+	BoolVectorWords<>::flush(words, dst);
+}
+
+BitVector toBitVector(const std::vector<bool> &src) {
+	HV_ASSERT(
+			!src.empty()
+					&& src.size() <= std::numeric_limits<bvsize_t>::max(),
+			"std::vector<bool> size out of BitVector range");
+	BitVector ret(static_cast<bvsize_t>(src.size()), false);
+	fromStd(src, ret);
+	return ret;
+}
+
+std::vector<bool> toBoolVector(const BitVector &src) {
+	std::vector<bool> ret(src.getSize());
+	toStd(src, ret);
+	return ret;
+}
+
+} // namespace common
+} // namespace hv
@@ -0,0 +1,242 @@
+/**
+ * @file bitvector_std.h
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Word-level conversions between BitVector and std::bitset/std::vector<bool>
+ *
+ * Conversions move 64-bit words. With libstdc++ and libc++, std::bitset
+ * words are copied from/to the object representation, and with libstdc++,
+ * std::vector<bool> words are reached through its iterators; elsewhere
+ * std::bitset goes through to_ullong() per 64-bit chunk and
+ * std::vector<bool> bit by bit.
+ * Destination size is kept: source is truncated or extended with 0s.
+ */
+
+#ifndef HV_BITVECTOR_STD_H
+#define HV_BITVECTOR_STD_H
+
+#include <bitset>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+#include "datatypes.h"
+#include "bitvector.h"
+
+/**
+ * Number of 64-bit words needed for a given bit width (at least 1)
+ */
+#define HV_STD_N_WORDS(w) ((w) ? ((w) - 1u) / 64u + 1u : 1u)
+
+/**
+ * std::bitset storage word, when its layout is known
+ */
+#if defined(__GLIBCXX__)
+#define HV_STD_BITSET_WORD_T unsigned long
+#elif defined(_LIBCPP_VERSION)
+#define HV_STD_BITSET_WORD_T std::size_t
+#endif
+
+/**
+ * std::vector<bool> words are reachable through libstdc++ iterators
+ */
+#if defined(__GLIBCXX__) && defined(__SIZEOF_LONG__) && __SIZEOF_LONG__ == 8
+#define HV_STD_VECTOR_BOOL_WORDS
+#endif
+
+namespace hv {
+namespace common {
+
+//** std::bitset storage access **//
+/**
+ * True if std::bitset<N> is stored as an array of 64-bit words
+ */
+template<std::size_t N> struct BitsetWordAccess {
+#ifdef HV_STD_BITSET_WORD_T
+	static const bool value = N > 0u
+			&& sizeof(HV_STD_BITSET_WORD_T) == sizeof(hvuint64_t)
+			&& sizeof(std::bitset<N>) == HV_STD_N_WORDS(N) * sizeof(hvuint64_t);
+#else
+	static const bool value = false;
+#endif
+};
+
+template<std::size_t N, bool WORDS = BitsetWordAccess<N>::value> struct BitsetWords;
+
+/**
+ * Direct copies from/to std::bitset object representation
+ */
+template<std::size_t N> struct BitsetWords<N, true> {
+	static void get(const std::bitset<N> &src, hvuint64_t *dst) {
+		std::memcpy(dst, &src, sizeof(src));
+	}
+	static void set(const hvuint64_t *src, std::bitset<N> &dst) {
+		std::memcpy(static_cast<void*>(&dst), src, sizeof(dst));
+	}
+};
+
+/**
+ * Portable copies, through to_ullong() per 64-bit chunk
+ */
+template<std::size_t N> struct BitsetWords<N, false> {
+	static void get(const std::bitset<N> &src, hvuint64_t *dst) {
+		const std::bitset<N> mask(std::numeric_limits<hvuint64_t>::max());
+		std::bitset<N> tmp(src);
+		for (std::size_t i = 0u; i < HV_STD_N_WORDS(N); i++) {
+			dst[i] = static_cast<hvuint64_t>((tmp & mask).to_ullong());
+			tmp >>= 64u;
+		}
+	}
+	static void set(const hvuint64_t *src, std::bitset<N> &dst) {
+		dst.reset();
+		for (std::size_t i = HV_STD_N_WORDS(N); i-- > 0u;) {
+			dst <<= 64u;
+			dst |= std::bitset<N>(static_cast<unsigned long long>(src[i]));
+		}
+	}
+};
+
+//** std::vector<bool> storage access **//
+/**
+ * True if std::vector<bool> is stored as an array of 64-bit words
+ */
+struct BoolVectorWordAccess {
+#ifdef HV_STD_VECTOR_BOOL_WORDS
+	static const bool value = std::is_same<std::_Bit_type, hvuint64_t>::value;
+#else
+	static const bool value = false;
+#endif
+};
+
+template<bool WORDS = BoolVectorWordAccess::value> struct BoolVectorWords;
+
+#ifdef HV_STD_VECTOR_BOOL_WORDS
+/**
+ * Direct access to std::vector<bool> storage words
+ */
+template<> struct BoolVectorWords<true> {
+	static const hvuint64_t* read(const std::vector<bool> &src,
+			std::vector<hvuint64_t> &) {
+		return reinterpret_cast<const hvuint64_t*>(src.begin()._M_p);
+	}
+	static hvuint64_t* write(std::vector<bool> &dst, std::vector<hvuint64_t> &) {
+		return reinterpret_cast<hvuint64_t*>(dst.begin()._M_p);
+	}
+	static void flush(const hvuint64_t *, std::vector<bool> &) {
+	}
+};
+#endif
+
+/**
+ * Portable access, bit by bit through a word buffer
+ */
+template<> struct BoolVectorWords<false> {
+	static const hvuint64_t* read(const std::vector<bool> &src,
+			std::vector<hvuint64_t> &buf) {
+		buf.assign(HV_STD_N_WORDS(src.size()), 0u);
+		for (std::size_t i = 0u; i < src.size(); i++) {
+			buf[i / 64u] |= static_cast<hvuint64_t>(src[i]) << (i % 64u);
+		}
+		return buf.data();
+	}
+	static hvuint64_t* write(std::vector<bool> &dst,
+			std::vector<hvuint64_t> &buf) {
+		buf.resize(HV_STD_N_WORDS(dst.size()));
+		return buf.data();
+	}
+	static void flush(const hvuint64_t *src, std::vector<bool> &dst) {
+		for (std::size_t i = 0u; i < dst.size(); i++) {
+			dst[i] = (src[i / 64u] >> (i % 64u)) & 1u;
+		}
+	}
+};
+
+//** std::bitset/std::vector<bool> to BitVector **//
+/**
+ * Copy a std::bitset to a BitVector
+ * @param src Source std::bitset
+ * @param dst Destination BitVector
+ */
+template<std::size_t N> void fromStd(const std::bitset<N> &src,
+		BitVector &dst) {
+	hvuint64_t words[HV_STD_N_WORDS(N)];
+	BitsetWords<N>::get(src, words);
+	fromWords(words, N, dst);
+}
+
+/**
+ * Copy a std::vector<bool> to a BitVector
+ * @param src Source std::vector<bool>
+ * @param dst Destination BitVector
+ */
+void fromStd(const std::vector<bool> &src, BitVector &dst);
+
+//** BitVector to std::bitset/std::vector<bool> **//
+/**
+ * Copy a BitVector to a std::bitset
+ * @param src Source BitVector
+ * @param dst Destination std::bitset
+ */
+template<std::size_t N> void toStd(const BitVector &src,
+		std::bitset<N> &dst) {
+	hvuint64_t words[HV_STD_N_WORDS(N)];
+	toWords(src, words, HV_STD_N_WORDS(N));
+	if (N % 64u) {
+		words[HV_STD_N_WORDS(N) - 1u] &= HV_LSB_MASK_GEN(hvuint64_t, N % 64u);
+	}
+	BitsetWords<N>::set(words, dst);
+}
+
+/**
+ * Copy a BitVector to a std::vector<bool>
+ * @param src Source BitVector
+ * @param dst Destination std::vector<bool>
+ */
+void toStd(const BitVector &src, std::vector<bool> &dst);
+
+//** Value-returning helpers **//
+/**
+ * Conversion of a std::bitset to a BitVector of same size
+ * @param src Source std::bitset
+ * @return BitVector
+ */
+template<std::size_t N> BitVector toBitVector(const std::bitset<N> &src) {
+	static_assert(N > 0u && N <= std::numeric_limits<BitVector::bvsize_t>::max(),
+			"std::bitset size out of BitVector range");
+	BitVector ret(static_cast<BitVector::bvsize_t>(N), false);
+	fromStd(src, ret);
+	return ret;
+}
+
+/**
+ * Conversion of a std::vector<bool> to a BitVector of same size
+ * @param src Source std::vector<bool>
+ * @return BitVector
+ */
+BitVector toBitVector(const std::vector<bool> &src);
+
+/**
+ * Conversion of a BitVector to a std::bitset<N>
+ * @param src Source BitVector
+ * @return std::bitset<N>
+ */
+template<std::size_t N> std::bitset<N> toBitset(const BitVector &src) {
+	std::bitset<N> ret;
+	toStd(src, ret);
+	return ret;
+}
+
+/**
+ * Conversion of a BitVector to a std::vector<bool> of same size
+ * @param src Source BitVector
+ * @return std::vector<bool>
+ */
+std::vector<bool> toBoolVector(const BitVector &src);
+
+} // namespace common
+} // namespace hv
+
+#endif // HV_BITVECTOR_STD_H
@@ -0,0 +1,251 @@
+/**
+ * @file bitvector_systemc.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Word-level conversions between BitVector/LogicVector and SystemC datatypes
+ */
+
+#include <limits>
+#include <vector>
+#include "bitvector_systemc.h"
+
+namespace hv {
+namespace common {
+
+typedef BitVector::bvdata_t bvdata_t;
+typedef BitVector::bvsize_t bvsize_t;
+
+/**
+ * Number of sc_digit words needed for a given bit width
+ */
+#define HV_SC_N_DIGITS(w) (((w) - 1) / static_cast<int>(BITWIDTH_OF(sc_dt::sc_digit)) + 1)
+
+/**
+ * Packed representation buffer, on the stack for common widths
+ */
+class ScDigitBuffer {
+public:
+	explicit ScDigitBuffer(const int &nWords) :
+			ptr(staticBuf) {
+		if (nWords > N_STATIC) {
+			dynBuf.resize(nWords);
+			ptr = dynBuf.data();
+		}
+	}
+
+	sc_dt::sc_digit* get() {
+		return ptr;
+	}
+
+private:
+	static const int N_STATIC = 8;
+	sc_dt::sc_digit staticBuf[N_STATIC];
+	std::vector<sc_dt::sc_digit> dynBuf;
+	sc_dt::sc_digit *ptr;
+};
+
+/**
+ * Get a BitVector cell, bits beyond size being read as 0
+ * @param bv BitVector
+ * @param i Cell index
+ * @return Cell value
+ */
+static inline bvdata_t getCell(const BitVector &bv, const int &i) {
+	const int n(bv.getArraySize());
+	if (i + 1 < n) {
+		return bv.getDataAddress()[i];
+	} else if (i + 1 == n) {
+		return bv.getDataAddress()[i] & bv.getmaskLastCell();
+	}
+	return static_cast<bvdata_t>(0u);
+}
+
+/**
+ * Mask of valid bits in the last word of a SystemC object
+ * @param length SystemC object length in bits
+ * @return Mask
+ */
+static inline sc_dt::sc_digit getLastWordMask(const int &length) {
+	const unsigned int r(
+			static_cast<unsigned int>(length) % BITWIDTH_OF(sc_dt::sc_digit));
+	return HV_LSB_MASK_GEN(sc_dt::sc_digit, r ? r : BITWIDTH_OF(sc_dt::sc_digit));
+}
+
+/**
+ * Copy a BitVector to a packed SystemC integer
+ * @param src Source BitVector
+ * @param dst Destination sc_signed or sc_unsigned
+ */
+template<typename T> static inline void packToSc(const BitVector &src,
+		T &dst) {
+	const int n(HV_SC_N_DIGITS(dst.length()));
+	ScDigitBuffer buf(n);
+	toWords(src, buf.get(), n);
+	dst.set_packed_rep(buf.get());
+}
+
+/**
+ * Copy a packed SystemC integer to a BitVector
+ * @param src Source sc_signed or sc_unsigned
+ * @param dst Destination BitVector
+ */
+template<typename T> static inline void unpackFromSc(const T &src,
+		BitVector &dst) {
+	const int nSrc(HV_SC_N_DIGITS(src.length()));
+	if (nSrc <= static_cast<int>(dst.getArraySize())) {
+		// Unpacking directly into destination cells
+		src.get_packed_rep(dst.getDataAddress());
+		fromWords(dst.getDataAddress(), src.length(), dst);
+	} else {
+		ScDigitBuffer buf(nSrc);
+		src.get_packed_rep(buf.get());
+		fromWords(buf.get(), src.length(), dst);
+	}
+}
+
+void toSystemC(const BitVector &src, sc_dt::sc_bv_base &dst) {
+	const int n(dst.size());
+	for (int i = 0; i < n; i++) {
+		dst.set_word(i, getCell(src, i));
+	}
+	dst.clean_tail();
+}
+
+void toSystemC(const BitVector &src, sc_dt::sc_lv_base &dst) {
+	const int n(dst.size());
+	for (int i = 0; i < n; i++) {
+		dst.set_word(i, getCell(src, i));
+		dst.set_cword(i, static_cast<sc_dt::sc_digit>(0u));
+	}
+	dst.clean_tail();
+}
+
+void toSystemC(const LogicVector &src, sc_dt::sc_lv_base &dst) {
+	const int n(dst.size());
+	const BitVector &value(src.getValuePlane());
+	const BitVector &unknown(src.getUnknownPlane());
+	for (int i = 0; i < n; i++) {
+		dst.set_word(i, getCell(value, i));
+		dst.set_cword(i, getCell(unknown, i));
+	}
+	dst.clean_tail();
+}
+
+void toSystemC(const BitVector &src, sc_dt::sc_unsigned &dst) {
+	packToSc(src, dst);
+}
+
+void toSystemC(const BitVector &src, sc_dt::sc_signed &dst) {
+	packToSc(src, dst);
+}
+
+void fromSystemC(const sc_dt::sc_bv_base &src, BitVector &dst) {
+	bvdata_t *p(dst.getDataAddress());
+	const int n(dst.getArraySize());
+	const int nSrc(src.size());
+	const sc_dt::sc_digit maskLast(getLastWordMask(src.length()));
+	for (int i = 0; i < n; i++) {
+		if (i + 1 < nSrc) {
+			p[i] = src.get_word(i);
+		} else if (i + 1 == nSrc) {
+			p[i] = src.get_word(i) & maskLast;
+		} else {
+			p[i] = static_cast<bvdata_t>(0u);
+		}
+	}
+	dst.syncParent();
+}
+
+bool fromSystemC(const sc_dt::sc_lv_base &src, BitVector &dst) {
+	bvdata_t *p(dst.getDataAddress());
+	const int n(dst.getArraySize());
+	const int nSrc(src.size());
+	const sc_dt::sc_digit maskLast(getLastWordMask(src.length()));
+	// Unknown bits are only reported within destination size
+	bvdata_t unknown(0u);
+	for (int i = 0; i < n; i++) {
+		if (i < nSrc) {
+			const sc_dt::sc_digit mask(
+					i + 1 == nSrc ? maskLast : ~static_cast<sc_dt::sc_digit>(0u));
+			const sc_dt::sc_digit c(src.get_cword(i) & mask);
+			p[i] = src.get_word(i) & mask & ~c;
+			unknown |= (i + 1 == n) ? c & dst.getmaskLastCell() : c;
+		} else {
+			p[i] = static_cast<bvdata_t>(0u);
+		}
+	}
+	dst.syncParent();
+	return !unknown;
+}
+
+void fromSystemC(const sc_dt::sc_lv_base &src, LogicVector &dst) {
+	BitVector &value(dst.getValuePlane());
+	BitVector &unknown(dst.getUnknownPlane());
+	bvdata_t *pv(value.getDataAddress());
+	bvdata_t *pu(unknown.getDataAddress());
+	const int n(value.getArraySize());
+	const int nSrc(src.size());
+	const sc_dt::sc_digit maskLast(getLastWordMask(src.length()));
+	for (int i = 0; i < n; i++) {
+		if (i < nSrc) {
+			const sc_dt::sc_digit mask(
+					i + 1 == nSrc ? maskLast : ~static_cast<sc_dt::sc_digit>(0u));
+			pv[i] = src.get_word(i) & mask;
+			pu[i] = src.get_cword(i) & mask;
+		} else {
+			pv[i] = static_cast<bvdata_t>(0u);
+			pu[i] = static_cast<bvdata_t>(0u);
+		}
+	}
+	value.syncParent();
+	unknown.syncParent();
+}
+
+void fromSystemC(const sc_dt::sc_unsigned &src, BitVector &dst) {
+	unpackFromSc(src, dst);
+}
+
+void fromSystemC(const sc_dt::sc_signed &src, BitVector &dst) {
+	unpackFromSc(src, dst);
+}
+
+BitVector toBitVector(const sc_dt::sc_bv_base &src) {
+	HV_ASSERT(src.length()
+			<= static_cast<long long>(std::numeric_limits<bvsize_t>::max()),
+			"sc_bv is too large for BitVector");
+	BitVector ret(static_cast<bvsize_t>(src.length()), 0u);
+	fromSystemC(src, ret);
+	return ret;
+}
+
+BitVector toBitVector(const sc_dt::sc_unsigned &src) {
+	HV_ASSERT(src.length()
+			<= static_cast<long long>(std::numeric_limits<bvsize_t>::max()),
+			"sc_unsigned is too large for BitVector");
+	BitVector ret(static_cast<bvsize_t>(src.length()), 0u);
+	fromSystemC(src, ret);
+	return ret;
+}
+
+BitVector toBitVector(const sc_dt::sc_signed &src) {
+	HV_ASSERT(src.length()
+			<= static_cast<long long>(std::numeric_limits<bvsize_t>::max()),
+			"sc_signed is too large for BitVector");
+	BitVector ret(static_cast<bvsize_t>(src.length()), 0u);
+	fromSystemC(src, ret);
+	return ret;
+}
+
+LogicVector toLogicVector(const sc_dt::sc_lv_base &src) {
+	HV_ASSERT(src.length()
+			<= static_cast<long long>(std::numeric_limits<bvsize_t>::max()),
+			"sc_lv is too large for LogicVector");
+	LogicVector ret(static_cast<bvsize_t>(src.length()), LOGIC_0);
+	fromSystemC(src, ret);
+	return ret;
+}
+
+} // namespace common
+} // namespace hv
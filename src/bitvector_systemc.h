@@ -0,0 +1,191 @@
+/**
+ * @file bitvector_systemc.h
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Word-level conversions between BitVector/LogicVector and SystemC datatypes
+ *
+ * Conversions copy whole words through SystemC's word access APIs
+ * (get_word/set_word/get_cword/set_cword for sc_bv/sc_lv,
+ * get_packed_rep/set_packed_rep for sc_signed/sc_unsigned).
+ * Destination size is kept: source is truncated or extended with 0s.
+ */
+
+#ifndef HV_BITVECTOR_SYSTEMC_H
+#define HV_BITVECTOR_SYSTEMC_H
+
+#include <type_traits>
+#include <systemc>
+#include "bitvector.h"
+#include "logicvector.h"
+
+namespace hv {
+namespace common {
+
+static_assert(std::is_same<BitVector::bvdata_t, sc_dt::sc_digit>::value,
+		"BitVector cell and sc_digit must be the same type");
+
+//** BitVector/LogicVector to SystemC **//
+/**
+ * Copy a BitVector to an sc_bv
+ * @param src Source BitVector
+ * @param dst Destination sc_bv
+ */
+void toSystemC(const BitVector &src, sc_dt::sc_bv_base &dst);
+
+/**
+ * Copy a BitVector to an sc_lv (all bits are known)
+ * @param src Source BitVector
+ * @param dst Destination sc_lv
+ */
+void toSystemC(const BitVector &src, sc_dt::sc_lv_base &dst);
+
+/**
+ * Copy a LogicVector to an sc_lv
+ * @param src Source LogicVector
+ * @param dst Destination sc_lv
+ */
+void toSystemC(const LogicVector &src, sc_dt::sc_lv_base &dst);
+
+/**
+ * Copy a BitVector to an sc_unsigned/sc_biguint
+ * @param src Source BitVector
+ * @param dst Destination sc_unsigned
+ */
+void toSystemC(const BitVector &src, sc_dt::sc_unsigned &dst);
+
+/**
+ * Copy a BitVector to an sc_signed/sc_bigint
+ * The BitVector is interpreted as a two's complement bit pattern.
+ * @param src Source BitVector
+ * @param dst Destination sc_signed
+ */
+void toSystemC(const BitVector &src, sc_dt::sc_signed &dst);
+
+//** SystemC to BitVector/LogicVector **//
+/**
+ * Copy an sc_bv to a BitVector
+ * @param src Source sc_bv
+ * @param dst Destination BitVector
+ */
+void fromSystemC(const sc_dt::sc_bv_base &src, BitVector &dst);
+
+/**
+ * Copy an sc_lv to a BitVector
+ * X and Z bits are converted to 0.
+ * @param src Source sc_lv
+ * @param dst Destination BitVector
+ * @return True if all copied bits were 0 or 1, false else
+ */
+bool fromSystemC(const sc_dt::sc_lv_base &src, BitVector &dst);
+
+/**
+ * Copy an sc_lv to a LogicVector
+ * @param src Source sc_lv
+ * @param dst Destination LogicVector
+ */
+void fromSystemC(const sc_dt::sc_lv_base &src, LogicVector &dst);
+
+/**
+ * Copy an sc_unsigned/sc_biguint to a BitVector
+ * @param src Source sc_unsigned
+ * @param dst Destination BitVector
+ */
+void fromSystemC(const sc_dt::sc_unsigned &src, BitVector &dst);
+
+/**
+ * Copy an sc_signed/sc_bigint two's complement bit pattern to a BitVector
+ * @param src Source sc_signed
+ * @param dst Destination BitVector
+ */
+void fromSystemC(const sc_dt::sc_signed &src, BitVector &dst);
+
+//** Value-returning helpers **//
+/**
+ * Conversion of an sc_bv to a BitVector of same size
+ * @param src Source sc_bv
+ * @return BitVector
+ */
+BitVector toBitVector(const sc_dt::sc_bv_base &src);
+
+/**
+ * Conversion of an sc_unsigned/sc_biguint to a BitVector of same size
+ * @param src Source sc_unsigned
+ * @return BitVector
+ */
+BitVector toBitVector(const sc_dt::sc_unsigned &src);
+
+/**
+ * Conversion of an sc_signed/sc_bigint to a BitVector of same size
+ * @param src Source sc_signed
+ * @return BitVector
+ */
+BitVector toBitVector(const sc_dt::sc_signed &src);
+
+/**
+ * Conversion of an sc_lv to a LogicVector of same size
+ * @param src Source sc_lv
+ * @return LogicVector
+ */
+LogicVector toLogicVector(const sc_dt::sc_lv_base &src);
+
+/**
+ * Conversion of a BitVector to an sc_bv<W>
+ * @param src Source BitVector
+ * @return sc_bv<W>
+ */
+template<int W> sc_dt::sc_bv<W> toScBv(const BitVector &src) {
+	sc_dt::sc_bv<W> ret;
+	toSystemC(src, ret);
+	return ret;
+}
+
+/**
+ * Conversion of a BitVector to an sc_lv<W>
+ * @param src Source BitVector
+ * @return sc_lv<W>
+ */
+template<int W> sc_dt::sc_lv<W> toScLv(const BitVector &src) {
+	sc_dt::sc_lv<W> ret;
+	toSystemC(src, ret);
+	return ret;
+}
+
+/**
+ * Conversion of a LogicVector to an sc_lv<W>
+ * @param src Source LogicVector
+ * @return sc_lv<W>
+ */
+template<int W> sc_dt::sc_lv<W> toScLv(const LogicVector &src) {
+	sc_dt::sc_lv<W> ret;
+	toSystemC(src, ret);
+	return ret;
+}
+
+/**
+ * Conversion of a BitVector to an sc_biguint<W>
+ * @param src Source BitVector
+ * @return sc_biguint<W>
+ */
+template<int W> sc_dt::sc_biguint<W> toScBigUint(const BitVector &src) {
+	sc_dt::sc_biguint<W> ret;
+	toSystemC(src, ret);
+	return ret;
+}
+
+/**
+ * Conversion of a BitVector to an sc_bigint<W>
+ * @param src Source BitVector
+ * @return sc_bigint<W>
+ */
+template<int W> sc_dt::sc_bigint<W> toScBigInt(const BitVector &src) {
+	sc_dt::sc_bigint<W> ret;
+	toSystemC(src, ret);
+	return ret;
+}
+
+} // namespace common
+} // namespace hv
+
+#endif // HV_BITVECTOR_SYSTEMC_H
@@ -0,0 +1,135 @@
+/**
+ * @file bitvectorjournal.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Write journal and rollback for BitVector state
+ */
+
+#include <vector>
+#include "hvutils.h"
+#include "bitvectorjournal.h"
+
+namespace hv {
+namespace common {
+
+typedef BitVector::bvsize_t bvsize_t;
+typedef BitVector::bvdata_t bvdata_t;
+typedef BitVectorJournal::marker_t marker_t;
+
+/**
+ * Journal record: old value of a cell
+ */
+struct JournalRecord {
+	BitVector *bv; // nullptr once dropped
+	bvdata_t old;
+	bvsize_t index;
+};
+
+/**
+ * Ring log of a thread
+ *
+ * head counts all records ever written, size is the number of records still
+ * held (the last ones). The ring is allocated on the first record.
+ */
+struct JournalLog {
+	std::vector<JournalRecord> ring;
+	std::size_t capacity;
+	marker_t head;
+	std::size_t size;
+
+	JournalLog() :
+			capacity(HV_BV_JOURNAL_DEFAULT_CAPACITY), head(0u), size(0u) {
+	}
+
+	JournalRecord& at(const marker_t &pos) {
+		return ring[static_cast<std::size_t>(pos) & (capacity - 1u)];
+	}
+
+	void push(BitVector &bv, const bvsize_t &index) {
+		if (ring.empty()) {
+			ring.resize(capacity);
+		}
+		JournalRecord &r(this->at(head++));
+		r.bv = &bv;
+		// Read through the const overload, which keeps shared storage
+		r.old = static_cast<const BitVector&>(bv).getDataAddress()[index];
+		r.index = index;
+		if (size < capacity) {
+			size++;
+		}
+	}
+};
+
+static thread_local JournalLog journalLog;
+
+marker_t BitVectorJournal::mark() {
+	return journalLog.head;
+}
+
+void BitVectorJournal::rollback(const marker_t &marker) {
+	HV_ASSERT(BitVectorJournal::isAvailable(marker),
+			"Journal marker {} is not available (log holds [{}, {}])", marker,
+			journalLog.head - journalLog.size, journalLog.head);
+	JournalLog &log(journalLog);
+	while (log.head > marker && log.size) {
+		const JournalRecord &r(log.at(--log.head));
+		log.size--;
+		if (r.bv != nullptr) {
+			r.bv->getDataAddress()[r.index] = r.old;
+		}
+	}
+}
+
+bool BitVectorJournal::isAvailable(const marker_t &marker) {
+	return (marker <= journalLog.head)
+			&& (journalLog.head - marker <= journalLog.size);
+}
+
+void BitVectorJournal::clear() {
+	journalLog.size = 0u;
+}
+
+void BitVectorJournal::setCapacity(const std::size_t &capacity) {
+	std::size_t c(1u);
+	while (c < capacity) {
+		c <<= 1;
+	}
+	journalLog.capacity = c;
+	journalLog.ring.clear();
+	journalLog.ring.shrink_to_fit();
+	journalLog.size = 0u;
+}
+
+std::size_t BitVectorJournal::getCapacity() {
+	return journalLog.capacity;
+}
+
+std::size_t BitVectorJournal::getSize() {
+	return journalLog.size;
+}
+
+void BitVectorJournal::record(BitVector &bv, const bvsize_t &index) {
+	journalLog.push(bv, index);
+}
+
+void BitVectorJournal::recordAll(BitVector &bv) {
+	JournalLog &log(journalLog);
+	for (bvsize_t i = 0u; i < bv.getArraySize(); i++) {
+		log.push(bv, i);
+	}
+}
+
+void BitVectorJournal::forget(const BitVector &bv) {
+	JournalLog &log(journalLog);
+	for (marker_t pos = log.head - log.size; pos < log.head; pos++) {
+		JournalRecord &r(log.at(pos));
+		if (r.bv == &bv) {
+			r.bv = nullptr;
+		}
+	}
+}
+
+} // namespace common
+} // namespace hv
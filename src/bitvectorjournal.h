@@ -0,0 +1,117 @@
+/**
+ * @file bitvectorjournal.h
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Write journal and rollback for BitVector state
+ */
+
+// Outside the include guard: in header-only mode, bitvector.h includes the
+// BitVector implementation, which needs this header to be complete
+#include "bitvector.h"
+
+#ifndef HV_BITVECTOR_JOURNAL_H
+#define HV_BITVECTOR_JOURNAL_H
+
+#include <cstddef>
+#include "datatypes.h"
+
+/**
+ * Default journal capacity, in records per thread
+ */
+#define HV_BV_JOURNAL_DEFAULT_CAPACITY (1u << 16)
+
+namespace hv {
+namespace common {
+
+/**
+ * Per-thread write journal for BitVectors
+ *
+ * Journaling is enabled per object with BitVector::setJournaled(). Writes to
+ * a journaled BitVector through its assignment operators, compound operators,
+ * rand() and sub-vector updates (updateParent()) append (object, cell index,
+ * old cell) records to a ring log owned by the writing thread. Assignments
+ * from another BitVector only record the cells that change. Objects which
+ * are not journaled pay a single flag test per write.
+ *
+ * mark() returns a position in the log, and rollback() replays the records
+ * written since that position in reverse order, restoring the cells, e.g. to
+ * undo the register writes of a speculative step. When the ring is full, the
+ * oldest records are overwritten and the markers that precede them can no
+ * longer be rolled back to.
+ *
+ * Cells written directly through getDataAddress() are not journaled.
+ * Destroying or resizing a journaled BitVector drops its records from the
+ * calling thread's log; objects must not be moved while journaled.
+ */
+class BitVectorJournal {
+public:
+	typedef hvuint64_t marker_t;
+
+	/**
+	 * Get current position of the calling thread's log
+	 * @return Marker for rollback()
+	 */
+	static marker_t mark();
+
+	/**
+	 * Undo all writes journaled since a marker, on the calling thread
+	 * @param marker Marker returned by mark(), not overwritten yet
+	 */
+	static void rollback(const marker_t &marker);
+
+	/**
+	 * Check whether a marker can still be rolled back to
+	 * @param marker Marker returned by mark()
+	 * @return true if all records since marker are in the log
+	 */
+	static bool isAvailable(const marker_t &marker);
+
+	/**
+	 * Drop all records of the calling thread (markers become unavailable)
+	 */
+	static void clear();
+
+	/**
+	 * Set log capacity of the calling thread, clearing the log
+	 * @param capacity Number of records, rounded up to a power of 2
+	 */
+	static void setCapacity(const std::size_t &capacity);
+
+	/**
+	 * Get log capacity of the calling thread
+	 * @return Number of records
+	 */
+	static std::size_t getCapacity();
+
+	/**
+	 * Get number of records held by the calling thread's log
+	 * @return Number of records
+	 */
+	static std::size_t getSize();
+
+	/**
+	 * Record the old value of a cell before it is written
+	 * @param bv Journaled BitVector
+	 * @param index Cell index
+	 */
+	static void record(BitVector &bv, const BitVector::bvsize_t &index);
+
+	/**
+	 * Record the old value of all cells of a BitVector
+	 * @param bv Journaled BitVector
+	 */
+	static void recordAll(BitVector &bv);
+
+	/**
+	 * Drop the records of a BitVector from the calling thread's log
+	 * @param bv BitVector
+	 */
+	static void forget(const BitVector &bv);
+};
+
+} // namespace common
+} // namespace hv
+
+#endif // HV_BITVECTOR_JOURNAL_H
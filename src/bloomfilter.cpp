@@ -0,0 +1,203 @@
+/**
+ * @file bloomfilter.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Bloom filters over address ranges, e.g. as watchpoint pre-filters
+ */
+
+#include "hvutils.h"
+#include "bloomfilter.h"
+
+namespace hv {
+namespace common {
+
+typedef BitVector::bvdata_t bvdata_t;
+
+#define HV_BLOOM_CELL_BITS (BITWIDTH_OF(bvdata_t))
+
+/**
+ * 64-bit mixer (SplitMix64 finalizer)
+ */
+static inline hvuint64_t mix(const hvuint64_t &x) {
+	hvuint64_t z(x + 0x9E3779B97F4A7C15ULL);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+	return z ^ (z >> 31);
+}
+
+/**
+ * Scale a 32-bit hash to [0, n)
+ */
+static inline hvuint32_t scale(const hvuint32_t &h, const hvuint32_t &n) {
+	return static_cast<hvuint32_t>((static_cast<hvuint64_t>(h) * n) >> 32);
+}
+
+BloomFilter::BloomFilter(const bvsize_t &nBits, const unsigned int &nHashes,
+		const unsigned int &granuleLog2) :
+		bitmap(nBits, false), nHashes(nHashes), granuleLog2(granuleLog2) {
+	HV_ASSERT(nBits > 0u, "Bloom filter size must be non-zero");
+	HV_ASSERT(nHashes > 0u && nHashes <= HV_BLOOM_MAX_HASHES,
+			"Bloom filter number of hashes must be between 1 and {} (got {})",
+			HV_BLOOM_MAX_HASHES, nHashes);
+	HV_ASSERT(granuleLog2 < BITWIDTH_OF(hvaddr_t),
+			"Bloom filter granule log2 {} out of range", granuleLog2);
+}
+
+BloomFilter::~BloomFilter() {
+}
+
+BloomFilter::bvsize_t BloomFilter::getNBits() const {
+	return bitmap.getSize();
+}
+
+unsigned int BloomFilter::getNHashes() const {
+	return nHashes;
+}
+
+unsigned int BloomFilter::getGranuleLog2() const {
+	return granuleLog2;
+}
+
+const BitVector& BloomFilter::getBitmap() const {
+	return bitmap;
+}
+
+void BloomFilter::insert(const hvaddr_t &addr) {
+	this->insertGranule(addr >> granuleLog2);
+}
+
+void BloomFilter::insertRange(const hvaddr_t &start, const hvaddr_t &size) {
+	const hvaddr_t last(this->lastGranule(start, size));
+	for (hvaddr_t g = start >> granuleLog2;; g++) {
+		this->insertGranule(g);
+		if (g == last) {
+			break;
+		}
+	}
+}
+
+bool BloomFilter::mayContain(const hvaddr_t &addr) const {
+	return this->testGranule(addr >> granuleLog2);
+}
+
+bool BloomFilter::mayContainRange(const hvaddr_t &start,
+		const hvaddr_t &size) const {
+	const hvaddr_t last(this->lastGranule(start, size));
+	for (hvaddr_t g = start >> granuleLog2;; g++) {
+		if (this->testGranule(g)) {
+			return true;
+		}
+		if (g == last) {
+			return false;
+		}
+	}
+}
+
+void BloomFilter::clear() {
+	bitmap = false;
+}
+
+void BloomFilter::positions(const hvaddr_t &granule, hvuint32_t *pos) const {
+	const hvuint64_t h(mix(granule));
+	const hvuint32_t h1(static_cast<hvuint32_t>(h));
+	const hvuint32_t h2(static_cast<hvuint32_t>(h >> 32) | 1u);
+	const hvuint32_t n(bitmap.getSize());
+	for (unsigned int i = 0u; i < nHashes; i++) {
+		pos[i] = scale(h1 + i * h2, n);
+	}
+}
+
+bool BloomFilter::testGranule(const hvaddr_t &granule) const {
+	const hvuint64_t h(mix(granule));
+	const hvuint32_t h1(static_cast<hvuint32_t>(h));
+	const hvuint32_t h2(static_cast<hvuint32_t>(h >> 32) | 1u);
+	const hvuint32_t n(bitmap.getSize());
+	const bvdata_t *d(bitmap.getDataAddress());
+	for (unsigned int i = 0u; i < nHashes; i++) {
+		const hvuint32_t p(scale(h1 + i * h2, n));
+		if (!((d[p / HV_BLOOM_CELL_BITS] >> (p % HV_BLOOM_CELL_BITS)) & 1u)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void BloomFilter::insertGranule(const hvaddr_t &granule) {
+	hvuint32_t pos[HV_BLOOM_MAX_HASHES];
+	this->positions(granule, pos);
+	bvdata_t *d(bitmap.getDataAddress());
+	for (unsigned int i = 0u; i < nHashes; i++) {
+		d[pos[i] / HV_BLOOM_CELL_BITS] |= HV_BIT_MASK_GEN(bvdata_t,
+				pos[i] % HV_BLOOM_CELL_BITS);
+	}
+}
+
+hvaddr_t BloomFilter::lastGranule(const hvaddr_t &start,
+		const hvaddr_t &size) const {
+	HV_ASSERT(size > 0u && start + (size - 1u) >= start,
+			"Invalid range (start {:#x}, size {:#x})", start, size);
+	return (start + (size - 1u)) >> granuleLog2;
+}
+
+CountingBloomFilter::CountingBloomFilter(const bvsize_t &nBits,
+		const unsigned int &nHashes, const unsigned int &granuleLog2) :
+		BloomFilter(nBits, nHashes, granuleLog2), counters(nBits, 0u) {
+}
+
+CountingBloomFilter::~CountingBloomFilter() {
+}
+
+void CountingBloomFilter::erase(const hvaddr_t &addr) {
+	this->eraseGranule(addr >> granuleLog2);
+}
+
+void CountingBloomFilter::eraseRange(const hvaddr_t &start,
+		const hvaddr_t &size) {
+	const hvaddr_t last(this->lastGranule(start, size));
+	for (hvaddr_t g = start >> granuleLog2;; g++) {
+		this->eraseGranule(g);
+		if (g == last) {
+			break;
+		}
+	}
+}
+
+void CountingBloomFilter::clear() {
+	BloomFilter::clear();
+	counters.assign(counters.size(), 0u);
+}
+
+void CountingBloomFilter::insertGranule(const hvaddr_t &granule) {
+	hvuint32_t pos[HV_BLOOM_MAX_HASHES];
+	this->positions(granule, pos);
+	bvdata_t *d(bitmap.getDataAddress());
+	for (unsigned int i = 0u; i < nHashes; i++) {
+		hvuint8_t &c(counters[pos[i]]);
+		if (c != 0xFFu) {
+			c++;
+		}
+		d[pos[i] / HV_BLOOM_CELL_BITS] |= HV_BIT_MASK_GEN(bvdata_t,
+				pos[i] % HV_BLOOM_CELL_BITS);
+	}
+}
+
+void CountingBloomFilter::eraseGranule(const hvaddr_t &granule) {
+	hvuint32_t pos[HV_BLOOM_MAX_HASHES];
+	this->positions(granule, pos);
+	bvdata_t *d(bitmap.getDataAddress());
+	for (unsigned int i = 0u; i < nHashes; i++) {
+		hvuint8_t &c(counters[pos[i]]);
+		HV_ASSERT(c != 0u, "Counting Bloom filter: erasing a granule ({:#x}) "
+				"that was not inserted", granule);
+		// Saturated counters are sticky
+		if (c != 0xFFu && !--c) {
+			d[pos[i] / HV_BLOOM_CELL_BITS] &= ~HV_BIT_MASK_GEN(bvdata_t,
+					pos[i] % HV_BLOOM_CELL_BITS);
+		}
+	}
+}
+
+} // namespace common
+} // namespace hv
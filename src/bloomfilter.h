@@ -0,0 +1,206 @@
+/**
+ * @file bloomfilter.h
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Bloom filters over address ranges, e.g. as watchpoint pre-filters
+ */
+
+#ifndef HV_BLOOM_FILTER_H
+#define HV_BLOOM_FILTER_H
+
+#include <vector>
+#include "datatypes.h"
+#include "bitvector.h"
+
+/**
+ * Maximum number of hash functions
+ */
+#define HV_BLOOM_MAX_HASHES 16
+
+namespace hv {
+namespace common {
+
+/**
+ * Bloom filter
+ *
+ * Set membership test with false positives but no false negatives, to be
+ * placed in front of an exact structure: e.g. a watchpoint check first
+ * calls mayContainRange() on each access, and only looks up the watchpoint
+ * set when it returns true.
+ *
+ * Addresses are grouped in granules of 2^granuleLog2 bytes; a range is
+ * inserted as all granules it overlaps. Each granule is hashed once with a
+ * 64-bit mixer, and the k bit positions are derived from the two halves of
+ * the hash (h1 + i * h2, Kirsch-Mitzenmacher), scaled to the filter size
+ * with a multiplication. A query stops at the first cleared bit, so most
+ * misses cost one or two loads.
+ */
+class BloomFilter {
+public:
+	typedef BitVector::bvsize_t bvsize_t;
+
+	/**
+	 * Constructor
+	 * @param nBits Filter size in bits
+	 * @param nHashes Number of hash functions (1 to HV_BLOOM_MAX_HASHES)
+	 * @param granuleLog2 log2 of the granule size in bytes
+	 */
+	BloomFilter(const bvsize_t &nBits, const unsigned int &nHashes = 3u,
+			const unsigned int &granuleLog2 = 0u);
+
+	virtual ~BloomFilter();
+
+	//** Accessors **//
+	/**
+	 * Get filter size
+	 * @return Filter size in bits
+	 */
+	bvsize_t getNBits() const;
+
+	/**
+	 * Get number of hash functions
+	 * @return Number of hash functions
+	 */
+	unsigned int getNHashes() const;
+
+	/**
+	 * Get granule size
+	 * @return log2 of the granule size in bytes
+	 */
+	unsigned int getGranuleLog2() const;
+
+	/**
+	 * Get filter bits
+	 * @return Bitmap
+	 */
+	const BitVector& getBitmap() const;
+
+	/**
+	 * Insert the granule of an address
+	 * @param addr Address
+	 */
+	void insert(const hvaddr_t &addr);
+
+	/**
+	 * Insert all granules overlapped by a range
+	 * @param start Range start
+	 * @param size Range size in bytes (non-zero)
+	 */
+	void insertRange(const hvaddr_t &start, const hvaddr_t &size);
+
+	/**
+	 * Test the granule of an address
+	 * @param addr Address
+	 * @return False if the granule was never inserted
+	 */
+	bool mayContain(const hvaddr_t &addr) const;
+
+	/**
+	 * Test all granules overlapped by a range, e.g. a memory access
+	 * @param start Range start
+	 * @param size Range size in bytes (non-zero)
+	 * @return False if none of the granules was ever inserted
+	 */
+	bool mayContainRange(const hvaddr_t &start, const hvaddr_t &size) const;
+
+	/**
+	 * Remove all granules
+	 */
+	virtual void clear();
+
+protected:
+	/**
+	 * Compute the bit positions of a granule
+	 * @param granule Granule index (address >> granuleLog2)
+	 * @param pos Bit positions (nHashes)
+	 */
+	void positions(const hvaddr_t &granule, hvuint32_t *pos) const;
+
+	/**
+	 * Test a granule
+	 */
+	bool testGranule(const hvaddr_t &granule) const;
+
+	/**
+	 * Insert a granule
+	 */
+	virtual void insertGranule(const hvaddr_t &granule);
+
+	/**
+	 * Last granule of a range
+	 */
+	hvaddr_t lastGranule(const hvaddr_t &start, const hvaddr_t &size) const;
+
+	/**
+	 * Filter bits
+	 */
+	BitVector bitmap;
+
+	unsigned int nHashes;
+	unsigned int granuleLog2;
+};
+
+/**
+ * Counting Bloom filter
+ *
+ * Bloom filter keeping an 8-bit counter per bit so that granules can be
+ * removed. Queries only read the bitmap, as for BloomFilter. Counters
+ * saturate at 255 and are then never decremented, which keeps the filter
+ * free of false negatives at the cost of more false positives. Removing a
+ * granule that was not inserted is an error.
+ */
+class CountingBloomFilter: public BloomFilter {
+public:
+	/**
+	 * Constructor
+	 * @param nBits Filter size in bits
+	 * @param nHashes Number of hash functions (1 to HV_BLOOM_MAX_HASHES)
+	 * @param granuleLog2 log2 of the granule size in bytes
+	 */
+	CountingBloomFilter(const bvsize_t &nBits, const unsigned int &nHashes = 3u,
+			const unsigned int &granuleLog2 = 0u);
+
+	virtual ~CountingBloomFilter();
+
+	/**
+	 * Remove the granule of an address, inserted before
+	 * @param addr Address
+	 */
+	void erase(const hvaddr_t &addr);
+
+	/**
+	 * Remove all granules overlapped by a range, inserted before with
+	 * insertRange
+	 * @param start Range start
+	 * @param size Range size in bytes (non-zero)
+	 */
+	void eraseRange(const hvaddr_t &start, const hvaddr_t &size);
+
+	/**
+	 * Remove all granules, counters included
+	 */
+	virtual void clear();
+
+protected:
+	/**
+	 * Insert a granule, incrementing its counters
+	 */
+	virtual void insertGranule(const hvaddr_t &granule);
+
+	/**
+	 * Remove a granule
+	 */
+	void eraseGranule(const hvaddr_t &granule);
+
+	/**
+	 * Counters
+	 */
+	std::vector<hvuint8_t> counters;
+};
+
+} // namespace common
+} // namespace hv
+
+#endif // HV_BLOOM_FILTER_H
@@ -12,14 +12,31 @@
 #ifndef HV_COMMON_H
 #define HV_COMMON_H
 
+#include "common/bitmapallocator.h"
 #include "common/bitvector.h"
+#include "common/bitvector_std.h"
+#include "common/bitvector_systemc.h"
+#include "common/bitvectorjournal.h"
+#include "common/bloomfilter.h"
 #include "common/callback.h"
+#include "common/compactbitvector.h"
 #include "common/cplusplus.h"
+#include "common/crc.h"
 #include "common/datatypes.h"
+#include "common/ecc.h"
 #include "common/fifo.h"
 #include "common/filtered_range.h"
+#include "common/fixedpoint.h"
 #include "common/log.h"
+#include "common/packedlanes.h"
+#include "common/random.h"
+#include "common/rankselect.h"
 #include "common/hvutils.h"
+#include "common/lfsr.h"
+#include "common/logicvector.h"
+#include "common/ternarymatchtable.h"
 #include "common/texttable.h"
+#include "common/vcdwriter.h"
+#include "common/verilog.h"
 
 #endif // HV_COMMON_H
@@ -0,0 +1,74 @@
+/**
+ * @file compactbitvector.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief 16-byte bit vector of at most 64 bits for large containers
+ */
+
+#include "compactbitvector.h"
+
+namespace hv {
+namespace common {
+
+CompactBitVector::CompactBitVector(const BitVector &bv) :
+		value(0u), binSize(static_cast<hvuint8_t>(bv.getSize())) {
+	HV_ASSERT(bv.getSize() <= HV_CBV_MAX_BITWIDTH,
+			"BitVector of size {} does not fit in a CompactBitVector",
+			bv.getSize());
+	value = static_cast<hvuint64_t>(bv);
+}
+
+CompactBitVector CompactBitVector::getRange(const bvsize_t &ind1,
+		const bvsize_t &ind2) const {
+	const bvsize_t lo(HV_MIN(ind1, ind2));
+	const bvsize_t hi(HV_MAX(ind1, ind2));
+	HV_ASSERT(hi < binSize, "Index out of scope ({},{}) is not in (0,{})", lo,
+			hi, binSize - 1u);
+	return CompactBitVector(hi - lo + 1u, value >> lo);
+}
+
+void CompactBitVector::setRange(const bvsize_t &ind1, const bvsize_t &ind2,
+		const hvuint64_t &value) {
+	const bvsize_t lo(HV_MIN(ind1, ind2));
+	const bvsize_t hi(HV_MAX(ind1, ind2));
+	HV_ASSERT(hi < binSize, "Index out of scope ({},{}) is not in (0,{})", lo,
+			hi, binSize - 1u);
+	const hvuint64_t mask(HV_LSB_MASK_GEN(hvuint64_t, hi - lo + 1u) << lo);
+	this->value = (this->value & ~mask) | ((value << lo) & mask);
+}
+
+BitVector CompactBitVector::toBitVector() const {
+	return BitVector(binSize, value);
+}
+
+std::string CompactBitVector::toString() const {
+	std::string ret(binSize, '0');
+	for (bvsize_t i = 0u; i < binSize; i++) {
+		if ((value >> i) & 1u) {
+#ifdef HV_BV_STR_MSB_FIRST
+			ret[binSize - 1u - i] = '1';
+#else
+			ret[i] = '1';
+#endif
+		}
+	}
+	return ret;
+}
+
+CompactBitVector CompactBitVector::operator +(
+		const CompactBitVector &op2) const {
+	HV_ASSERT(binSize + op2.binSize <= HV_CBV_MAX_BITWIDTH,
+			"Concatenation size {} exceeds CompactBitVector maximum size",
+			binSize + op2.binSize);
+	return CompactBitVector(binSize + op2.binSize,
+			(value << op2.binSize) | op2.value);
+}
+
+std::ostream& operator <<(std::ostream &strm, const CompactBitVector &cbv) {
+	return strm << cbv.toString();
+}
+
+} // namespace common
+} // namespace hv
@@ -0,0 +1,353 @@
+/**
+ * @file compactbitvector.h
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief 16-byte bit vector of at most 64 bits for large containers
+ */
+
+#ifndef HV_COMPACT_BITVECTOR_H
+#define HV_COMPACT_BITVECTOR_H
+
+#include <string>
+#include "datatypes.h"
+#include "hvutils.h"
+#include "bitvector.h"
+
+/**
+ * Maximum CompactBitVector size in bits
+ */
+#define HV_CBV_MAX_BITWIDTH 64u
+
+namespace hv {
+namespace common {
+
+/**
+ * Compact bit vector
+ *
+ * Holds up to 64 bits in a single word next to its size, i.e. 16 bytes per
+ * object against about 48 for a BitVector, for containers of millions of
+ * small vectors such as register maps and scoreboards. The array size and
+ * last cell mask of BitVector are derived from the size on demand, and
+ * there are no sub-vector indexes: ranges are read and written with
+ * getRange() and setRange() instead of sub-vector proxies.
+ *
+ * Bits above the size are always 0, and comparisons, like BitVector ones,
+ * are made on zero-extended values. Binary operators return the size of
+ * the largest operand, compound operators keep the size of the left-hand
+ * operand.
+ *
+ * The class has no virtual method, so that no vtable pointer is stored;
+ * it is not meant to be derived from. Conversions from and to BitVector are
+ * explicit.
+ */
+class CompactBitVector {
+public:
+	typedef BitVector::bvsize_t bvsize_t;
+
+	/**
+	 * Default constructor
+	 * Creates a 32-bit CompactBitVector worth 0.
+	 */
+	CompactBitVector();
+
+	/**
+	 * Constructor from value
+	 * @param size Size in bits (1 to 64)
+	 * @param value Initial value, truncated to size (default: 0)
+	 */
+	CompactBitVector(const bvsize_t &size, const hvuint64_t &value = 0u);
+
+	/**
+	 * Constructor from BitVector
+	 * @param bv Source BitVector (at most 64 bits)
+	 */
+	explicit CompactBitVector(const BitVector &bv);
+
+	/**
+	 * Get size
+	 * @return Size in bits
+	 */
+	bvsize_t getSize() const;
+
+	/**
+	 * Get value
+	 * @return Value, zero-extended
+	 */
+	hvuint64_t getValue() const;
+
+	/**
+	 * Set value
+	 * @param value New value, truncated to size
+	 */
+	void setValue(const hvuint64_t &value);
+
+	/**
+	 * Get a bit
+	 * @param ind Bit index
+	 * @return Bit value
+	 */
+	bool get(const bvsize_t &ind) const;
+
+	/**
+	 * Set a bit
+	 * @param ind Bit index
+	 * @param value Bit value
+	 */
+	void set(const bvsize_t &ind, const bool &value = true);
+
+	/**
+	 * Get a range of bits
+	 * @param ind1 First bound (included)
+	 * @param ind2 Second bound (included)
+	 * @return Range, sized ind2 - ind1 + 1 (bounds in any order)
+	 */
+	CompactBitVector getRange(const bvsize_t &ind1, const bvsize_t &ind2) const;
+
+	/**
+	 * Set a range of bits
+	 * @param ind1 First bound (included)
+	 * @param ind2 Second bound (included)
+	 * @param value New range value, truncated to the range size
+	 */
+	void setRange(const bvsize_t &ind1, const bvsize_t &ind2,
+			const hvuint64_t &value);
+
+	/**
+	 * Get number of bits set
+	 * @return Number of 1s
+	 */
+	bvsize_t count() const;
+
+	/**
+	 * Conversion to BitVector
+	 * @return BitVector of the same size and value
+	 */
+	BitVector toBitVector() const;
+
+	/**
+	 * Conversion to string
+	 *
+	 * LSB or MSB first is defined by macro HV_BV_STR_MSB_FIRST
+	 * @return String of 0s and 1s
+	 */
+	std::string toString() const;
+
+	/**
+	 * Equal comparison
+	 * @param op2 Right-hand operand
+	 * @return True if values are equal, false else
+	 */
+	bool operator ==(const CompactBitVector &op2) const;
+
+	/**
+	 * Different comparison
+	 * @param op2 Right-hand operand
+	 * @return True if values are different, false else
+	 */
+	bool operator !=(const CompactBitVector &op2) const;
+
+	/**
+	 * Logical negation
+	 * @return True if worth 0, false else
+	 */
+	bool operator !() const;
+
+	/**
+	 * Binary negation
+	 * @return bit-negated CompactBitVector
+	 */
+	CompactBitVector operator ~() const;
+
+	/**
+	 * Binary AND
+	 * @param op2 Right-hand operand
+	 * @return Binary AND result
+	 */
+	CompactBitVector operator &(const CompactBitVector &op2) const;
+
+	/**
+	 * Binary OR
+	 * @param op2 Right-hand operand
+	 * @return Binary OR result
+	 */
+	CompactBitVector operator |(const CompactBitVector &op2) const;
+
+	/**
+	 * Binary XOR
+	 * @param op2 Right-hand operand
+	 * @return Binary XOR result
+	 */
+	CompactBitVector operator ^(const CompactBitVector &op2) const;
+
+	/**
+	 * Binary AND and assignment
+	 * @param op2 Right-hand operand
+	 * @return Reference to this
+	 */
+	CompactBitVector& operator &=(const CompactBitVector &op2);
+
+	/**
+	 * Binary OR and assignment
+	 * @param op2 Right-hand operand
+	 * @return Reference to this
+	 */
+	CompactBitVector& operator |=(const CompactBitVector &op2);
+
+	/**
+	 * Binary XOR and assignment
+	 * @param op2 Right-hand operand
+	 * @return Reference to this
+	 */
+	CompactBitVector& operator ^=(const CompactBitVector &op2);
+
+	/**
+	 * Left shift, same size
+	 * @param nShift Shift amount
+	 * @return Shifted CompactBitVector
+	 */
+	CompactBitVector operator <<(const hvuint32_t &nShift) const;
+
+	/**
+	 * Right shift, same size
+	 * @param nShift Shift amount
+	 * @return Shifted CompactBitVector
+	 */
+	CompactBitVector operator >>(const hvuint32_t &nShift) const;
+
+	/**
+	 * Concatenation operator
+	 *
+	 * Left-hand operand is set to MSB side. Total size must not exceed 64.
+	 * @param op2 Right-hand operand
+	 * @return Concatenated CompactBitVector
+	 */
+	CompactBitVector operator +(const CompactBitVector &op2) const;
+
+	friend std::ostream& operator <<(std::ostream &strm,
+			const CompactBitVector &cbv);
+
+protected:
+	/**
+	 * Mask of the size bits
+	 */
+	hvuint64_t getMask() const;
+
+	hvuint64_t value;
+	hvuint8_t binSize;
+};
+
+// Inline definitions: these are the operations containers of compact
+// vectors are built for
+inline CompactBitVector::CompactBitVector() :
+		value(0u), binSize(32u) {
+}
+
+inline CompactBitVector::CompactBitVector(const bvsize_t &size,
+		const hvuint64_t &value) :
+		value(0u), binSize(static_cast<hvuint8_t>(size)) {
+	HV_ASSERT((size > 0u) && (size <= HV_CBV_MAX_BITWIDTH),
+			"CompactBitVector size {} is not in [1, {}]", size,
+			HV_CBV_MAX_BITWIDTH);
+	this->value = value & this->getMask();
+}
+
+inline hvuint64_t CompactBitVector::getMask() const {
+	return HV_LSB_MASK_GEN(hvuint64_t, binSize);
+}
+
+inline CompactBitVector::bvsize_t CompactBitVector::getSize() const {
+	return binSize;
+}
+
+inline hvuint64_t CompactBitVector::getValue() const {
+	return value;
+}
+
+inline void CompactBitVector::setValue(const hvuint64_t &value) {
+	this->value = value & this->getMask();
+}
+
+inline bool CompactBitVector::get(const bvsize_t &ind) const {
+	HV_ASSERT(ind < binSize, "Index out of scope ({}) is not in (0,{})", ind,
+			binSize - 1u);
+	return (value >> ind) & 1u;
+}
+
+inline void CompactBitVector::set(const bvsize_t &ind, const bool &value) {
+	HV_ASSERT(ind < binSize, "Index out of scope ({}) is not in (0,{})", ind,
+			binSize - 1u);
+	const hvuint64_t bit(static_cast<hvuint64_t>(1u) << ind);
+	this->value = value ? (this->value | bit) : (this->value & ~bit);
+}
+
+inline CompactBitVector::bvsize_t CompactBitVector::count() const {
+	return static_cast<bvsize_t>(popCount(value));
+}
+
+inline bool CompactBitVector::operator ==(const CompactBitVector &op2) const {
+	return value == op2.value;
+}
+
+inline bool CompactBitVector::operator !=(const CompactBitVector &op2) const {
+	return value != op2.value;
+}
+
+inline bool CompactBitVector::operator !() const {
+	return !value;
+}
+
+inline CompactBitVector CompactBitVector::operator ~() const {
+	return CompactBitVector(binSize, ~value);
+}
+
+inline CompactBitVector CompactBitVector::operator &(
+		const CompactBitVector &op2) const {
+	return CompactBitVector(HV_MAX(binSize, op2.binSize), value & op2.value);
+}
+
+inline CompactBitVector CompactBitVector::operator |(
+		const CompactBitVector &op2) const {
+	return CompactBitVector(HV_MAX(binSize, op2.binSize), value | op2.value);
+}
+
+inline CompactBitVector CompactBitVector::operator ^(
+		const CompactBitVector &op2) const {
+	return CompactBitVector(HV_MAX(binSize, op2.binSize), value ^ op2.value);
+}
+
+inline CompactBitVector& CompactBitVector::operator &=(
+		const CompactBitVector &op2) {
+	value &= op2.value;
+	return *this;
+}
+
+inline CompactBitVector& CompactBitVector::operator |=(
+		const CompactBitVector &op2) {
+	value = (value | op2.value) & this->getMask();
+	return *this;
+}
+
+inline CompactBitVector& CompactBitVector::operator ^=(
+		const CompactBitVector &op2) {
+	value = (value ^ op2.value) & this->getMask();
+	return *this;
+}
+
+inline CompactBitVector CompactBitVector::operator <<(
+		const hvuint32_t &nShift) const {
+	return CompactBitVector(binSize,
+			nShift < binSize ? value << nShift : static_cast<hvuint64_t>(0u));
+}
+
+inline CompactBitVector CompactBitVector::operator >>(
+		const hvuint32_t &nShift) const {
+	return CompactBitVector(binSize,
+			nShift < binSize ? value >> nShift : static_cast<hvuint64_t>(0u));
+}
+
+} // namespace common
+} // namespace hv
+
+#endif // HV_COMPACT_BITVECTOR_H
@@ -14,3 +14,9 @@
   #define HV_CPLUSPLUS_MEMBER_FUNCTION_DEFAULT = default
   #define HV_CPLUSPLUS_MEMBER_FUNCTION_DELETE = delete
 #endif
+
+#if defined(_MSC_VER) && _MSC_VER < 1900
+  #define HV_CPLUSPLUS_CONSTEXPR
+#else
+  #define HV_CPLUSPLUS_CONSTEXPR constexpr
+#endif
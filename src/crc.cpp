@@ -0,0 +1,365 @@
+/**
+ * @file crc.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Configurable CRC engine over raw buffers and BitVectors
+ */
+
+#include "crc.h"
+#ifdef HV_CRC_X86_ACCEL
+#include <immintrin.h>
+#endif
+
+namespace hv {
+namespace common {
+
+/**
+ * Little-endian 64-bit load
+ */
+static inline hvuint64_t loadLe64(const hvuint8_t *p) {
+	return static_cast<hvuint64_t>(p[0])
+			| (static_cast<hvuint64_t>(p[1]) << 8)
+			| (static_cast<hvuint64_t>(p[2]) << 16)
+			| (static_cast<hvuint64_t>(p[3]) << 24)
+			| (static_cast<hvuint64_t>(p[4]) << 32)
+			| (static_cast<hvuint64_t>(p[5]) << 40)
+			| (static_cast<hvuint64_t>(p[6]) << 48)
+			| (static_cast<hvuint64_t>(p[7]) << 56);
+}
+
+/**
+ * Big-endian 64-bit load
+ */
+static inline hvuint64_t loadBe64(const hvuint8_t *p) {
+	return (static_cast<hvuint64_t>(p[0]) << 56)
+			| (static_cast<hvuint64_t>(p[1]) << 48)
+			| (static_cast<hvuint64_t>(p[2]) << 40)
+			| (static_cast<hvuint64_t>(p[3]) << 32)
+			| (static_cast<hvuint64_t>(p[4]) << 24)
+			| (static_cast<hvuint64_t>(p[5]) << 16)
+			| (static_cast<hvuint64_t>(p[6]) << 8)
+			| static_cast<hvuint64_t>(p[7]);
+}
+
+CrcEngine::CrcEngine(const hvuint8_t &width, const hvuint64_t &poly,
+		const hvuint64_t &init, const bool &refIn, const bool &refOut,
+		const hvuint64_t &xorOut) :
+		width(width), poly(poly), init(init), refIn(refIn), refOut(refOut), xorOut(
+				xorOut), mask(HV_LSB_MASK_GEN(hvuint64_t, width)), polyReg(0u), useSse42(
+				false), useClmul(false) {
+	HV_ASSERT((width > 0u) && (width <= 64u),
+			"CRC width must be between 1 and 64 (got {})",
+			static_cast<unsigned int>(width));
+	this->poly &= mask;
+	this->init &= mask;
+	this->xorOut &= mask;
+	polyReg = refIn ? reflect(this->poly, width) : this->poly << (64u - width);
+
+	// Slicing-by-8 tables
+	for (unsigned int b = 0u; b < 256u; b++) {
+		table[0][b] = updateBits(refIn ? b : static_cast<hvuint64_t>(b) << 56,
+				0u, 8u);
+	}
+	for (unsigned int k = 1u; k < 8u; k++) {
+		for (unsigned int b = 0u; b < 256u; b++) {
+			const hvuint64_t prev(table[k - 1u][b]);
+			table[k][b] =
+					refIn ? (prev >> 8) ^ table[0][prev & 0xFFu] :
+							(prev << 8) ^ table[0][prev >> 56];
+		}
+	}
+
+	// Folding constants: the carry-less product of two reflected 64-bit
+	// values is shifted by one bit, hence the -1 on exponents.
+	fold128[0] = reflect(xPowMod(128u + 64u - 1u), 64u);
+	fold128[1] = reflect(xPowMod(128u - 1u), 64u);
+	fold512[0] = reflect(xPowMod(512u + 64u - 1u), 64u);
+	fold512[1] = reflect(xPowMod(512u - 1u), 64u);
+
+	this->setAccelerated(true);
+}
+
+CrcEngine::~CrcEngine() {
+}
+
+const CrcEngine& CrcEngine::getCrc32() {
+	static const CrcEngine engine(32u, 0x04C11DB7u, 0xFFFFFFFFu, true, true,
+			0xFFFFFFFFu);
+	return engine;
+}
+
+const CrcEngine& CrcEngine::getCrc32c() {
+	static const CrcEngine engine(32u, 0x1EDC6F41u, 0xFFFFFFFFu, true, true,
+			0xFFFFFFFFu);
+	return engine;
+}
+
+const CrcEngine& CrcEngine::getCrc64Xz() {
+	static const CrcEngine engine(64u, 0x42F0E1EBA9EA3693ULL,
+			0xFFFFFFFFFFFFFFFFULL, true, true, 0xFFFFFFFFFFFFFFFFULL);
+	return engine;
+}
+
+const CrcEngine& CrcEngine::getCrc64Ecma182() {
+	static const CrcEngine engine(64u, 0x42F0E1EBA9EA3693ULL, 0u, false,
+			false, 0u);
+	return engine;
+}
+
+const CrcEngine& CrcEngine::getCrc16CcittFalse() {
+	static const CrcEngine engine(16u, 0x1021u, 0xFFFFu, false, false, 0u);
+	return engine;
+}
+
+hvuint64_t CrcEngine::compute(const void *buf, const std::size_t &len) const {
+	return this->finalize(this->update(this->start(), buf, len));
+}
+
+hvuint64_t CrcEngine::compute(const BitVector &bv) const {
+	return this->finalize(this->update(this->start(), bv));
+}
+
+hvuint64_t CrcEngine::start() const {
+	return refIn ? reflect(init, width) : init << (64u - width);
+}
+
+hvuint64_t CrcEngine::update(const hvuint64_t &reg, const void *buf,
+		const std::size_t &len) const {
+	const hvuint8_t *p(static_cast<const hvuint8_t*>(buf));
+#ifdef HV_CRC_X86_ACCEL
+	if (useSse42) {
+		return this->updateSse42(reg, p, len);
+	}
+	if (useClmul && (len >= HV_CRC_CLMUL_MIN_LEN)) {
+		return this->updateClmul(reg, p, len);
+	}
+#endif
+	return this->updateTable(reg, p, len);
+}
+
+hvuint64_t CrcEngine::update(const hvuint64_t &reg, const BitVector &bv) const {
+	typedef BitVector::bvdata_t bvdata_t;
+	const std::size_t CHUNK_CELLS(64u);
+	hvuint8_t buf[CHUNK_CELLS * sizeof(bvdata_t)];
+	const bvdata_t *data(bv.getDataAddress());
+	const std::size_t nFullBytes(bv.getSize() / 8u);
+	const unsigned int nTailBits(bv.getSize() % 8u);
+	hvuint64_t ret(reg);
+
+	// Cells are serialized LSB first into a stack buffer, chunk by chunk
+	std::size_t byteCpt(0u);
+	for (std::size_t cell = 0u; byteCpt < nFullBytes; cell += CHUNK_CELLS) {
+		std::size_t n(0u);
+		for (std::size_t i = 0u;
+				(i < CHUNK_CELLS) && (cell + i < bv.getArraySize()); i++) {
+			const bvdata_t w(data[cell + i]);
+			for (std::size_t j = 0u; j < sizeof(bvdata_t); j++) {
+				buf[n++] = static_cast<hvuint8_t>(w >> (8u * j));
+			}
+		}
+		const std::size_t nBytes(HV_MIN(n, nFullBytes - byteCpt));
+		ret = this->update(ret, buf, nBytes);
+		byteCpt += nBytes;
+	}
+	if (nTailBits) {
+		const std::size_t cell(
+				(nFullBytes * 8u) / BITWIDTH_OF(bvdata_t));
+		const unsigned int pos((nFullBytes * 8u) % BITWIDTH_OF(bvdata_t));
+		ret = this->updateBits(ret,
+				static_cast<hvuint8_t>(data[cell] >> pos), nTailBits);
+	}
+	return ret;
+}
+
+hvuint64_t CrcEngine::finalize(const hvuint64_t &reg) const {
+	hvuint64_t ret;
+	if (refIn) {
+		ret = refOut ? reg : reflect(reg, width);
+	} else {
+		ret = reg >> (64u - width);
+		ret = refOut ? reflect(ret, width) : ret;
+	}
+	return (ret ^ xorOut) & mask;
+}
+
+hvuint8_t CrcEngine::getWidth() const {
+	return width;
+}
+
+hvuint64_t CrcEngine::getPoly() const {
+	return poly;
+}
+
+hvuint64_t CrcEngine::getInit() const {
+	return init;
+}
+
+bool CrcEngine::getRefIn() const {
+	return refIn;
+}
+
+bool CrcEngine::getRefOut() const {
+	return refOut;
+}
+
+hvuint64_t CrcEngine::getXorOut() const {
+	return xorOut;
+}
+
+void CrcEngine::setAccelerated(const bool &enable) {
+	useSse42 = false;
+	useClmul = false;
+#ifdef HV_CRC_X86_ACCEL
+	if (enable) {
+		useSse42 = (width == 32u) && (poly == 0x1EDC6F41u) && refIn
+				&& __builtin_cpu_supports("sse4.2");
+		useClmul = !useSse42 && refIn && __builtin_cpu_supports("pclmul")
+				&& __builtin_cpu_supports("sse4.1");
+	}
+#else
+	(void) enable;
+#endif
+}
+
+bool CrcEngine::isAccelerated() const {
+	return useSse42 || useClmul;
+}
+
+hvuint64_t CrcEngine::updateTable(hvuint64_t reg, const hvuint8_t *p,
+		std::size_t len) const {
+	if (refIn) {
+		for (; len >= 8u; len -= 8u, p += 8u) {
+			const hvuint64_t x(reg ^ loadLe64(p));
+			reg = table[7][x & 0xFFu] ^ table[6][(x >> 8) & 0xFFu]
+					^ table[5][(x >> 16) & 0xFFu] ^ table[4][(x >> 24) & 0xFFu]
+					^ table[3][(x >> 32) & 0xFFu] ^ table[2][(x >> 40) & 0xFFu]
+					^ table[1][(x >> 48) & 0xFFu] ^ table[0][x >> 56];
+		}
+		for (; len; len--, p++) {
+			reg = (reg >> 8) ^ table[0][(reg ^ *p) & 0xFFu];
+		}
+	} else {
+		for (; len >= 8u; len -= 8u, p += 8u) {
+			const hvuint64_t x(reg ^ loadBe64(p));
+			reg = table[7][x >> 56] ^ table[6][(x >> 48) & 0xFFu]
+					^ table[5][(x >> 40) & 0xFFu] ^ table[4][(x >> 32) & 0xFFu]
+					^ table[3][(x >> 24) & 0xFFu] ^ table[2][(x >> 16) & 0xFFu]
+					^ table[1][(x >> 8) & 0xFFu] ^ table[0][x & 0xFFu];
+		}
+		for (; len; len--, p++) {
+			reg = (reg << 8) ^ table[0][((reg >> 56) ^ *p) & 0xFFu];
+		}
+	}
+	return reg;
+}
+
+hvuint64_t CrcEngine::updateBits(hvuint64_t reg, const hvuint8_t &bits,
+		const unsigned int &nBits) const {
+	for (unsigned int i = 0u; i < nBits; i++) {
+		if (refIn) {
+			reg ^= (bits >> i) & 1u;
+			reg = (reg & 1u) ? (reg >> 1) ^ polyReg : reg >> 1;
+		} else {
+			reg ^= static_cast<hvuint64_t>((bits >> (nBits - i - 1u)) & 1u)
+					<< 63;
+			reg = (reg >> 63) ? (reg << 1) ^ polyReg : reg << 1;
+		}
+	}
+	return reg;
+}
+
+#ifdef HV_CRC_X86_ACCEL
+__attribute__((target("sse4.2")))
+hvuint64_t CrcEngine::updateSse42(hvuint64_t reg, const hvuint8_t *p,
+		std::size_t len) const {
+	for (; len >= 8u; len -= 8u, p += 8u) {
+		reg = _mm_crc32_u64(reg, loadLe64(p));
+	}
+	for (; len; len--, p++) {
+		reg = _mm_crc32_u8(static_cast<hvuint32_t>(reg), *p);
+	}
+	return reg;
+}
+
+/**
+ * Folds a 128-bit accumulator by the distance encoded in k
+ */
+__attribute__((target("pclmul,sse4.1")))
+static inline __m128i clmulFold(const __m128i &a, const __m128i &k) {
+	return _mm_xor_si128(_mm_clmulepi64_si128(a, k, 0x00),
+			_mm_clmulepi64_si128(a, k, 0x11));
+}
+
+__attribute__((target("pclmul,sse4.1")))
+hvuint64_t CrcEngine::updateClmul(hvuint64_t reg, const hvuint8_t *p,
+		std::size_t len) const {
+	// Register is merged into the first 8 bytes, so folding starts from a
+	// zero register
+	const __m128i k128(
+			_mm_set_epi64x(static_cast<long long>(fold128[1]),
+					static_cast<long long>(fold128[0])));
+	const __m128i k512(
+			_mm_set_epi64x(static_cast<long long>(fold512[1]),
+					static_cast<long long>(fold512[0])));
+	const __m128i *p128(reinterpret_cast<const __m128i*>(p));
+	__m128i a0(
+			_mm_xor_si128(_mm_loadu_si128(p128),
+					_mm_cvtsi64_si128(static_cast<long long>(reg))));
+	__m128i a1(_mm_loadu_si128(p128 + 1));
+	__m128i a2(_mm_loadu_si128(p128 + 2));
+	__m128i a3(_mm_loadu_si128(p128 + 3));
+	p128 += 4;
+	len -= 64u;
+
+	// 4 independent accumulators, folded by 512 bits
+	for (; len >= 64u; len -= 64u, p128 += 4) {
+		a0 = _mm_xor_si128(clmulFold(a0, k512), _mm_loadu_si128(p128));
+		a1 = _mm_xor_si128(clmulFold(a1, k512), _mm_loadu_si128(p128 + 1));
+		a2 = _mm_xor_si128(clmulFold(a2, k512), _mm_loadu_si128(p128 + 2));
+		a3 = _mm_xor_si128(clmulFold(a3, k512), _mm_loadu_si128(p128 + 3));
+	}
+
+	// Reduction to a single accumulator, then 128-bit folding
+	__m128i a(_mm_xor_si128(clmulFold(a0, k128), a1));
+	a = _mm_xor_si128(clmulFold(a, k128), a2);
+	a = _mm_xor_si128(clmulFold(a, k128), a3);
+	for (; len >= 16u; len -= 16u, p128++) {
+		a = _mm_xor_si128(clmulFold(a, k128), _mm_loadu_si128(p128));
+	}
+
+	// Accumulator is congruent to the processed data: its CRC with a zero
+	// register gives the register value
+	hvuint8_t buf[16];
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(buf), a);
+	reg = this->updateTable(0u, buf, 16u);
+	return this->updateTable(reg, reinterpret_cast<const hvuint8_t*>(p128),
+			len);
+}
+#endif
+
+hvuint64_t CrcEngine::reflect(hvuint64_t x, const unsigned int &n) {
+	hvuint64_t ret(0u);
+	for (unsigned int i = 0u; i < n; i++) {
+		ret = (ret << 1) | (x & 1u);
+		x >>= 1;
+	}
+	return ret;
+}
+
+hvuint64_t CrcEngine::xPowMod(const unsigned int &n) const {
+	const hvuint64_t topBit(static_cast<hvuint64_t>(1u) << (width - 1u));
+	hvuint64_t ret(1u);
+	for (unsigned int i = 0u; i < n; i++) {
+		const bool carry(ret & topBit);
+		ret = (ret << 1) & mask;
+		if (carry) {
+			ret ^= poly;
+		}
+	}
+	return ret;
+}
+
+} // namespace common
+} // namespace hv
@@ -0,0 +1,284 @@
+/**
+ * @file crc.h
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Configurable CRC engine over raw buffers and BitVectors
+ */
+
+#ifndef HV_CRC_H
+#define HV_CRC_H
+
+#include <cstddef>
+#include "datatypes.h"
+#include "bitvector.h"
+
+/**
+ * x86-64 acceleration (SSE4.2 crc32 and PCLMULQDQ folding), selected at
+ * runtime. Define HV_CRC_NO_ACCEL to build portable table-driven code only.
+ */
+#if !defined(HV_CRC_NO_ACCEL) && defined(__GNUC__) && defined(__x86_64__)
+#define HV_CRC_X86_ACCEL
+#endif
+
+/**
+ * Minimum buffer length (bytes) for PCLMULQDQ folding
+ */
+#define HV_CRC_CLMUL_MIN_LEN 128
+
+namespace hv {
+namespace common {
+
+/**
+ * Configurable CRC engine
+ *
+ * CRCs are parameterized the usual way (Rocksoft model): width (1 to 64),
+ * polynomial, initial value, input/output reflection and output XOR.
+ *
+ * Computation uses slicing-by-8 tables. On x86-64 hosts, CRC-32C uses the
+ * SSE4.2 crc32 instruction and other reflected CRCs use PCLMULQDQ folding
+ * on large buffers, when supported by the CPU.
+ *
+ * Incremental computation:
+ * @code
+ * hvuint64_t reg(engine.start());
+ * reg = engine.update(reg, buf1, len1);
+ * reg = engine.update(reg, buf2, len2);
+ * hvuint64_t crc(engine.finalize(reg));
+ * @endcode
+ */
+class CrcEngine {
+public:
+	/**
+	 * Constructor
+	 * @param width CRC width in bits (1 to 64)
+	 * @param poly Polynomial (normal representation, without x^width term)
+	 * @param init Initial register value
+	 * @param refIn Input bytes are reflected (LSB first)
+	 * @param refOut Output CRC is reflected
+	 * @param xorOut Value XORed with the final CRC
+	 */
+	CrcEngine(const hvuint8_t &width, const hvuint64_t &poly,
+			const hvuint64_t &init, const bool &refIn, const bool &refOut,
+			const hvuint64_t &xorOut);
+
+	virtual ~CrcEngine();
+
+	//** Presets **//
+	/**
+	 * CRC-32 (Ethernet, zlib, PCIe ECRC)
+	 * @return Engine reference
+	 */
+	static const CrcEngine& getCrc32();
+
+	/**
+	 * CRC-32C (Castagnoli; iSCSI, NVMe, ext4)
+	 * @return Engine reference
+	 */
+	static const CrcEngine& getCrc32c();
+
+	/**
+	 * CRC-64/XZ (ECMA-182 polynomial, reflected)
+	 * @return Engine reference
+	 */
+	static const CrcEngine& getCrc64Xz();
+
+	/**
+	 * CRC-64/ECMA-182
+	 * @return Engine reference
+	 */
+	static const CrcEngine& getCrc64Ecma182();
+
+	/**
+	 * CRC-16/CCITT-FALSE
+	 * @return Engine reference
+	 */
+	static const CrcEngine& getCrc16CcittFalse();
+
+	//** Computation **//
+	/**
+	 * CRC of a byte buffer
+	 * @param buf Buffer address
+	 * @param len Buffer length in bytes
+	 * @return CRC
+	 */
+	hvuint64_t compute(const void *buf, const std::size_t &len) const;
+
+	/**
+	 * CRC of a BitVector
+	 *
+	 * The BitVector is processed as a byte stream starting from its LSB
+	 * (bits 7..0 form the first byte). If the size is not a multiple of
+	 * 8, the remaining MSB bits are processed as a last partial byte.
+	 * @param bv BitVector
+	 * @return CRC
+	 */
+	hvuint64_t compute(const BitVector &bv) const;
+
+	/**
+	 * Initial register for incremental computation
+	 * @return Register
+	 */
+	hvuint64_t start() const;
+
+	/**
+	 * Update register with a byte buffer
+	 * @param reg Register
+	 * @param buf Buffer address
+	 * @param len Buffer length in bytes
+	 * @return Updated register
+	 */
+	hvuint64_t update(const hvuint64_t &reg, const void *buf,
+			const std::size_t &len) const;
+
+	/**
+	 * Update register with a BitVector (see compute(const BitVector&))
+	 * @param reg Register
+	 * @param bv BitVector
+	 * @return Updated register
+	 */
+	hvuint64_t update(const hvuint64_t &reg, const BitVector &bv) const;
+
+	/**
+	 * Final CRC from register
+	 * @param reg Register
+	 * @return CRC
+	 */
+	hvuint64_t finalize(const hvuint64_t &reg) const;
+
+	//** Accessors **//
+	/**
+	 * Get CRC width
+	 * @return Width in bits
+	 */
+	hvuint8_t getWidth() const;
+
+	/**
+	 * Get polynomial
+	 * @return Polynomial (normal representation)
+	 */
+	hvuint64_t getPoly() const;
+
+	/**
+	 * Get initial register value
+	 * @return Initial value
+	 */
+	hvuint64_t getInit() const;
+
+	/**
+	 * Get input reflection
+	 * @return True if input bytes are reflected
+	 */
+	bool getRefIn() const;
+
+	/**
+	 * Get output reflection
+	 * @return True if output CRC is reflected
+	 */
+	bool getRefOut() const;
+
+	/**
+	 * Get output XOR value
+	 * @return Output XOR value
+	 */
+	hvuint64_t getXorOut() const;
+
+	/**
+	 * Enable or disable hardware acceleration (enabled by default when the
+	 * CPU supports it)
+	 * @param enable True to enable acceleration
+	 */
+	void setAccelerated(const bool &enable);
+
+	/**
+	 * Checks whether hardware acceleration is used
+	 * @return True if accelerated
+	 */
+	bool isAccelerated() const;
+
+protected:
+	/**
+	 * Update register with a byte buffer using slicing-by-8 tables
+	 */
+	hvuint64_t updateTable(hvuint64_t reg, const hvuint8_t *p,
+			std::size_t len) const;
+
+	/**
+	 * Update register with nBits bits, bit by bit
+	 */
+	hvuint64_t updateBits(hvuint64_t reg, const hvuint8_t &bits,
+			const unsigned int &nBits) const;
+
+#ifdef HV_CRC_X86_ACCEL
+	/**
+	 * Update register using SSE4.2 crc32 (CRC-32C only)
+	 */
+	hvuint64_t updateSse42(hvuint64_t reg, const hvuint8_t *p,
+			std::size_t len) const;
+
+	/**
+	 * Update register using PCLMULQDQ folding (reflected CRCs only)
+	 * len must be >= HV_CRC_CLMUL_MIN_LEN
+	 */
+	hvuint64_t updateClmul(hvuint64_t reg, const hvuint8_t *p,
+			std::size_t len) const;
+#endif
+
+	/**
+	 * Reflect the n LSBs of a value
+	 * @param x Value
+	 * @param n Number of bits
+	 * @return Reflected value
+	 */
+	static hvuint64_t reflect(hvuint64_t x, const unsigned int &n);
+
+	/**
+	 * x^n mod poly (normal representation)
+	 * @param n Exponent
+	 * @return Remainder
+	 */
+	hvuint64_t xPowMod(const unsigned int &n) const;
+
+	/**
+	 * CRC parameters
+	 */
+	hvuint8_t width;
+	hvuint64_t poly;
+	hvuint64_t init;
+	bool refIn;
+	bool refOut;
+	hvuint64_t xorOut;
+
+	/**
+	 * Mask of the width LSBs
+	 */
+	hvuint64_t mask;
+
+	/**
+	 * Bit-serial polynomial: reflected, or left-aligned on 64 bits
+	 */
+	hvuint64_t polyReg;
+
+	/**
+	 * Slicing-by-8 tables
+	 */
+	hvuint64_t table[8][256];
+
+	/**
+	 * Hardware acceleration
+	 */
+	bool useSse42;
+	bool useClmul;
+
+	/**
+	 * PCLMULQDQ folding constants (128-bit and 512-bit folding distances)
+	 */
+	hvuint64_t fold128[2];
+	hvuint64_t fold512[2];
+};
+
+} // namespace common
+} // namespace hv
+
+#endif // HV_CRC_H
@@ -29,6 +29,16 @@ typedef int16_t hvint16_t;
 typedef int32_t hvint32_t;
 typedef int64_t hvint64_t;
 
+/**
+ * 128-bit integers, only defined if the compiler supports them
+ * (HV_HAS_INT128 is then defined)
+ */
+#ifdef __SIZEOF_INT128__
+#define HV_HAS_INT128
+__extension__ typedef unsigned __int128 hvuint128_t;
+__extension__ typedef __int128 hvint128_t;
+#endif
+
 typedef hvuint64_t hvaddr_t;
 
 typedef hvuint64_t hvcbID_t;
@@ -0,0 +1,219 @@
+/**
+ * @file ecc.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Hamming SECDED error correcting code for memory models
+ */
+
+#include <cstring>
+#include "ecc.h"
+
+namespace hv {
+namespace common {
+
+typedef BitVector::bvdata_t bvdata_t;
+typedef BitVector::bvsize_t bvsize_t;
+
+/**
+ * Number of 64-bit words in the largest data word
+ */
+#define HV_ECC_MAX_WORDS64 (HV_ECC_MAX_DATA_WIDTH / 64)
+
+/**
+ * Flip a bit of a BitVector, propagating to the parent BitVector, if any
+ * @param bv BitVector
+ * @param ind Bit index
+ */
+static inline void flipBit(BitVector &bv, const unsigned int &ind) {
+	bv.getDataAddress()[ind / BITWIDTH_OF(bvdata_t)] ^= HV_BIT_MASK_GEN(
+			bvdata_t, ind % BITWIDTH_OF(bvdata_t));
+	bv.syncParent();
+}
+
+Secded::Secded(const bvsize_t &dataWidth) :
+		dataWidth(dataWidth), nHamming(0u), nWords64(0u), maskLastWord(0u) {
+	HV_ASSERT((dataWidth > 0u) && (dataWidth <= HV_ECC_MAX_DATA_WIDTH),
+			"SECDED data width must be between 1 and {} (got {})",
+			HV_ECC_MAX_DATA_WIDTH, dataWidth);
+	while ((1u << nHamming) < dataWidth + nHamming + 1u) {
+		nHamming++;
+	}
+	nWords64 = (dataWidth - 1u) / 64u + 1u;
+	maskLastWord = HV_LSB_MASK_GEN(hvuint64_t,
+			dataWidth % 64u ? dataWidth % 64u : 64u);
+
+	// Data bits take non-power-of-2 positions, in order
+	masks.assign(nHamming * nWords64, 0u);
+	posToData.assign(1u << nHamming, -1);
+	unsigned int pos(1u);
+	for (unsigned int i = 0u; i < dataWidth; i++) {
+		while (!(pos & (pos - 1u))) {
+			pos++;
+		}
+		posToData[pos] = static_cast<int>(i);
+		for (unsigned int j = 0u; j < nHamming; j++) {
+			if (pos & (1u << j)) {
+				masks[j * nWords64 + i / 64u] |= HV_BIT_MASK_GEN(hvuint64_t,
+						i % 64u);
+			}
+		}
+		pos++;
+	}
+}
+
+Secded::~Secded() {
+}
+
+bvsize_t Secded::getDataWidth() const {
+	return dataWidth;
+}
+
+unsigned int Secded::getCheckWidth() const {
+	return nHamming + 1u;
+}
+
+hvuint32_t Secded::encode(const hvuint64_t *data) const {
+	const hvuint32_t hamming(this->computeHamming(data));
+	const bool p(this->computeParity(data) ^ parity(hamming));
+	return hamming | (static_cast<hvuint32_t>(p) << nHamming);
+}
+
+BitVector Secded::encode(const BitVector &data) const {
+	hvuint64_t words[HV_ECC_MAX_WORDS64] = { 0u };
+	toWords(data, words, nWords64);
+	return BitVector(static_cast<bvsize_t>(this->getCheckWidth()),
+			this->encode(words));
+}
+
+hveccstatus_t Secded::decode(hvuint64_t *data, hvuint32_t &check) const {
+	const hvuint32_t hammingMask(HV_LSB_MASK_GEN(hvuint32_t, nHamming));
+	const hvuint32_t syndrome(this->computeHamming(data) ^ (check & hammingMask));
+	const bool p(
+			this->computeParity(data)
+					^ parity(check & HV_LSB_MASK_GEN(hvuint32_t, nHamming + 1u)));
+	if (!p) {
+		// Even number of flipped bits
+		return syndrome ? ECC_UNCORRECTABLE : ECC_OK;
+	}
+	if (!syndrome) {
+		// Overall parity bit
+		check ^= HV_BIT_MASK_GEN(hvuint32_t, nHamming);
+	} else if (!(syndrome & (syndrome - 1u))) {
+		// Hamming check bit
+		check ^= syndrome;
+	} else {
+		const int ind(this->getDataIndex(syndrome));
+		if (ind < 0) {
+			return ECC_UNCORRECTABLE;
+		}
+		data[ind / 64] ^= HV_BIT_MASK_GEN(hvuint64_t, ind % 64);
+	}
+	return ECC_CORRECTED;
+}
+
+hveccstatus_t Secded::decode(BitVector &data, BitVector &check) const {
+	hvuint64_t words[HV_ECC_MAX_WORDS64] = { 0u }, orig[HV_ECC_MAX_WORDS64];
+	toWords(data, words, nWords64);
+	std::memcpy(orig, words, nWords64 * sizeof(hvuint64_t));
+	const hvuint32_t checkIn(static_cast<hvuint32_t>(check));
+	hvuint32_t checkOut(checkIn);
+	const hveccstatus_t ret(this->decode(words, checkOut));
+	if (ret == ECC_CORRECTED) {
+		// Exactly one bit was flipped, in check bits or in data
+		if (checkOut != checkIn) {
+			flipBit(check, countTrailingZeros(checkOut ^ checkIn));
+		} else {
+			for (unsigned int i = 0u; i < nWords64; i++) {
+				if (orig[i] != words[i]) {
+					flipBit(data,
+							i * 64u + countTrailingZeros(orig[i] ^ words[i]));
+					break;
+				}
+			}
+		}
+	}
+	return ret;
+}
+
+void Secded::encode(const void *buf, const std::size_t &nWords,
+		hvuint32_t *checks) const {
+	HV_ASSERT(!(dataWidth % 8u),
+			"Batch SECDED requires a data width multiple of 8 (got {})",
+			dataWidth);
+	const std::size_t nBytes(dataWidth / 8u);
+	const hvuint8_t *p(static_cast<const hvuint8_t*>(buf));
+	hvuint64_t words[HV_ECC_MAX_WORDS64] = { 0u };
+	for (std::size_t i = 0u; i < nWords; i++, p += nBytes) {
+		std::memcpy(words, p, nBytes);
+		checks[i] = this->encode(words);
+	}
+}
+
+hveccstatus_t Secded::decode(void *buf, const std::size_t &nWords,
+		hvuint32_t *checks, hveccstatus_t *status) const {
+	HV_ASSERT(!(dataWidth % 8u),
+			"Batch SECDED requires a data width multiple of 8 (got {})",
+			dataWidth);
+	const std::size_t nBytes(dataWidth / 8u);
+	hvuint8_t *p(static_cast<hvuint8_t*>(buf));
+	hvuint64_t words[HV_ECC_MAX_WORDS64] = { 0u };
+	hveccstatus_t ret(ECC_OK);
+	for (std::size_t i = 0u; i < nWords; i++, p += nBytes) {
+		std::memcpy(words, p, nBytes);
+		const hveccstatus_t s(this->decode(words, checks[i]));
+		if (s == ECC_CORRECTED) {
+			std::memcpy(p, words, nBytes);
+		}
+		if (status != nullptr) {
+			status[i] = s;
+		}
+		ret = HV_MAX(ret, s);
+	}
+	return ret;
+}
+
+int Secded::getDataIndex(const unsigned int &pos) const {
+	return pos < posToData.size() ? posToData[pos] : -1;
+}
+
+hvuint32_t Secded::computeHamming(const hvuint64_t *data) const {
+	hvuint32_t ret(0u);
+	const hvuint64_t *mask(masks.data());
+	switch (nWords64) {
+	// 64-bit and 128-bit words: unrolled
+	case 1u:
+		for (unsigned int j = 0u; j < nHamming; j++) {
+			ret |= static_cast<hvuint32_t>(parity(data[0] & mask[j])) << j;
+		}
+		break;
+	case 2u:
+		for (unsigned int j = 0u; j < nHamming; j++, mask += 2) {
+			ret |= static_cast<hvuint32_t>(parity(
+					(data[0] & mask[0]) ^ (data[1] & mask[1]))) << j;
+		}
+		break;
+	default:
+		for (unsigned int j = 0u; j < nHamming; j++) {
+			hvuint64_t acc(0u);
+			for (unsigned int i = 0u; i < nWords64; i++) {
+				acc ^= data[i] & *mask++;
+			}
+			ret |= static_cast<hvuint32_t>(parity(acc)) << j;
+		}
+		break;
+	}
+	return ret;
+}
+
+bool Secded::computeParity(const hvuint64_t *data) const {
+	hvuint64_t acc(data[nWords64 - 1u] & maskLastWord);
+	for (unsigned int i = 0u; i + 1u < nWords64; i++) {
+		acc ^= data[i];
+	}
+	return parity(acc);
+}
+
+} // namespace common
+} // namespace hv
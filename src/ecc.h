@@ -0,0 +1,179 @@
+/**
+ * @file ecc.h
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Hamming SECDED error correcting code for memory models
+ */
+
+#ifndef HV_ECC_H
+#define HV_ECC_H
+
+#include <cstddef>
+#include <vector>
+#include "datatypes.h"
+#include "bitvector.h"
+
+/**
+ * Maximum data width protected by a single SECDED code word
+ */
+#define HV_ECC_MAX_DATA_WIDTH 4096
+
+namespace hv {
+namespace common {
+
+/**
+ * ECC decoding status
+ */
+typedef enum {
+	ECC_OK = 0,            // No error
+	ECC_CORRECTED = 1,     // Single-bit error corrected (data or check bits)
+	ECC_UNCORRECTABLE = 2  // Multi-bit error detected, data left unchanged
+} hveccstatus_t;
+
+/**
+ * Hamming SECDED (single error correction, double error detection) code
+ *
+ * A k-bit data word is protected by r Hamming check bits, with r the
+ * smallest value such that 2^r >= k + r + 1, plus one overall parity bit:
+ * 8 check bits for 64-bit words, 9 for 128-bit words.
+ * Check bits are returned as a (r + 1)-bit value, the overall parity bit
+ * being the MSB.
+ *
+ * Each Hamming check bit is the parity of the data bits selected by a
+ * precomputed column mask, so that encoding and syndrome computation only
+ * use word-level AND and popcount.
+ */
+class Secded {
+public:
+	/**
+	 * Constructor
+	 * @param dataWidth Data word width in bits (1 to HV_ECC_MAX_DATA_WIDTH)
+	 */
+	explicit Secded(const BitVector::bvsize_t &dataWidth);
+
+	virtual ~Secded();
+
+	/**
+	 * Get data word width
+	 * @return Width in bits
+	 */
+	BitVector::bvsize_t getDataWidth() const;
+
+	/**
+	 * Get number of check bits, including the overall parity bit
+	 * @return Width in bits
+	 */
+	unsigned int getCheckWidth() const;
+
+	//** Single word **//
+	/**
+	 * Compute check bits of a data word
+	 * @param data Data word as 64-bit little-endian words (bits beyond the
+	 * data width are ignored)
+	 * @return Check bits
+	 */
+	hvuint32_t encode(const hvuint64_t *data) const;
+
+	/**
+	 * Compute check bits of a data word
+	 * @param data Data word (getDataWidth() bits)
+	 * @return Check bits (getCheckWidth() bits)
+	 */
+	BitVector encode(const BitVector &data) const;
+
+	/**
+	 * Check a data word against its check bits, correcting single-bit errors
+	 * @param data Data word as 64-bit little-endian words, corrected in place
+	 * @param check Check bits, corrected in place
+	 * @return Decoding status
+	 */
+	hveccstatus_t decode(hvuint64_t *data, hvuint32_t &check) const;
+
+	/**
+	 * Check a data word against its check bits, correcting single-bit errors
+	 * @param data Data word (getDataWidth() bits), corrected in place
+	 * @param check Check bits (getCheckWidth() bits), corrected in place
+	 * @return Decoding status
+	 */
+	hveccstatus_t decode(BitVector &data, BitVector &check) const;
+
+	//** Batch **//
+	/**
+	 * Compute check bits of a buffer of consecutive data words
+	 * The data width must be a multiple of 8, each word occupying
+	 * getDataWidth() / 8 bytes in little-endian order.
+	 * @param buf Buffer address
+	 * @param nWords Number of data words
+	 * @param checks Output check bits, one per data word
+	 */
+	void encode(const void *buf, const std::size_t &nWords,
+			hvuint32_t *checks) const;
+
+	/**
+	 * Check and correct a buffer of consecutive data words (see
+	 * encode(const void*, const std::size_t&, hvuint32_t*))
+	 * @param buf Buffer address, corrected in place
+	 * @param nWords Number of data words
+	 * @param checks Check bits, one per data word, corrected in place
+	 * @param status Optional output status, one per data word
+	 * @return Worst status over the buffer
+	 */
+	hveccstatus_t decode(void *buf, const std::size_t &nWords,
+			hvuint32_t *checks, hveccstatus_t *status = nullptr) const;
+
+	/**
+	 * Data bit index at a given Hamming position
+	 * @param pos Hamming position (1 to data width + r)
+	 * @return Data bit index, -1 if pos is a check bit position
+	 */
+	int getDataIndex(const unsigned int &pos) const;
+
+protected:
+	/**
+	 * Hamming check bits of a data word
+	 */
+	hvuint32_t computeHamming(const hvuint64_t *data) const;
+
+	/**
+	 * Parity of a data word
+	 */
+	bool computeParity(const hvuint64_t *data) const;
+
+	/**
+	 * Data word width
+	 */
+	BitVector::bvsize_t dataWidth;
+
+	/**
+	 * Number of Hamming check bits (without overall parity)
+	 */
+	unsigned int nHamming;
+
+	/**
+	 * Number of 64-bit words per data word
+	 */
+	unsigned int nWords64;
+
+	/**
+	 * Mask of valid bits in the last 64-bit word
+	 */
+	hvuint64_t maskLastWord;
+
+	/**
+	 * Column masks: data bits covered by each Hamming check bit
+	 * (nHamming x nWords64)
+	 */
+	std::vector<hvuint64_t> masks;
+
+	/**
+	 * Hamming position to data bit index (-1 for check bit positions)
+	 */
+	std::vector<int> posToData;
+};
+
+} // namespace common
+} // namespace hv
+
+#endif // HV_ECC_H
@@ -0,0 +1,931 @@
+/**
+ * @file fixedpoint.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Bit-accurate fixed-point numbers for DSP models
+ */
+
+#include <cmath>
+#include <vector>
+#include "hvutils.h"
+#include "fixedpoint.h"
+
+#ifdef HV_HAS_INT128
+
+namespace hv {
+namespace common {
+
+typedef BitVector::bvdata_t bvdata_t;
+typedef BitVector::bvsize_t bvsize_t;
+
+/**
+ * Exact intermediate values
+ */
+typedef hvint128_t fxint_t;
+typedef hvuint128_t fxuint_t;
+
+/**
+ * Largest bit length of intermediate values, sign excluded
+ */
+#define HV_FX_MAX_INTERMEDIATE_BITS 126u
+
+/**
+ * Bit length of the magnitude of an intermediate value
+ */
+static inline unsigned int bitLength(const hvint64_t &v) {
+	return 64u - countLeadingZeros(
+			static_cast<hvuint64_t>(v < 0 ? ~v : v));
+}
+
+static inline unsigned int bitLength(const fxint_t &v) {
+	const fxuint_t m(v < 0 ? ~static_cast<fxuint_t>(v) : static_cast<fxuint_t>(v));
+	const hvuint64_t hi(static_cast<hvuint64_t>(m >> 64));
+	return hi ? 128u - countLeadingZeros(hi) :
+			64u - countLeadingZeros(static_cast<hvuint64_t>(m));
+}
+
+/**
+ * Scale an intermediate value by 2^shift (shift >= 0, bitLength(v) + shift
+ * within HV_FX_MAX_INTERMEDIATE_BITS)
+ */
+static inline fxint_t align(const fxint_t &v, const int &shift) {
+	return static_cast<fxint_t>(static_cast<fxuint_t>(v) << shift);
+}
+
+/**
+ * Check if any value of a format scaled by 2^shift (shift >= 0) keeps a
+ * given number of bits
+ */
+static inline bool fits(const FixedPointFormat &format, const int &shift,
+		const unsigned int &bits) {
+	return format.getWidth() + static_cast<unsigned int>(shift) <= bits;
+}
+
+/**
+ * Floor division with sticky bit
+ * @param n Numerator
+ * @param d Denominator (non-zero)
+ * @param sticky Set if the division is inexact
+ * @return floor(n / d)
+ */
+static inline fxint_t floorDiv(const fxint_t &n, const fxint_t &d,
+		bool &sticky) {
+	fxint_t q(n / d);
+	const fxint_t r(n % d);
+	sticky = r != 0;
+	if (sticky && ((r < 0) != (d < 0))) {
+		q -= 1;
+	}
+	return q;
+}
+
+/**
+ * Wrap a raw value into a format width
+ */
+static inline hvint64_t wrapRaw(const hvint64_t &raw,
+		const FixedPointFormat &format) {
+	const unsigned int w(format.getWidth());
+	hvuint64_t x(static_cast<hvuint64_t>(raw) & HV_LSB_MASK_GEN(hvuint64_t, w));
+	if (format.isSigned() && ((x >> (w - 1u)) & 1u)) {
+		x |= ~HV_LSB_MASK_GEN(hvuint64_t, w);
+	}
+	return static_cast<hvint64_t>(x);
+}
+
+/**
+ * Quantize and overflow an exact value into a format
+ * @param v Exact value, times 2^frac, of at most MAX_BITS bits
+ * @param frac Fractional bits of v
+ * @param format Destination format
+ * @return Raw value in the destination format
+ */
+template<typename S, typename U, unsigned int MAX_BITS> static inline hvint64_t quantize(
+		S v, int frac, const FixedPointFormat &format) {
+	const int fw(format.getFracWidth());
+	const bool negative(v < 0);
+	bool overflow(false);
+	if (frac > fw) {
+		// Beyond the intermediate width, only the sign of v matters
+		if (frac - fw > static_cast<int>(MAX_BITS)) {
+			v = (v > 0) - (v < 0);
+			frac = fw + static_cast<int>(MAX_BITS);
+		}
+		const int s(frac - fw);
+		const S q(v >> s);
+		const U rem(static_cast<U>(v) - (static_cast<U>(q) << s));
+		const U half(static_cast<U>(1u) << (s - 1));
+		bool up(false);
+		switch (format.getQuant()) {
+		case FX_RND:
+			up = rem >= half;
+			break;
+		case FX_RND_ZERO:
+			up = (rem > half) || ((rem == half) && negative);
+			break;
+		case FX_RND_MIN_INF:
+			up = rem > half;
+			break;
+		case FX_RND_INF:
+			up = (rem > half) || ((rem == half) && !negative);
+			break;
+		case FX_RND_CONV:
+			up = (rem > half) || ((rem == half) && (q & 1));
+			break;
+		case FX_TRN:
+			break;
+		case FX_TRN_ZERO:
+			up = negative && rem;
+			break;
+		}
+		v = q + up;
+	} else if (frac < fw) {
+		const int s(fw - frac);
+		if (v
+				&& (bitLength(v) + static_cast<unsigned int>(s)
+						> BITWIDTH_OF(S) - 1u)) {
+			// Out of S, hence of any format: wrapping keeps the low bits only,
+			// which are zeros beyond 64
+			overflow = true;
+			v = s < 64 ? static_cast<S>(static_cast<U>(v) << s) : 0;
+		} else {
+			v = static_cast<S>(static_cast<U>(v) << s);
+		}
+	}
+
+	overflow = overflow || (v < format.getMinRaw()) || (v > format.getMaxRaw());
+	if (!overflow) {
+		return static_cast<hvint64_t>(v);
+	}
+	switch (format.getOverflow()) {
+	case FX_SAT:
+		return negative ? format.getMinRaw() : format.getMaxRaw();
+	case FX_SAT_ZERO:
+		return 0;
+	case FX_SAT_SYM:
+		return negative ?
+				(format.isSigned() ? -format.getMaxRaw() : 0) : format.getMaxRaw();
+	case FX_WRAP:
+	default:
+		return wrapRaw(static_cast<hvint64_t>(v), format);
+	}
+}
+
+/**
+ * Quantize with 64-bit arithmetic when the value allows it
+ */
+static inline hvint64_t quantize(const fxint_t &v, const int &frac,
+		const FixedPointFormat &format) {
+	const hvint64_t v64(static_cast<hvint64_t>(v));
+	if ((v64 == v) && (bitLength(v64) <= 62u)) {
+		return quantize<hvint64_t, hvuint64_t, 62u>(v64, frac, format);
+	}
+	return quantize<fxint_t, fxuint_t, HV_FX_MAX_INTERMEDIATE_BITS>(v, frac,
+			format);
+}
+
+/**
+ * Quantize a * 2^sa + b * 2^sb (sa, sb >= 0) into a format
+ */
+static inline hvint64_t quantizeSum(const hvint64_t &a, const int &sa,
+		const hvint64_t &b, const int &sb, const int &frac,
+		const FixedPointFormat &format) {
+	if ((bitLength(a) + static_cast<unsigned int>(sa) <= 61u)
+			&& (bitLength(b) + static_cast<unsigned int>(sb) <= 61u)) {
+		return quantize<hvint64_t, hvuint64_t, 62u>(
+				static_cast<hvint64_t>(static_cast<hvuint64_t>(a) << sa)
+						+ static_cast<hvint64_t>(static_cast<hvuint64_t>(b) << sb),
+				frac, format);
+	}
+	return quantize(align(a, sa) + align(b, sb), frac, format);
+}
+
+//** Multi-word kernels **//
+/**
+ * Wide exact value: two's complement cells, least significant first
+ */
+typedef std::vector<bvdata_t> fxwide_t;
+
+/**
+ * Bit width of a cell
+ */
+#define HV_FX_CELL_BITS BITWIDTH_OF(bvdata_t)
+
+/**
+ * Number of cells holding a given bit width
+ */
+static inline std::size_t cellsFor(const std::size_t &bits) {
+	return bits ? (bits - 1u) / HV_FX_CELL_BITS + 1u : 1u;
+}
+
+/**
+ * Sign of a wide value
+ */
+static inline bool isNegative(const fxwide_t &v) {
+	return (v.back() >> (HV_FX_CELL_BITS - 1u)) & 1u;
+}
+
+/**
+ * Cell of a wide value, sign-extended beyond its size
+ */
+static inline bvdata_t cellAt(const fxwide_t &v, const std::size_t &i) {
+	if (i < v.size()) {
+		return v[i];
+	}
+	return isNegative(v) ?
+			~static_cast<bvdata_t>(0u) : static_cast<bvdata_t>(0u);
+}
+
+/**
+ * Bit of a wide value, sign-extended beyond its size
+ */
+static inline bool bitAt(const fxwide_t &v, const std::size_t &i) {
+	return (cellAt(v, i / HV_FX_CELL_BITS) >> (i % HV_FX_CELL_BITS)) & 1u;
+}
+
+/**
+ * Check if any bit below a position is set
+ */
+static inline bool anyBitBelow(const fxwide_t &v, const std::size_t &pos) {
+	const std::size_t full(pos / HV_FX_CELL_BITS);
+	if ((full > v.size()) && isNegative(v)) {
+		return true;
+	}
+	for (std::size_t i = 0u; (i < full) && (i < v.size()); i++) {
+		if (v[i]) {
+			return true;
+		}
+	}
+	const unsigned int r(pos % HV_FX_CELL_BITS);
+	return r && (cellAt(v, full) & HV_LSB_MASK_GEN(bvdata_t, r));
+}
+
+static inline bool isZero(const fxwide_t &v) {
+	for (std::size_t i = 0u; i < v.size(); i++) {
+		if (v[i]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static inline std::size_t bitLength(const fxwide_t &v) {
+	const bvdata_t fill(cellAt(v, v.size()));
+	for (std::size_t i = v.size(); i-- > 0u;) {
+		const bvdata_t c(v[i] ^ fill);
+		if (c) {
+			return (i + 1u) * HV_FX_CELL_BITS
+					- (countLeadingZeros(static_cast<hvuint64_t>(c))
+							- (64u - HV_FX_CELL_BITS));
+		}
+	}
+	return 0u;
+}
+
+/**
+ * Wide value of an intermediate value
+ */
+static inline fxwide_t toWide(const fxint_t &x) {
+	fxwide_t r(BITWIDTH_OF(fxint_t) / HV_FX_CELL_BITS);
+	for (std::size_t i = 0u; i < r.size(); i++) {
+		r[i] = static_cast<bvdata_t>(static_cast<fxuint_t>(x)
+				>> (i * HV_FX_CELL_BITS));
+	}
+	return r;
+}
+
+/**
+ * Wide value of FixedPoint bits
+ * @param bits Value bits
+ * @param format Format of bits
+ * @return Value, with room for a sign bit
+ */
+static fxwide_t toWide(const BitVector &bits, const FixedPointFormat &format) {
+	const unsigned int w(format.getWidth());
+	const std::size_t n(bits.getArraySize());
+	const bvdata_t *p(bits.getDataAddress());
+	fxwide_t r(cellsFor(w + 1u), static_cast<bvdata_t>(0u));
+	for (std::size_t i = 0u; i < n; i++) {
+		r[i] = p[i];
+	}
+	r[n - 1u] &= bits.getmaskLastCell();
+	if (format.isSigned() && bitAt(r, w - 1u)) {
+		if (w % HV_FX_CELL_BITS) {
+			r[n - 1u] |= ~HV_LSB_MASK_GEN(bvdata_t, w % HV_FX_CELL_BITS);
+		}
+		for (std::size_t i = n; i < r.size(); i++) {
+			r[i] = ~static_cast<bvdata_t>(0u);
+		}
+	}
+	return r;
+}
+
+/**
+ * Low 64 bits of a wide value
+ */
+static inline hvint64_t toInt64(const fxwide_t &v) {
+	return static_cast<hvint64_t>(static_cast<hvuint64_t>(cellAt(v, 0u))
+			| (static_cast<hvuint64_t>(cellAt(v, 1u)) << HV_FX_CELL_BITS));
+}
+
+/**
+ * v * 2^s, wrapped to n cells
+ */
+static fxwide_t wideShl(const fxwide_t &v, const std::size_t &s,
+		const std::size_t &n) {
+	fxwide_t r(n, static_cast<bvdata_t>(0u));
+	const std::size_t cs(s / HV_FX_CELL_BITS);
+	const unsigned int bs(s % HV_FX_CELL_BITS);
+	for (std::size_t i = cs; i < n; i++) {
+		r[i] = cellAt(v, i - cs) << bs;
+		if (bs && (i > cs)) {
+			r[i] |= cellAt(v, i - cs - 1u) >> (HV_FX_CELL_BITS - bs);
+		}
+	}
+	return r;
+}
+
+/**
+ * v * 2^s, exact
+ */
+static inline fxwide_t wideAlign(const fxwide_t &v, const std::size_t &s) {
+	return wideShl(v, s, v.size() + s / HV_FX_CELL_BITS + 1u);
+}
+
+/**
+ * floor(v / 2^s)
+ */
+static fxwide_t wideShr(const fxwide_t &v, const std::size_t &s) {
+	const std::size_t cs(s / HV_FX_CELL_BITS);
+	const unsigned int bs(s % HV_FX_CELL_BITS);
+	fxwide_t r(v.size() > cs ? v.size() - cs : 1u);
+	for (std::size_t i = 0u; i < r.size(); i++) {
+		r[i] = cellAt(v, i + cs) >> bs;
+		if (bs) {
+			r[i] |= cellAt(v, i + cs + 1u) << (HV_FX_CELL_BITS - bs);
+		}
+	}
+	return r;
+}
+
+static fxwide_t wideAdd(const fxwide_t &a, const fxwide_t &b) {
+	fxwide_t r((a.size() > b.size() ? a.size() : b.size()) + 1u);
+	hvuint64_t carry(0u);
+	for (std::size_t i = 0u; i < r.size(); i++) {
+		const hvuint64_t t(
+				static_cast<hvuint64_t>(cellAt(a, i)) + cellAt(b, i) + carry);
+		r[i] = static_cast<bvdata_t>(t);
+		carry = t >> HV_FX_CELL_BITS;
+	}
+	return r;
+}
+
+/**
+ * Two's complement negation, within the size of v
+ */
+static inline void negateCells(fxwide_t &v) {
+	hvuint64_t carry(1u);
+	for (std::size_t i = 0u; i < v.size(); i++) {
+		const hvuint64_t t(static_cast<hvuint64_t>(~v[i]) + carry);
+		v[i] = static_cast<bvdata_t>(t);
+		carry = t >> HV_FX_CELL_BITS;
+	}
+}
+
+static inline fxwide_t wideNeg(const fxwide_t &a) {
+	fxwide_t r(a);
+	r.push_back(cellAt(a, a.size()));
+	negateCells(r);
+	return r;
+}
+
+/**
+ * Magnitude of a wide value, most significant bit cleared
+ */
+static inline fxwide_t wideAbs(const fxwide_t &v) {
+	return isNegative(v) ? wideNeg(v) : v;
+}
+
+static fxwide_t wideMul(const fxwide_t &a, const fxwide_t &b) {
+	const fxwide_t ma(wideAbs(a)), mb(wideAbs(b));
+	fxwide_t r(ma.size() + mb.size(), static_cast<bvdata_t>(0u));
+	for (std::size_t i = 0u; i < ma.size(); i++) {
+		hvuint64_t carry(0u);
+		for (std::size_t j = 0u; j < mb.size(); j++) {
+			const hvuint64_t t(
+					static_cast<hvuint64_t>(ma[i]) * mb[j] + r[i + j] + carry);
+			r[i + j] = static_cast<bvdata_t>(t);
+			carry = t >> HV_FX_CELL_BITS;
+		}
+		r[i + mb.size()] = static_cast<bvdata_t>(carry);
+	}
+	if (isNegative(a) != isNegative(b)) {
+		negateCells(r);
+	}
+	return r;
+}
+
+/**
+ * Floor division with sticky bit
+ * @param n Numerator
+ * @param d Denominator (non-zero)
+ * @param sticky Set if the division is inexact
+ * @return floor(n / d)
+ */
+static fxwide_t wideFloorDiv(const fxwide_t &n, const fxwide_t &d,
+		bool &sticky) {
+	const fxwide_t mn(wideAbs(n)), md(wideAbs(d));
+	fxwide_t q(mn.size() + 1u, static_cast<bvdata_t>(0u));
+	fxwide_t r(md.size() + 1u, static_cast<bvdata_t>(0u));
+	// Restoring division, one quotient bit per step
+	for (std::size_t i = bitLength(mn); i-- > 0u;) {
+		for (std::size_t j = r.size(); j-- > 1u;) {
+			r[j] = (r[j] << 1u) | (r[j - 1u] >> (HV_FX_CELL_BITS - 1u));
+		}
+		r[0] = (r[0] << 1u) | static_cast<bvdata_t>(bitAt(mn, i));
+		bool less(false);
+		for (std::size_t j = r.size(); j-- > 0u;) {
+			const bvdata_t dj(cellAt(md, j));
+			if (r[j] != dj) {
+				less = r[j] < dj;
+				break;
+			}
+		}
+		if (!less) {
+			hvuint64_t borrow(0u);
+			for (std::size_t j = 0u; j < r.size(); j++) {
+				const hvuint64_t t(
+						static_cast<hvuint64_t>(r[j]) - cellAt(md, j) - borrow);
+				r[j] = static_cast<bvdata_t>(t);
+				borrow = (t >> HV_FX_CELL_BITS) & 1u;
+			}
+			q[i / HV_FX_CELL_BITS] |= static_cast<bvdata_t>(1u)
+					<< (i % HV_FX_CELL_BITS);
+		}
+	}
+	sticky = !isZero(r);
+	if (isNegative(n) != isNegative(d)) {
+		negateCells(q);
+		if (sticky) {
+			q = wideAdd(q, fxwide_t(1u, ~static_cast<bvdata_t>(0u)));
+		}
+	}
+	return q;
+}
+
+/**
+ * Three-way comparison of wide values
+ */
+static int wideCompare(const fxwide_t &a, const fxwide_t &b) {
+	const bool na(isNegative(a)), nb(isNegative(b));
+	if (na != nb) {
+		return na ? -1 : 1;
+	}
+	for (std::size_t i = a.size() > b.size() ? a.size() : b.size(); i-- > 0u;) {
+		const bvdata_t ca(cellAt(a, i)), cb(cellAt(b, i));
+		if (ca != cb) {
+			return ca < cb ? -1 : 1;
+		}
+	}
+	return 0;
+}
+
+/**
+ * Quantize and overflow a wide exact value into a format
+ * @param v Exact value, times 2^frac
+ * @param frac Fractional bits of v
+ * @param format Destination format
+ * @param dst Destination bits (format width)
+ */
+static void quantizeWide(fxwide_t v, const int &frac,
+		const FixedPointFormat &format, BitVector &dst) {
+	const int fw(format.getFracWidth());
+	const unsigned int w(format.getWidth());
+	const bool negative(isNegative(v));
+	bool overflow(false);
+	if (frac > fw) {
+		const std::size_t s(static_cast<std::size_t>(frac - fw));
+		// Remainder compared to half an LSB: half bit, then lower bits
+		const bool half(bitAt(v, s - 1u));
+		const bool below(anyBitBelow(v, s - 1u));
+		const fxwide_t q(wideShr(v, s));
+		bool up(false);
+		switch (format.getQuant()) {
+		case FX_RND:
+			up = half;
+			break;
+		case FX_RND_ZERO:
+			up = half && (below || negative);
+			break;
+		case FX_RND_MIN_INF:
+			up = half && below;
+			break;
+		case FX_RND_INF:
+			up = half && (below || !negative);
+			break;
+		case FX_RND_CONV:
+			up = half && (below || (q[0] & 1u));
+			break;
+		case FX_TRN:
+			break;
+		case FX_TRN_ZERO:
+			up = negative && (half || below);
+			break;
+		}
+		v = up ? wideAdd(q, fxwide_t(1u, static_cast<bvdata_t>(1u))) : q;
+	} else if (frac < fw) {
+		const std::size_t s(static_cast<std::size_t>(fw - frac));
+		const std::size_t l(bitLength(v));
+		// Beyond the format width, only the low bits are kept for wrapping
+		overflow = !isZero(v) && (l + s > w);
+		v = wideShl(v, s, overflow ? cellsFor(w) : cellsFor(l + s + 1u));
+	}
+
+	if (!overflow) {
+		const std::size_t l(bitLength(v));
+		overflow = format.isSigned() ? l > w - 1u : (isNegative(v) || (l > w));
+	}
+	bvdata_t *p(dst.getDataAddress());
+	const std::size_t n(dst.getArraySize());
+	if (!overflow || (format.getOverflow() == FX_WRAP)) {
+		for (std::size_t i = 0u; i < n; i++) {
+			p[i] = cellAt(v, i);
+		}
+	} else {
+		for (std::size_t i = 0u; i < n; i++) {
+			p[i] = static_cast<bvdata_t>(0u);
+		}
+		const bool sym(format.getOverflow() == FX_SAT_SYM);
+		if (format.getOverflow() == FX_SAT_ZERO) {
+			// Zero
+		} else if (!negative) {
+			// Maximum value
+			for (std::size_t i = 0u; i < n; i++) {
+				p[i] = ~static_cast<bvdata_t>(0u);
+			}
+			if (format.isSigned()) {
+				p[(w - 1u) / HV_FX_CELL_BITS] &= ~(static_cast<bvdata_t>(1u)
+						<< ((w - 1u) % HV_FX_CELL_BITS));
+			}
+		} else if (format.isSigned() && (!sym || (w > 1u))) {
+			// Minimum value, plus one LSB for symmetric saturation
+			p[(w - 1u) / HV_FX_CELL_BITS] |= static_cast<bvdata_t>(1u)
+					<< ((w - 1u) % HV_FX_CELL_BITS);
+			p[0] |= static_cast<bvdata_t>(sym);
+		}
+	}
+	p[n - 1u] &= dst.getmaskLastCell();
+}
+
+//** FixedPointFormat **//
+FixedPointFormat::FixedPointFormat(const unsigned int &width,
+		const int &intWidth, const bool &isSigned, const hvfxquant_t &quant,
+		const hvfxoverflow_t &overflow) :
+		width(width), intWidth(intWidth), signedFlag(isSigned), quant(quant), overflow(
+				overflow), minRaw(0), maxRaw(0) {
+	HV_ASSERT((width > 0u) && (width <= HV_FX_MAX_WIDTH),
+			"Fixed-point width must be between 1 and {} (got {})",
+			HV_FX_MAX_WIDTH, width);
+	HV_ASSERT(
+			std::abs(static_cast<int>(width) - intWidth) <= HV_FX_MAX_FRAC_WIDTH,
+			"Fixed-point fractional width must not exceed {} bits (got {})",
+			HV_FX_MAX_FRAC_WIDTH, static_cast<int>(width) - intWidth);
+	if (this->isNarrow()) {
+		minRaw = isSigned ?
+				-static_cast<hvint64_t>(static_cast<hvuint64_t>(1u) << (width - 1u)) :
+				0;
+		maxRaw = static_cast<hvint64_t>(HV_LSB_MASK_GEN(hvuint64_t,
+				isSigned ? width - 1u : width));
+	}
+}
+
+FixedPointFormat::~FixedPointFormat() {
+}
+
+unsigned int FixedPointFormat::getWidth() const {
+	return width;
+}
+
+int FixedPointFormat::getIntWidth() const {
+	return intWidth;
+}
+
+int FixedPointFormat::getFracWidth() const {
+	return static_cast<int>(width) - intWidth;
+}
+
+bool FixedPointFormat::isSigned() const {
+	return signedFlag;
+}
+
+hvfxquant_t FixedPointFormat::getQuant() const {
+	return quant;
+}
+
+hvfxoverflow_t FixedPointFormat::getOverflow() const {
+	return overflow;
+}
+
+bool FixedPointFormat::isNarrow() const {
+	return width <= HV_FX_NARROW_WIDTH;
+}
+
+hvint64_t FixedPointFormat::getMinRaw() const {
+	HV_ASSERT(this->isNarrow(), "Raw bounds of a {}-bit format", width);
+	return minRaw;
+}
+
+hvint64_t FixedPointFormat::getMaxRaw() const {
+	HV_ASSERT(this->isNarrow(), "Raw bounds of a {}-bit format", width);
+	return maxRaw;
+}
+
+//** FixedPoint **//
+inline hvint64_t FixedPoint::loadRaw() const {
+	const bvdata_t *p(value.getDataAddress());
+	hvuint64_t x(p[0]);
+	if (format.getWidth() > HV_FX_CELL_BITS) {
+		x |= static_cast<hvuint64_t>(p[1]) << HV_FX_CELL_BITS;
+	}
+	// Cells are kept masked to the width: sign extension flips and subtracts
+	// the sign bit, which is -minRaw (0 if unsigned)
+	const hvuint64_t m(static_cast<hvuint64_t>(-format.getMinRaw()));
+	return static_cast<hvint64_t>((x ^ m) - m);
+}
+
+inline void FixedPoint::storeRaw(const hvint64_t &raw) {
+	bvdata_t *p(value.getDataAddress());
+	// maxRaw - minRaw is the mask of the width
+	const hvuint64_t x(
+			static_cast<hvuint64_t>(raw)
+					& static_cast<hvuint64_t>(format.getMaxRaw() - format.getMinRaw()));
+	// Both cells written together, so that loadRaw() reads them back as
+	// they were stored
+	if (format.getWidth() > HV_FX_CELL_BITS) {
+		p[0] = static_cast<bvdata_t>(x);
+		p[1] = static_cast<bvdata_t>(x >> HV_FX_CELL_BITS);
+	} else {
+		p[0] = static_cast<bvdata_t>(x);
+	}
+}
+
+FixedPoint::FixedPoint(const FixedPointFormat &format) :
+		format(format), value(static_cast<bvsize_t>(format.getWidth()), 0u) {
+}
+
+FixedPoint::FixedPoint(const FixedPointFormat &format, const double &value) :
+		format(format), value(static_cast<bvsize_t>(format.getWidth()), 0u) {
+	*this = value;
+}
+
+FixedPoint::FixedPoint(const FixedPointFormat &format, const BitVector &bits) :
+		format(format), value(static_cast<bvsize_t>(format.getWidth()), 0u) {
+	this->setBits(bits);
+}
+
+FixedPoint::FixedPoint(const FixedPoint &src) :
+		format(src.format), value(src.value) {
+}
+
+FixedPoint::~FixedPoint() {
+}
+
+const FixedPointFormat& FixedPoint::getFormat() const {
+	return format;
+}
+
+hvint64_t FixedPoint::getRaw() const {
+	HV_ASSERT(format.isNarrow(), "Raw value of a {}-bit fixed-point number",
+			format.getWidth());
+	return this->loadRaw();
+}
+
+void FixedPoint::setRaw(const hvint64_t &raw) {
+	if (format.isNarrow()) {
+		this->storeRaw(raw);
+		return;
+	}
+	const fxwide_t v(toWide(static_cast<fxint_t>(raw)));
+	bvdata_t *p(value.getDataAddress());
+	for (std::size_t i = 0u; i < value.getArraySize(); i++) {
+		p[i] = cellAt(v, i);
+	}
+	p[value.getArraySize() - 1u] &= value.getmaskLastCell();
+}
+
+BitVector FixedPoint::getBits() const {
+	return value;
+}
+
+void FixedPoint::setBits(const BitVector &bits) {
+	HV_ASSERT(bits.getSize() == format.getWidth(),
+			"Fixed-point bit pattern must be {} bits (got {})", format.getWidth(),
+			bits.getSize());
+	value = bits;
+	// Narrow loads rely on the bits beyond the width being 0
+	value.getDataAddress()[value.getArraySize() - 1u] &= value.getmaskLastCell();
+}
+
+double FixedPoint::toDouble() const {
+	if (format.isNarrow()) {
+		return std::ldexp(static_cast<double>(this->loadRaw()),
+				-format.getFracWidth());
+	}
+	const fxwide_t v(toWide(value, format));
+	const std::size_t l(bitLength(v));
+	if (l <= 62u) {
+		return std::ldexp(static_cast<double>(toInt64(v)), -format.getFracWidth());
+	}
+	// 62 most significant bits, exact beyond the double precision
+	return std::ldexp(static_cast<double>(toInt64(wideShr(v, l - 62u))),
+			static_cast<int>(l - 62u) - format.getFracWidth());
+}
+
+FixedPoint& FixedPoint::operator =(const FixedPoint &src) {
+	if (format.isNarrow() && src.format.isNarrow()) {
+		this->storeRaw(quantize(src.loadRaw(), src.format.getFracWidth(), format));
+	} else {
+		quantizeWide(toWide(src.value, src.format), src.format.getFracWidth(),
+				format, value);
+	}
+	return *this;
+}
+
+FixedPoint& FixedPoint::operator =(const double &src) {
+	HV_ASSERT(!std::isnan(src), "Cannot convert NaN to fixed point");
+	fxint_t v(0);
+	int frac(0);
+	if (std::isinf(src)) {
+		// Out of any range: overflow handling with the sign of src
+		v = src > 0 ? 1 : -1;
+		frac = format.getFracWidth() - static_cast<int>(format.getWidth()) - 1;
+	} else {
+		int exp(0);
+		const double m(std::frexp(src, &exp));
+		v = static_cast<hvint64_t>(std::ldexp(m, 53));
+		frac = 53 - exp;
+	}
+	if (format.isNarrow()) {
+		this->storeRaw(quantize(v, frac, format));
+	} else {
+		quantizeWide(toWide(v), frac, format, value);
+	}
+	return *this;
+}
+
+FixedPoint& FixedPoint::add(const FixedPoint &a, const FixedPoint &b) {
+	const int fa(a.format.getFracWidth()), fb(b.format.getFracWidth());
+	const int f(fa > fb ? fa : fb);
+	if (format.isNarrow() && a.format.isNarrow() && b.format.isNarrow()
+			&& fits(a.format, f - fa, HV_FX_MAX_INTERMEDIATE_BITS - 1u)
+			&& fits(b.format, f - fb, HV_FX_MAX_INTERMEDIATE_BITS - 1u)) {
+		this->storeRaw(
+				quantizeSum(a.loadRaw(), f - fa, b.loadRaw(), f - fb, f, format));
+		return *this;
+	}
+	quantizeWide(
+			wideAdd(wideAlign(toWide(a.value, a.format), f - fa),
+					wideAlign(toWide(b.value, b.format), f - fb)), f, format,
+			value);
+	return *this;
+}
+
+FixedPoint& FixedPoint::sub(const FixedPoint &a, const FixedPoint &b) {
+	const int fa(a.format.getFracWidth()), fb(b.format.getFracWidth());
+	const int f(fa > fb ? fa : fb);
+	if (format.isNarrow() && a.format.isNarrow() && b.format.isNarrow()
+			&& fits(a.format, f - fa, HV_FX_MAX_INTERMEDIATE_BITS - 1u)
+			&& fits(b.format, f - fb, HV_FX_MAX_INTERMEDIATE_BITS - 1u)) {
+		this->storeRaw(
+				quantizeSum(a.loadRaw(), f - fa, -b.loadRaw(), f - fb, f, format));
+		return *this;
+	}
+	quantizeWide(
+			wideAdd(wideAlign(toWide(a.value, a.format), f - fa),
+					wideNeg(wideAlign(toWide(b.value, b.format), f - fb))), f,
+			format, value);
+	return *this;
+}
+
+FixedPoint& FixedPoint::mul(const FixedPoint &a, const FixedPoint &b) {
+	const int f(a.format.getFracWidth() + b.format.getFracWidth());
+	if (format.isNarrow() && a.format.isNarrow() && b.format.isNarrow()) {
+		const hvint64_t ra(a.loadRaw()), rb(b.loadRaw());
+		this->storeRaw(
+				bitLength(ra) + bitLength(rb) <= 61u ?
+						quantize<hvint64_t, hvuint64_t, 62u>(ra * rb, f, format) :
+						quantize(static_cast<fxint_t>(ra) * rb, f, format));
+		return *this;
+	}
+	quantizeWide(wideMul(toWide(a.value, a.format), toWide(b.value, b.format)),
+			f, format, value);
+	return *this;
+}
+
+FixedPoint& FixedPoint::div(const FixedPoint &a, const FixedPoint &b) {
+	// Quotient with one extra bit below the destination LSB, plus a sticky
+	// bit, rounds exactly like the infinitely precise quotient
+	const int f(format.getFracWidth() + 1);
+	const int shift(f - a.format.getFracWidth() + b.format.getFracWidth());
+	bool sticky(false);
+	if (format.isNarrow() && a.format.isNarrow() && b.format.isNarrow()
+			&& (shift >= 0 ?
+					fits(a.format, shift, HV_FX_MAX_INTERMEDIATE_BITS - 1u) :
+					fits(b.format, -shift, HV_FX_MAX_INTERMEDIATE_BITS))) {
+		const hvint64_t ra(a.loadRaw()), rb(b.loadRaw());
+		HV_ASSERT(rb != 0, "Fixed-point division by zero");
+		const fxint_t q(
+				shift >= 0 ?
+						floorDiv(align(ra, shift), rb, sticky) :
+						floorDiv(ra, align(rb, -shift), sticky));
+		this->storeRaw(quantize(align(q, 1) + sticky, f + 1, format));
+		return *this;
+	}
+	const fxwide_t wa(toWide(a.value, a.format)), wb(toWide(b.value, b.format));
+	HV_ASSERT(!isZero(wb), "Fixed-point division by zero");
+	fxwide_t q(
+			shift >= 0 ?
+					wideFloorDiv(wideAlign(wa, shift), wb, sticky) :
+					wideFloorDiv(wa, wideAlign(wb, -shift), sticky));
+	q = wideAlign(q, 1u);
+	q[0] |= static_cast<bvdata_t>(sticky);
+	quantizeWide(q, f + 1, format, value);
+	return *this;
+}
+
+FixedPoint& FixedPoint::neg(const FixedPoint &a) {
+	if (format.isNarrow() && a.format.isNarrow()) {
+		this->storeRaw(
+				quantize(-static_cast<fxint_t>(a.loadRaw()), a.format.getFracWidth(),
+						format));
+	} else {
+		quantizeWide(wideNeg(toWide(a.value, a.format)), a.format.getFracWidth(),
+				format, value);
+	}
+	return *this;
+}
+
+FixedPoint& FixedPoint::operator +=(const FixedPoint &op2) {
+	return this->add(*this, op2);
+}
+
+FixedPoint& FixedPoint::operator -=(const FixedPoint &op2) {
+	return this->sub(*this, op2);
+}
+
+FixedPoint& FixedPoint::operator *=(const FixedPoint &op2) {
+	return this->mul(*this, op2);
+}
+
+FixedPoint& FixedPoint::operator /=(const FixedPoint &op2) {
+	const FixedPoint a(*this);
+	return this->div(a, op2);
+}
+
+int FixedPoint::compare(const FixedPoint &op2) const {
+	const int fa(format.getFracWidth()), fb(op2.format.getFracWidth());
+	const int f(fa > fb ? fa : fb);
+	if (format.isNarrow() && op2.format.isNarrow()
+			&& fits(format, f - fa, HV_FX_MAX_INTERMEDIATE_BITS)
+			&& fits(op2.format, f - fb, HV_FX_MAX_INTERMEDIATE_BITS)) {
+		const fxint_t a(align(this->loadRaw(), f - fa));
+		const fxint_t b(align(op2.loadRaw(), f - fb));
+		return (a > b) - (a < b);
+	}
+	return wideCompare(wideAlign(toWide(value, format), f - fa),
+			wideAlign(toWide(op2.value, op2.format), f - fb));
+}
+
+bool FixedPoint::operator ==(const FixedPoint &op2) const {
+	return this->compare(op2) == 0;
+}
+
+bool FixedPoint::operator !=(const FixedPoint &op2) const {
+	return this->compare(op2) != 0;
+}
+
+bool FixedPoint::operator <(const FixedPoint &op2) const {
+	return this->compare(op2) < 0;
+}
+
+bool FixedPoint::operator <=(const FixedPoint &op2) const {
+	return this->compare(op2) <= 0;
+}
+
+bool FixedPoint::operator >(const FixedPoint &op2) const {
+	return this->compare(op2) > 0;
+}
+
+bool FixedPoint::operator >=(const FixedPoint &op2) const {
+	return this->compare(op2) >= 0;
+}
+
+std::ostream& operator <<(std::ostream &strm, const FixedPoint &fx) {
+	return strm << fx.toDouble();
+}
+
+} // namespace common
+} // namespace hv
+
+#endif // HV_HAS_INT128
@@ -0,0 +1,321 @@
+/**
+ * @file fixedpoint.h
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Bit-accurate fixed-point numbers for DSP models
+ */
+
+#ifndef HV_FIXED_POINT_H
+#define HV_FIXED_POINT_H
+
+#include "datatypes.h"
+#include "bitvector.h"
+
+/*
+ * FixedPoint computes narrow exact intermediates on 128 bits: it is only
+ * available if the compiler provides 128-bit integers (HV_HAS_INT128).
+ */
+#ifdef HV_HAS_INT128
+
+/**
+ * Maximum fixed-point word width (largest BitVector with the default 16-bit
+ * sizes)
+ */
+#define HV_FX_MAX_WIDTH 65535
+
+/**
+ * Maximum absolute fractional width
+ */
+#define HV_FX_MAX_FRAC_WIDTH 65535
+
+/**
+ * Widest format computed on native 64-bit raw values, wider formats are
+ * computed with multi-word kernels on BitVector cells
+ */
+#define HV_FX_NARROW_WIDTH 63
+
+namespace hv {
+namespace common {
+
+/**
+ * Quantization modes (SystemC sc_q_mode equivalents), applied when a value
+ * has more fractional bits than the destination format
+ */
+typedef enum {
+	FX_RND,         // Round, ties towards plus infinity
+	FX_RND_ZERO,    // Round, ties towards zero
+	FX_RND_MIN_INF, // Round, ties towards minus infinity
+	FX_RND_INF,     // Round, ties away from zero
+	FX_RND_CONV,    // Round, ties to even
+	FX_TRN,         // Truncate towards minus infinity
+	FX_TRN_ZERO     // Truncate towards zero
+} hvfxquant_t;
+
+/**
+ * Overflow modes (SystemC sc_o_mode equivalents), applied when a value is
+ * out of the range of the destination format
+ * SC_WRAP_SM (sign-magnitude wrap) and the n_bits saturation parameter of
+ * SC_WRAP are not provided.
+ */
+typedef enum {
+	FX_SAT,      // Saturate to the nearest bound
+	FX_SAT_ZERO, // Set to zero
+	FX_SAT_SYM,  // Saturate to +/- the maximum value
+	FX_WRAP      // Keep the width least significant bits
+} hvfxoverflow_t;
+
+/**
+ * Fixed-point format
+ *
+ * A value of the format is an integer of width bits (two's complement if
+ * signed) scaled by 2^-(width - intWidth). intWidth may be negative or
+ * larger than width.
+ */
+class FixedPointFormat {
+public:
+	/**
+	 * Constructor
+	 * @param width Word width (1 to HV_FX_MAX_WIDTH)
+	 * @param intWidth Integer width, sign bit included
+	 * @param isSigned Two's complement if true
+	 * @param quant Quantization mode
+	 * @param overflow Overflow mode
+	 */
+	FixedPointFormat(const unsigned int &width, const int &intWidth,
+			const bool &isSigned = true, const hvfxquant_t &quant = FX_TRN,
+			const hvfxoverflow_t &overflow = FX_WRAP);
+
+	virtual ~FixedPointFormat();
+
+	//** Accessors **//
+	/**
+	 * Get word width
+	 * @return Word width in bits
+	 */
+	unsigned int getWidth() const;
+
+	/**
+	 * Get integer width
+	 * @return Integer width in bits, sign bit included
+	 */
+	int getIntWidth() const;
+
+	/**
+	 * Get fractional width
+	 * @return Fractional width in bits (width - intWidth)
+	 */
+	int getFracWidth() const;
+
+	/**
+	 * Check signedness
+	 * @return True if values are two's complement
+	 */
+	bool isSigned() const;
+
+	/**
+	 * Get quantization mode
+	 * @return Quantization mode
+	 */
+	hvfxquant_t getQuant() const;
+
+	/**
+	 * Get overflow mode
+	 * @return Overflow mode
+	 */
+	hvfxoverflow_t getOverflow() const;
+
+	/**
+	 * Check if values fit native raw words
+	 * @return True if width is at most HV_FX_NARROW_WIDTH
+	 */
+	bool isNarrow() const;
+
+	/**
+	 * Get smallest raw value of a narrow format
+	 * @return Smallest raw value of the format
+	 */
+	hvint64_t getMinRaw() const;
+
+	/**
+	 * Get largest raw value of a narrow format
+	 * @return Largest raw value of the format
+	 */
+	hvint64_t getMaxRaw() const;
+
+protected:
+	unsigned int width;
+	int intWidth;
+	bool signedFlag;
+	hvfxquant_t quant;
+	hvfxoverflow_t overflow;
+	hvint64_t minRaw;
+	hvint64_t maxRaw;
+};
+
+/**
+ * Fixed-point number
+ *
+ * The value is stored as a width-bit BitVector (two's complement if signed).
+ * Assignments and arithmetic results are computed exactly, then quantized
+ * and overflowed into the destination format, as SystemC sc_fixed does when
+ * assigning an expression: c.add(a, b) matches c = a + b.
+ *
+ * When all formats are narrow (HV_FX_NARROW_WIDTH bits at most) and aligned
+ * operands fit, values are computed on 64-bit raw words with 128-bit
+ * intermediates. Otherwise, multi-word kernels compute on the BitVector cells.
+ *
+ * As for BitVector, assigning a FixedPoint keeps the format of the
+ * destination.
+ */
+class FixedPoint {
+public:
+	/**
+	 * Constructor, value 0
+	 * @param format Format
+	 */
+	explicit FixedPoint(const FixedPointFormat &format);
+
+	/**
+	 * Constructor from a real value
+	 * @param format Format
+	 * @param value Value, quantized and overflowed into the format
+	 */
+	FixedPoint(const FixedPointFormat &format, const double &value);
+
+	/**
+	 * Constructor from a bit pattern
+	 * @param format Format
+	 * @param bits Raw bits (format width)
+	 */
+	FixedPoint(const FixedPointFormat &format, const BitVector &bits);
+
+	/**
+	 * Copy constructor
+	 * @param src Source FixedPoint, format included
+	 */
+	FixedPoint(const FixedPoint &src);
+
+	virtual ~FixedPoint();
+
+	//** Accessors **//
+	/**
+	 * Get format
+	 * @return Format
+	 */
+	const FixedPointFormat& getFormat() const;
+
+	/**
+	 * Get raw value (value * 2^fracWidth) of a narrow format
+	 * @return Raw value, sign-extended
+	 */
+	hvint64_t getRaw() const;
+
+	/**
+	 * Set raw value
+	 * @param raw Raw value, sign-extended then wrapped into the format width
+	 */
+	void setRaw(const hvint64_t &raw);
+
+	/**
+	 * Get bit pattern
+	 * @return Raw bits (format width)
+	 */
+	BitVector getBits() const;
+
+	/**
+	 * Set bit pattern
+	 * @param bits Raw bits (format width)
+	 */
+	void setBits(const BitVector &bits);
+
+	/**
+	 * Convert to double (exact up to 53 significant bits)
+	 * @return Value
+	 */
+	double toDouble() const;
+
+	//** Arithmetic, result quantized into the format of this **//
+	FixedPoint& operator =(const FixedPoint &src);
+	FixedPoint& operator =(const double &src);
+
+	/**
+	 * this = a + b
+	 */
+	FixedPoint& add(const FixedPoint &a, const FixedPoint &b);
+
+	/**
+	 * this = a - b
+	 */
+	FixedPoint& sub(const FixedPoint &a, const FixedPoint &b);
+
+	/**
+	 * this = a * b
+	 */
+	FixedPoint& mul(const FixedPoint &a, const FixedPoint &b);
+
+	/**
+	 * this = a / b, b non-zero
+	 */
+	FixedPoint& div(const FixedPoint &a, const FixedPoint &b);
+
+	/**
+	 * this = -a
+	 */
+	FixedPoint& neg(const FixedPoint &a);
+
+	FixedPoint& operator +=(const FixedPoint &op2);
+	FixedPoint& operator -=(const FixedPoint &op2);
+	FixedPoint& operator *=(const FixedPoint &op2);
+	FixedPoint& operator /=(const FixedPoint &op2);
+
+	//** Comparisons (exact) **//
+	bool operator ==(const FixedPoint &op2) const;
+	bool operator !=(const FixedPoint &op2) const;
+	bool operator <(const FixedPoint &op2) const;
+	bool operator <=(const FixedPoint &op2) const;
+	bool operator >(const FixedPoint &op2) const;
+	bool operator >=(const FixedPoint &op2) const;
+
+	/**
+	 * Output stream operator overloading (real value)
+	 */
+	friend std::ostream& operator <<(std::ostream &strm, const FixedPoint &fx);
+
+protected:
+	/**
+	 * Three-way comparison
+	 */
+	int compare(const FixedPoint &op2) const;
+
+	/**
+	 * Read the value of a narrow format
+	 * @return Raw value, sign-extended
+	 */
+	hvint64_t loadRaw() const;
+
+	/**
+	 * Write the value of a narrow format
+	 * @param raw Raw value, wrapped into the format width
+	 */
+	void storeRaw(const hvint64_t &raw);
+
+	/**
+	 * Format
+	 */
+	FixedPointFormat format;
+
+	/**
+	 * Value bits (format width), bits beyond the width in the last cell
+	 * kept to 0
+	 */
+	BitVector value;
+};
+
+} // namespace common
+} // namespace hv
+
+#endif // HV_HAS_INT128
+
+#endif // HV_FIXED_POINT_H
@@ -110,9 +110,14 @@ namespace test {
  */
 std::string bitRandStr(unsigned int n) {
 	std::string ret(n, '0');
+	RandomEngine &engine(RandomEngine::getThreadEngine());
+	hvuint64_t tmp(0u);
 	for (unsigned int i = 0; i < n; i++) {
-		if (std::rand() % 2)
+		if (!(i % BITWIDTH_OF(tmp)))
+			tmp = engine();
+		if (tmp & 1u)
 			ret[i] = '1';
+		tmp >>= 1;
 	}
 	return ret;
 
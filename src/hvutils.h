@@ -21,6 +21,7 @@
 
 #include "datatypes.h"
 #include "log.h"
+#include "random.h"
 
 /**
  * Determines the binary size of type T
@@ -165,6 +166,75 @@ template<typename T> T superiorPowerOf2(const T& in) {
 	return in == ret ? ret : static_cast<T>(2) * ret;
 }
 
+// Bit counting
+/**
+ * Number of bits set (population count)
+ * @param x Input
+ * @return Number of 1s in x
+ */
+inline unsigned int popCount(const hvuint64_t &x) {
+#ifdef __GNUC__
+	return static_cast<unsigned int>(__builtin_popcountll(x));
+#else
+	hvuint64_t v(x - ((x >> 1) & 0x5555555555555555ULL));
+	v = (v & 0x3333333333333333ULL) + ((v >> 2) & 0x3333333333333333ULL);
+	v = (v + (v >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+	return static_cast<unsigned int>((v * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+/**
+ * Parity of the number of bits set
+ * @param x Input
+ * @return True if x has an odd number of 1s
+ */
+inline bool parity(const hvuint64_t &x) {
+#ifdef __GNUC__
+	return __builtin_parityll(x) != 0;
+#else
+	return (popCount(x) & 1u) != 0u;
+#endif
+}
+
+/**
+ * Number of trailing zeros
+ * @param x Input
+ * @return Index of the least significant 1, 64 if x is 0
+ */
+inline unsigned int countTrailingZeros(const hvuint64_t &x) {
+	if (!x) {
+		return 64u;
+	}
+#ifdef __GNUC__
+	return static_cast<unsigned int>(__builtin_ctzll(x));
+#else
+	return popCount((x & (~x + 1u)) - 1u);
+#endif
+}
+
+/**
+ * Number of leading zeros
+ * @param x Input
+ * @return Number of 0s above the most significant 1, 64 if x is 0
+ */
+inline unsigned int countLeadingZeros(const hvuint64_t &x) {
+	if (!x) {
+		return 64u;
+	}
+#ifdef __GNUC__
+	return static_cast<unsigned int>(__builtin_clzll(x));
+#else
+	hvuint64_t v(x);
+	v |= v >> 1;
+	v |= v >> 2;
+	v |= v >> 4;
+	v |= v >> 8;
+	v |= v >> 16;
+	v |= v >> 32;
+	return 64u - popCount(v);
+#endif
+}
+
 namespace test {
 
 // "Bit" string random generation
@@ -195,21 +265,23 @@ unsigned int getHammingWeightStr(std::string str);
 /**
  * Generates a random number of type T.
  * All bits from LSBs to MSBs are randomized, whatever the bitwidth of T is.
+ * Numbers are drawn from the calling thread's RandomEngine.
+ * @param n Number of random LSBs (the other bits are set to 0)
  * @return Random number
  */
 template<typename T> T randNumGen(std::size_t n) {
 	T ret(0);
-	static const unsigned int N_BIT_RANDMAX =
-			static_cast<unsigned int>(RAND_MAX) == 32767 ? 16 : 32;
+	static const unsigned int N_BIT_ENGINE = BITWIDTH_OF(RandomEngine::result_type);
 	static const unsigned int N_BIT_T = BITWIDTH_OF(T);
 	static const unsigned int N_SLICES =
-			(N_BIT_T <= N_BIT_RANDMAX) ? 1 :
-			!(N_BIT_T % N_BIT_RANDMAX) ?
-					(N_BIT_T / N_BIT_RANDMAX) : ((N_BIT_T / N_BIT_RANDMAX) + 1);
+			(N_BIT_T <= N_BIT_ENGINE) ? 1 :
+			!(N_BIT_T % N_BIT_ENGINE) ?
+					(N_BIT_T / N_BIT_ENGINE) : ((N_BIT_T / N_BIT_ENGINE) + 1);
 
+	RandomEngine &engine(RandomEngine::getThreadEngine());
 	for (unsigned int i = 0; i < N_SLICES; i++) {
-		ret |= static_cast<T>(std::rand())
-				<< static_cast<unsigned int>(i * N_BIT_RANDMAX);
+		ret |= static_cast<T>(engine())
+				<< static_cast<unsigned int>(i * N_BIT_ENGINE);
 	}
 	if (n < BITWIDTH_OF(T))
 		ret &= HV_LSB_MASK_GEN(T, n);
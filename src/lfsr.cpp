@@ -0,0 +1,376 @@
+/**
+ * @file lfsr.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Word-parallel linear feedback shift register and PRBS generator
+ */
+
+#include "lfsr.h"
+
+namespace hv {
+namespace common {
+
+typedef BitVector::bvdata_t bvdata_t;
+typedef BitVector::bvsize_t bvsize_t;
+
+/**
+ * Number of 64-bit words holding n bits
+ */
+#define HV_LFSR_N_WORDS(n) (((n) + 63u) / 64u)
+
+/**
+ * Minimum delay of the squared feedback polynomial: 64 makes each output
+ * word depend on earlier words only, larger values let consecutive words be
+ * computed independently
+ */
+#define HV_LFSR_LEAP_MIN_DELAY 2048u
+
+/**
+ * Read up to 64 bits of a word array at any bit position
+ * @param words Word array
+ * @param pos Bit position
+ * @param nBits Number of bits (1 to 64)
+ * @return Bits, LSB aligned
+ */
+static inline hvuint64_t getBits(const hvuint64_t *words, const std::size_t &pos,
+		const unsigned int &nBits) {
+	const std::size_t w(pos / 64u);
+	const unsigned int sh(pos % 64u);
+	hvuint64_t ret(words[w] >> sh);
+	if (sh && (sh + nBits > 64u)) {
+		ret |= words[w + 1u] << (64u - sh);
+	}
+	return ret & HV_LSB_MASK_GEN(hvuint64_t, nBits);
+}
+
+/**
+ * Write bits within a single word of a word array
+ * Bits above the written ones are cleared when writing at a word boundary.
+ * @param words Word array
+ * @param pos Bit position
+ * @param x Bits, LSB aligned
+ * @param nBits Number of bits (pos % 64 + nBits <= 64)
+ */
+static inline void setBits(hvuint64_t *words, const std::size_t &pos,
+		const hvuint64_t &x, const unsigned int &nBits) {
+	const std::size_t w(pos / 64u);
+	const unsigned int sh(pos % 64u);
+	const hvuint64_t v(x & HV_LSB_MASK_GEN(hvuint64_t, nBits));
+	if (!sh) {
+		words[w] = v;
+	} else {
+		words[w] |= v << sh;
+	}
+}
+
+/**
+ * Read the 64 bits located e bits before word i of a word array
+ * @param words Word array
+ * @param i Word index
+ * @param e Distance in bits (<= 64 * i)
+ * @return Bits
+ */
+static inline hvuint64_t getDelayedWord(const hvuint64_t *words,
+		const std::size_t &i, const unsigned int &e) {
+	const std::size_t w(i - (e + 63u) / 64u);
+	const unsigned int sh((64u - e % 64u) % 64u);
+	return sh ? (words[w] >> sh) | (words[w + 1u] << (64u - sh)) : words[w];
+}
+
+/**
+ * Copy bits of a word array to the start of another one
+ * @param dst Destination word array
+ * @param src Source word array
+ * @param pos Source bit position
+ * @param nBits Number of bits
+ */
+static inline void copyBits(hvuint64_t *dst, const hvuint64_t *src,
+		const std::size_t &pos, const std::size_t &nBits) {
+	for (std::size_t i = 0u; i < nBits; i += 64u) {
+		const unsigned int n(static_cast<unsigned int>(HV_MIN(nBits - i, 64u)));
+		setBits(dst, i, getBits(src, pos + i, n), n);
+	}
+}
+
+Lfsr::Lfsr(const BitVector &taps, const BitVector &seed,
+		const hvlfsrtype_t &type) :
+		width(taps.getSize()), type(type), nWords(
+				HV_LFSR_N_WORDS(taps.getSize())) {
+	HV_ASSERT(width <= HV_LFSR_MAX_WIDTH,
+			"LFSR width must not exceed {} (got {})", HV_LFSR_MAX_WIDTH, width);
+	HV_ASSERT(static_cast<bool>(taps[width - 1u]),
+			"LFSR taps must include the x^width term");
+	std::vector<hvuint64_t> tapWords(nWords);
+	toWords(taps, tapWords.data(), nWords);
+	feedback.assign(nWords, 0u);
+	for (unsigned int e = 1u; e <= width; e++) {
+		if ((tapWords[(e - 1u) / 64u] >> ((e - 1u) % 64u)) & 1u) {
+			delays.push_back(e);
+			feedback[(width - e) / 64u] |= HV_BIT_MASK_GEN(hvuint64_t,
+					(width - e) % 64u);
+		}
+	}
+	leapFactor = 1u;
+	while (delays.front() * leapFactor < HV_LFSR_LEAP_MIN_DELAY) {
+		leapFactor *= 2u;
+	}
+	for (const unsigned int &e : delays) {
+		leapDelays.push_back(e * leapFactor);
+	}
+	state.assign(nWords, 0u);
+	this->setState(seed);
+}
+
+Lfsr::~Lfsr() {
+}
+
+Lfsr Lfsr::prbs(const unsigned int &order) {
+	return prbs(order, ~BitVector(static_cast<bvsize_t>(order), false));
+}
+
+Lfsr Lfsr::prbs(const unsigned int &order, const BitVector &seed) {
+	unsigned int tap(0u);
+	switch (order) {
+	case 7u:
+		tap = 6u;
+		break;
+	case 9u:
+		tap = 5u;
+		break;
+	case 11u:
+		tap = 9u;
+		break;
+	case 15u:
+		tap = 14u;
+		break;
+	case 20u:
+		tap = 3u;
+		break;
+	case 23u:
+		tap = 18u;
+		break;
+	case 31u:
+		tap = 28u;
+		break;
+	default:
+		HV_LOG_ERROR("Unsupported PRBS order {}", order);
+		HV_EXIT_FAILURE();
+	}
+	BitVector taps(static_cast<bvsize_t>(order), false);
+	taps[order - 1u] = true;
+	taps[tap - 1u] = true;
+	return Lfsr(taps, seed);
+}
+
+bvsize_t Lfsr::getWidth() const {
+	return width;
+}
+
+BitVector Lfsr::getTaps() const {
+	BitVector ret(width, false);
+	for (const unsigned int &e : delays) {
+		ret[e - 1u] = true;
+	}
+	return ret;
+}
+
+hvlfsrtype_t Lfsr::getType() const {
+	return type;
+}
+
+BitVector Lfsr::getState() const {
+	BitVector ret(width, false);
+	if (type == LFSR_FIBONACCI) {
+		fromWords(state.data(), ret.getSize(), ret);
+	} else {
+		// g[i] = b[i] ^ XOR of b[i - e] over delays e <= i
+		std::vector<hvuint64_t> g(state);
+		for (unsigned int i = 0u; i < width; i++) {
+			bool bit(false);
+			for (const unsigned int &e : delays) {
+				if (e > i) {
+					break;
+				}
+				bit ^= (state[(i - e) / 64u] >> ((i - e) % 64u)) & 1u;
+			}
+			g[i / 64u] ^= static_cast<hvuint64_t>(bit) << (i % 64u);
+		}
+		fromWords(g.data(), ret.getSize(), ret);
+	}
+	return ret;
+}
+
+void Lfsr::setState(const BitVector &src) {
+	HV_ASSERT(src.getSize() == width,
+			"LFSR state must be {} bits wide (got {})", width, src.getSize());
+	HV_ASSERT(!!src, "LFSR state must not be zero");
+	toWords(src, state.data(), nWords);
+	if (type == LFSR_GALOIS) {
+		// b[i] = g[i] ^ XOR of b[i - e] over delays e <= i
+		for (unsigned int i = 0u; i < width; i++) {
+			bool bit(false);
+			for (const unsigned int &e : delays) {
+				if (e > i) {
+					break;
+				}
+				bit ^= (state[(i - e) / 64u] >> ((i - e) % 64u)) & 1u;
+			}
+			state[i / 64u] ^= static_cast<hvuint64_t>(bit) << (i % 64u);
+		}
+	}
+}
+
+bool Lfsr::step() {
+	const bool ret(state[0] & 1u);
+	hvuint64_t fb(0u);
+	for (unsigned int w = 0u; w < nWords; w++) {
+		fb ^= state[w] & feedback[w];
+	}
+	for (unsigned int w = 0u; w + 1u < nWords; w++) {
+		state[w] = (state[w] >> 1) | (state[w + 1u] << 63);
+	}
+	state[nWords - 1u] >>= 1;
+	state[(width - 1u) / 64u] |= static_cast<hvuint64_t>(parity(fb))
+			<< ((width - 1u) % 64u);
+	return ret;
+}
+
+BitVector Lfsr::next(const bvsize_t &nBits) {
+	std::vector<hvuint64_t> buf(HV_LFSR_N_WORDS(nBits));
+	this->generate(buf.data(), nBits);
+	BitVector ret(nBits, false);
+	fromWords(buf.data(), ret.getSize(), ret);
+	return ret;
+}
+
+void Lfsr::generate(hvuint64_t *dst, const std::size_t &nBits) {
+	if (!nBits) {
+		return;
+	}
+	std::vector<hvuint64_t> tmp(HV_LFSR_N_WORDS(2u * width) + 1u);
+	if (nBits >= width) {
+		// Output stream starts with the state
+		for (unsigned int w = 0u; w < nWords; w++) {
+			dst[w] = state[w];
+		}
+		this->extend(dst, width, nBits);
+		// Next state from the last width outputs
+		copyBits(tmp.data(), dst, nBits - width, width);
+		this->extend(tmp.data(), width, 2u * width);
+		copyBits(state.data(), tmp.data(), width, width);
+	} else {
+		for (unsigned int w = 0u; w < nWords; w++) {
+			tmp[w] = state[w];
+		}
+		this->extend(tmp.data(), width, width + nBits);
+		copyBits(dst, tmp.data(), 0u, nBits);
+		copyBits(state.data(), tmp.data(), nBits, width);
+	}
+}
+
+void Lfsr::advance(hvuint64_t nSteps) {
+	for (unsigned int i = 0u; nSteps; i++, nSteps >>= 1) {
+		if (jump.size() <= i) {
+			// Columns of M^(2^i): M^(2^(i-1)) applied to columns of M^(2^(i-1))
+			std::vector<hvuint64_t> matrix(width * nWords, 0u);
+			for (unsigned int j = 0u; j < width; j++) {
+				hvuint64_t *col(&matrix[j * nWords]);
+				if (!i) {
+					if (j) {
+						col[(j - 1u) / 64u] |= HV_BIT_MASK_GEN(hvuint64_t,
+								(j - 1u) % 64u);
+					}
+					if ((feedback[j / 64u] >> (j % 64u)) & 1u) {
+						col[(width - 1u) / 64u] |= HV_BIT_MASK_GEN(hvuint64_t,
+								(width - 1u) % 64u);
+					}
+				} else {
+					const std::vector<hvuint64_t> &prev(jump[i - 1u]);
+					const hvuint64_t *v(&prev[j * nWords]);
+					for (unsigned int k = 0u; k < width; k++) {
+						if ((v[k / 64u] >> (k % 64u)) & 1u) {
+							for (unsigned int w = 0u; w < nWords; w++) {
+								col[w] ^= prev[k * nWords + w];
+							}
+						}
+					}
+				}
+			}
+			jump.push_back(matrix);
+		}
+		if (nSteps & 1u) {
+			this->applyMatrix(jump[i]);
+		}
+	}
+}
+
+void Lfsr::extend(hvuint64_t *words, std::size_t from,
+		const std::size_t &to) const {
+	const std::size_t leapStart(leapDelays.back());
+	while (from < to) {
+		if ((from >= leapStart) && !(from % 64u) && (to - from >= 64u)) {
+			// Aligned whole words, trinomials being the common case
+			const std::size_t end(to / 64u);
+			std::size_t i(from / 64u);
+			if (leapDelays.size() == 2u) {
+				const unsigned int e0(leapDelays[0]), e1(leapDelays[1]);
+				for (; i < end; i++) {
+					words[i] = getDelayedWord(words, i, e0)
+							^ getDelayedWord(words, i, e1);
+				}
+			} else {
+				for (; i < end; i++) {
+					hvuint64_t x(0u);
+					for (const unsigned int &e : leapDelays) {
+						x ^= getDelayedWord(words, i, e);
+					}
+					words[i] = x;
+				}
+			}
+			from = i * 64u;
+			continue;
+		}
+		const unsigned int room(64u - from % 64u);
+		unsigned int n;
+		hvuint64_t x(0u);
+		if (from >= leapStart) {
+			// Whole words from the squared polynomial
+			n = static_cast<unsigned int>(HV_MIN(room, to - from));
+			for (const unsigned int &e : leapDelays) {
+				x ^= getBits(words, from - e, n);
+			}
+		} else {
+			// Up to the smallest delay at once, using the largest squared
+			// polynomial available so far
+			std::size_t f(1u);
+			while ((f < leapFactor) && (2u * f * width <= from)) {
+				f *= 2u;
+			}
+			n = static_cast<unsigned int>(HV_MIN(
+					HV_MIN(static_cast<std::size_t>(room), delays.front() * f),
+					to - from));
+			for (const unsigned int &e : delays) {
+				x ^= getBits(words, from - e * f, n);
+			}
+		}
+		setBits(words, from, x, n);
+		from += n;
+	}
+}
+
+void Lfsr::applyMatrix(const std::vector<hvuint64_t> &matrix) {
+	std::vector<hvuint64_t> ret(nWords, 0u);
+	for (unsigned int j = 0u; j < width; j++) {
+		if ((state[j / 64u] >> (j % 64u)) & 1u) {
+			for (unsigned int w = 0u; w < nWords; w++) {
+				ret[w] ^= matrix[j * nWords + w];
+			}
+		}
+	}
+	state.swap(ret);
+}
+
+} // namespace common
+} // namespace hv
@@ -0,0 +1,199 @@
+/**
+ * @file lfsr.h
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Word-parallel linear feedback shift register and PRBS generator
+ */
+
+#ifndef HV_LFSR_H
+#define HV_LFSR_H
+
+#include <cstddef>
+#include <vector>
+#include "datatypes.h"
+#include "bitvector.h"
+
+/**
+ * Maximum LFSR width
+ */
+#define HV_LFSR_MAX_WIDTH 1024
+
+namespace hv {
+namespace common {
+
+/**
+ * LFSR state representation
+ */
+typedef enum {
+	LFSR_FIBONACCI, // Shift register holding the next outputs, bit 0 first
+	LFSR_GALOIS     // Right-shifting register, output bit 0 XORed into taps
+} hvlfsrtype_t;
+
+/**
+ * Linear feedback shift register
+ *
+ * Taps are given as a BitVector of the LFSR width, bit e - 1 being set for
+ * each x^e term of the feedback polynomial 1 + ... + x^width. The output
+ * sequence then satisfies b[k] = XOR of b[k - e] over taps e; e.g.
+ * x^7 + x^6 + 1 (PRBS7) is built from taps 7 and 6.
+ *
+ * Fibonacci and Galois registers with the same taps produce the same
+ * sequence; the type only changes the meaning of getState() and setState().
+ *
+ * generate() fills buffers 64 bits at a time: the feedback polynomial is
+ * squared until all delays span several words (P(x)^2 = P(x^2) over GF(2)),
+ * so that each output word is computed from earlier output words with a few
+ * shifts and XORs. advance() uses jump matrices (powers of 2 of the transition
+ * matrix), computed on first use.
+ */
+class Lfsr {
+public:
+	typedef BitVector::bvsize_t bvsize_t;
+
+	/**
+	 * Constructor
+	 * @param taps Feedback taps (width of the LFSR, MSB set)
+	 * @param seed Initial state (non-zero, same width as taps)
+	 * @param type State representation
+	 */
+	Lfsr(const BitVector &taps, const BitVector &seed, const hvlfsrtype_t &type =
+			LFSR_FIBONACCI);
+
+	virtual ~Lfsr();
+
+	/**
+	 * ITU-T O.150 PRBS generator: PRBS7, 9, 11, 15, 20, 23 or 31, seeded
+	 * with all ones
+	 * @param order PRBS order
+	 * @return Fibonacci LFSR
+	 */
+	static Lfsr prbs(const unsigned int &order);
+
+	/**
+	 * ITU-T O.150 PRBS generator
+	 * @param order PRBS order
+	 * @param seed Initial state (order bits)
+	 * @return Fibonacci LFSR
+	 */
+	static Lfsr prbs(const unsigned int &order, const BitVector &seed);
+
+	//** Accessors **//
+	/**
+	 * Get LFSR width
+	 * @return Width in bits
+	 */
+	bvsize_t getWidth() const;
+
+	/**
+	 * Get feedback taps
+	 * @return Taps
+	 */
+	BitVector getTaps() const;
+
+	/**
+	 * Get state representation
+	 * @return LFSR type
+	 */
+	hvlfsrtype_t getType() const;
+
+	/**
+	 * Get current state
+	 * @return State (width bits)
+	 */
+	BitVector getState() const;
+
+	/**
+	 * Set current state
+	 * @param state New state (non-zero, width bits)
+	 */
+	void setState(const BitVector &state);
+
+	//** Sequence generation **//
+	/**
+	 * Single step
+	 * @return Output bit
+	 */
+	bool step();
+
+	/**
+	 * Next output bits
+	 * @param nBits Number of bits
+	 * @return Output bits, first output as bit 0
+	 */
+	BitVector next(const bvsize_t &nBits);
+
+	/**
+	 * Fill a buffer with the next output bits
+	 * Bits beyond nBits in the last word are cleared.
+	 * @param dst Destination words, first output as bit 0 of dst[0]
+	 * @param nBits Number of bits
+	 */
+	void generate(hvuint64_t *dst, const std::size_t &nBits);
+
+	/**
+	 * Skip output bits
+	 * @param nSteps Number of steps
+	 */
+	void advance(hvuint64_t nSteps);
+
+protected:
+	/**
+	 * Computes positions [from, to) of an output stream from the earlier
+	 * positions (from >= width)
+	 */
+	void extend(hvuint64_t *words, std::size_t from, const std::size_t &to) const;
+
+	/**
+	 * Apply a jump matrix to the state
+	 */
+	void applyMatrix(const std::vector<hvuint64_t> &matrix);
+
+	/**
+	 * LFSR width
+	 */
+	bvsize_t width;
+
+	/**
+	 * State representation
+	 */
+	hvlfsrtype_t type;
+
+	/**
+	 * Number of 64-bit words of the state
+	 */
+	unsigned int nWords;
+
+	/**
+	 * Feedback delays, ascending
+	 */
+	std::vector<unsigned int> delays;
+
+	/**
+	 * Delays of the squared feedback polynomial (delays * leapFactor)
+	 */
+	std::vector<unsigned int> leapDelays;
+	unsigned int leapFactor;
+
+	/**
+	 * Feedback mask on the state (bit width - e for each delay e)
+	 */
+	std::vector<hvuint64_t> feedback;
+
+	/**
+	 * Next width output bits, first output as bit 0
+	 */
+	std::vector<hvuint64_t> state;
+
+	/**
+	 * Jump matrices: jump[i] holds the columns of the transition matrix
+	 * raised to the power 2^i
+	 */
+	std::vector<std::vector<hvuint64_t> > jump;
+};
+
+} // namespace common
+} // namespace hv
+
+#endif // HV_LFSR_H
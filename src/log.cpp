@@ -59,8 +59,30 @@ void setLogLevel(enum log::LogLevel logLevel) {
 			break;
 	}
 }
+
+enum log::LogLevel getLogLevel() {
+	switch(hv::common::_getMainLogger()->level()) {
+		case spdlog::level::trace:
+			return log::trace;
+		case spdlog::level::debug:
+			return log::debug;
+		case spdlog::level::info:
+			return log::info;
+		case spdlog::level::warn:
+			return log::warning;
+		case spdlog::level::err:
+			return log::error;
+		case spdlog::level::critical:
+			return log::critical;
+		default:
+			return log::off;
+	}
+}
 #else
 void setLogLevel(enum log::LogLevel logLevel) {};
+enum log::LogLevel getLogLevel() {
+	return log::off;
+}
 #endif
 
 }
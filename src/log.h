@@ -157,6 +157,13 @@ namespace log {
 
 void setLogLevel(enum log::LogLevel logLevel);
 
+/**
+ * Get the main logger run-time level
+ *
+ * @return Log level
+ */
+enum log::LogLevel getLogLevel();
+
 } // namespace common
 } // namespace hv
 
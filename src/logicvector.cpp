@@ -0,0 +1,341 @@
+/**
+ * @file logicvector.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Four-state (0/1/X/Z) logic vector built on BitVector
+ */
+
+#include "logicvector.h"
+
+namespace hv {
+namespace common {
+
+typedef LogicVector::bvdata_t lvdata_t;
+typedef LogicVector::bvsize_t lvsize_t;
+
+/**
+ * Cell-wise truth tables
+ * Each functor computes result planes (rv, ru) from operand planes.
+ */
+struct LogicAndCells {
+	inline void operator ()(const lvdata_t &va, const lvdata_t &ua,
+			const lvdata_t &vb, const lvdata_t &ub, lvdata_t &rv,
+			lvdata_t &ru) const {
+		// r0: any operand is 0, r1: both operands are 1
+		const lvdata_t r0((~ua & ~va) | (~ub & ~vb));
+		const lvdata_t r1((~ua & va) & (~ub & vb));
+		ru = ~(r0 | r1);
+		rv = ~r0;
+	}
+};
+
+struct LogicOrCells {
+	inline void operator ()(const lvdata_t &va, const lvdata_t &ua,
+			const lvdata_t &vb, const lvdata_t &ub, lvdata_t &rv,
+			lvdata_t &ru) const {
+		// r1: any operand is 1, r0: both operands are 0
+		const lvdata_t r1((~ua & va) | (~ub & vb));
+		const lvdata_t r0((~ua & ~va) & (~ub & ~vb));
+		ru = ~(r0 | r1);
+		rv = ~r0;
+	}
+};
+
+struct LogicXorCells {
+	inline void operator ()(const lvdata_t &va, const lvdata_t &ua,
+			const lvdata_t &vb, const lvdata_t &ub, lvdata_t &rv,
+			lvdata_t &ru) const {
+		ru = ua | ub;
+		rv = (va ^ vb) | ru;
+	}
+};
+
+struct LogicResolveCells {
+	inline void operator ()(const lvdata_t &va, const lvdata_t &ua,
+			const lvdata_t &vb, const lvdata_t &ub, lvdata_t &rv,
+			lvdata_t &ru) const {
+		const lvdata_t za(ua & ~va);
+		const lvdata_t zb(ub & ~vb);
+		// Non-Z drivers: equal values are kept, conflicts become X
+		const lvdata_t conflict((ua ^ ub) | (va ^ vb));
+		const lvdata_t un(conflict | ua);
+		const lvdata_t vn(conflict | va);
+		ru = (za & ub) | (~za & zb & ua) | (~za & ~zb & un);
+		rv = (za & vb) | (~za & zb & va) | (~za & ~zb & vn);
+	}
+};
+
+/**
+ * Applies a cell-wise truth table on two LogicVectors
+ *
+ * Bits beyond the size of an operand are replaced by the extension cells.
+ * Result planes may alias operand planes.
+ * @param va Left-hand operand value plane
+ * @param ua Left-hand operand unknown plane
+ * @param vb Right-hand operand value plane
+ * @param ub Right-hand operand unknown plane
+ * @param extV Value plane extension cell for the smallest operand
+ * @param extU Unknown plane extension cell for the smallest operand
+ * @param f Truth table functor
+ * @param rv Result value plane
+ * @param ru Result unknown plane
+ */
+template<typename F>
+static inline void logicCellOp(const BitVector &va, const BitVector &ua,
+		const BitVector &vb, const BitVector &ub, const lvdata_t &extV,
+		const lvdata_t &extU, const F &f, BitVector &rv, BitVector &ru) {
+	const lvsize_t nCells(rv.getArraySize());
+	const lvsize_t nA(va.getArraySize());
+	const lvsize_t nB(vb.getArraySize());
+	const lvdata_t *pva(va.getDataAddress()), *pua(ua.getDataAddress());
+	const lvdata_t *pvb(vb.getDataAddress()), *pub(ub.getDataAddress());
+	lvdata_t *prv(rv.getDataAddress()), *pru(ru.getDataAddress());
+	const lvdata_t maskA(va.getmaskLastCell()), maskB(vb.getmaskLastCell());
+
+	for (lvsize_t i = 0u; i < nCells; i++) {
+		lvdata_t cva(extV), cua(extU), cvb(extV), cub(extU);
+		if (i + 1u < nA) {
+			cva = pva[i];
+			cua = pua[i];
+		} else if (i + 1u == nA) {
+			cva = (pva[i] & maskA) | (extV & ~maskA);
+			cua = (pua[i] & maskA) | (extU & ~maskA);
+		}
+		if (i + 1u < nB) {
+			cvb = pvb[i];
+			cub = pub[i];
+		} else if (i + 1u == nB) {
+			cvb = (pvb[i] & maskB) | (extV & ~maskB);
+			cub = (pub[i] & maskB) | (extU & ~maskB);
+		}
+		f(cva, cua, cvb, cub, prv[i], pru[i]);
+	}
+}
+
+LogicVector::LogicVector(const bvsize_t &size, const hvlogic_t &value) :
+		value(size, false), unknown(size, false) {
+	this->operator =(value);
+}
+
+LogicVector::LogicVector(const bvsize_t &size, const BitVector &value) :
+		value(size, value), unknown(size, false) {
+}
+
+LogicVector::LogicVector(const BitVector &value) :
+		value(value.getSize(), value), unknown(value.getSize(), false) {
+}
+
+LogicVector::LogicVector(const BitVector &value, const BitVector &unknown) :
+		value(HV_MAX(value.getSize(), unknown.getSize()), value), unknown(
+				HV_MAX(value.getSize(), unknown.getSize()), unknown) {
+}
+
+LogicVector::LogicVector(const bvsize_t &size, const std::string &value) :
+		value(size, false), unknown(size, false) {
+	this->fromString(value);
+}
+
+LogicVector::LogicVector(const std::string &value) :
+		LogicVector(value.length(), value) {
+}
+
+LogicVector::LogicVector(const LogicVector &src) :
+		value(src.value.getSize(), src.value), unknown(src.unknown.getSize(),
+				src.unknown) {
+}
+
+LogicVector::~LogicVector() {
+}
+
+LogicVector::bvsize_t LogicVector::getSize() const {
+	return value.getSize();
+}
+
+BitVector& LogicVector::getValuePlane() {
+	return value;
+}
+
+const BitVector& LogicVector::getValuePlane() const {
+	return value;
+}
+
+BitVector& LogicVector::getUnknownPlane() {
+	return unknown;
+}
+
+const BitVector& LogicVector::getUnknownPlane() const {
+	return unknown;
+}
+
+hvlogic_t LogicVector::get(const bvsize_t &ind) const {
+	HV_ASSERT(ind < value.getSize(), "LogicVector index out of range");
+	const bvsize_t cell(HV_BV_ABS_POS_TO_ARRAY_INDEX(ind));
+	const bvsize_t pos(HV_BV_ABS_POS_TO_REL_POS(ind));
+	const bvdata_t v((value.getDataAddress()[cell] >> pos) & 1u);
+	const bvdata_t u((unknown.getDataAddress()[cell] >> pos) & 1u);
+	return static_cast<hvlogic_t>((u << 1) | v);
+}
+
+void LogicVector::set(const bvsize_t &ind, const hvlogic_t &value) {
+	HV_ASSERT(ind < this->value.getSize(), "LogicVector index out of range");
+	const bvsize_t cell(HV_BV_ABS_POS_TO_ARRAY_INDEX(ind));
+	const bvdata_t mask(
+			static_cast<bvdata_t>(1u) << HV_BV_ABS_POS_TO_REL_POS(ind));
+	bvdata_t *pv(this->value.getDataAddress());
+	bvdata_t *pu(this->unknown.getDataAddress());
+	pv[cell] = (value & LOGIC_1) ? (pv[cell] | mask) : (pv[cell] & ~mask);
+	pu[cell] = (value & LOGIC_Z) ? (pu[cell] | mask) : (pu[cell] & ~mask);
+}
+
+bool LogicVector::isFullyKnown() const {
+	return !unknown;
+}
+
+BitVector LogicVector::toBitVector() const {
+	return value & ~unknown;
+}
+
+LogicVector& LogicVector::operator =(const hvlogic_t &src) {
+	const bvdata_t v((src & LOGIC_1) ? ~static_cast<bvdata_t>(0u) : 0u);
+	const bvdata_t u((src & LOGIC_Z) ? ~static_cast<bvdata_t>(0u) : 0u);
+	bvdata_t *pv(value.getDataAddress());
+	bvdata_t *pu(unknown.getDataAddress());
+	for (bvsize_t i = 0u; i < value.getArraySize(); i++) {
+		pv[i] = v;
+		pu[i] = u;
+	}
+	return *this;
+}
+
+LogicVector& LogicVector::operator =(const BitVector &src) {
+	value = src;
+	unknown = false;
+	return *this;
+}
+
+LogicVector& LogicVector::operator =(const LogicVector &src) {
+	value = src.value;
+	unknown = src.unknown;
+	return *this;
+}
+
+bool LogicVector::operator ==(const LogicVector &op2) const {
+	return (value == op2.value) && (unknown == op2.unknown);
+}
+
+bool LogicVector::operator !=(const LogicVector &op2) const {
+	return !(this->operator ==(op2));
+}
+
+LogicVector LogicVector::operator ~() const {
+	LogicVector ret(value.getSize(), LOGIC_0);
+	const bvdata_t *pv(value.getDataAddress()), *pu(unknown.getDataAddress());
+	bvdata_t *prv(ret.value.getDataAddress());
+	bvdata_t *pru(ret.unknown.getDataAddress());
+	for (bvsize_t i = 0u; i < value.getArraySize(); i++) {
+		pru[i] = pu[i];
+		prv[i] = ~pv[i] | pu[i];
+	}
+	return ret;
+}
+
+LogicVector LogicVector::operator &(const LogicVector &op2) const {
+	LogicVector ret(HV_MAX(this->getSize(), op2.getSize()), LOGIC_0);
+	logicCellOp(value, unknown, op2.value, op2.unknown, 0u, 0u,
+			LogicAndCells(), ret.value, ret.unknown);
+	return ret;
+}
+
+LogicVector LogicVector::operator |(const LogicVector &op2) const {
+	LogicVector ret(HV_MAX(this->getSize(), op2.getSize()), LOGIC_0);
+	logicCellOp(value, unknown, op2.value, op2.unknown, 0u, 0u,
+			LogicOrCells(), ret.value, ret.unknown);
+	return ret;
+}
+
+LogicVector LogicVector::operator ^(const LogicVector &op2) const {
+	LogicVector ret(HV_MAX(this->getSize(), op2.getSize()), LOGIC_0);
+	logicCellOp(value, unknown, op2.value, op2.unknown, 0u, 0u,
+			LogicXorCells(), ret.value, ret.unknown);
+	return ret;
+}
+
+LogicVector& LogicVector::operator &=(const LogicVector &op2) {
+	logicCellOp(value, unknown, op2.value, op2.unknown, 0u, 0u,
+			LogicAndCells(), value, unknown);
+	return *this;
+}
+
+LogicVector& LogicVector::operator |=(const LogicVector &op2) {
+	logicCellOp(value, unknown, op2.value, op2.unknown, 0u, 0u,
+			LogicOrCells(), value, unknown);
+	return *this;
+}
+
+LogicVector& LogicVector::operator ^=(const LogicVector &op2) {
+	logicCellOp(value, unknown, op2.value, op2.unknown, 0u, 0u,
+			LogicXorCells(), value, unknown);
+	return *this;
+}
+
+LogicVector LogicVector::resolve(const LogicVector &op2) const {
+	LogicVector ret(HV_MAX(this->getSize(), op2.getSize()), LOGIC_0);
+	logicCellOp(value, unknown, op2.value, op2.unknown, 0u,
+			~static_cast<bvdata_t>(0u), LogicResolveCells(), ret.value,
+			ret.unknown);
+	return ret;
+}
+
+void LogicVector::fromString(const std::string &src) {
+	const bvsize_t size(value.getSize());
+	const bvsize_t assignmentLength(HV_MIN(src.length(), size));
+	this->operator =(LOGIC_0);
+	for (bvsize_t i = 0u; i < assignmentLength; i++) {
+#ifdef HV_BV_STR_MSB_FIRST
+		const char c(src[assignmentLength - i - 1u]);
+#else
+		const char c(src[i]);
+#endif
+		switch (c) {
+		case '0':
+			break;
+		case '1':
+			this->set(i, LOGIC_1);
+			break;
+		case 'x':
+		case 'X':
+			this->set(i, LOGIC_X);
+			break;
+		case 'z':
+		case 'Z':
+			this->set(i, LOGIC_Z);
+			break;
+		default:
+			HV_LOG_ERROR("Invalid character '{}' in LogicVector string", c);
+			HV_EXIT_FAILURE();
+		}
+	}
+}
+
+std::string LogicVector::toString() const {
+	static const char LOGIC_CHARS[] = { '0', '1', 'Z', 'X' };
+	const bvsize_t size(value.getSize());
+	std::string ret(size, '0');
+	for (bvsize_t i = 0u; i < size; i++) {
+#ifdef HV_BV_STR_MSB_FIRST
+		ret[size - i - 1u] = LOGIC_CHARS[this->get(i)];
+#else
+		ret[i] = LOGIC_CHARS[this->get(i)];
+#endif
+	}
+	return ret;
+}
+
+std::ostream& operator <<(std::ostream &strm, const LogicVector &lv) {
+	return strm << lv.toString();
+}
+
+} // namespace common
+} // namespace hv
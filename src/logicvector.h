@@ -0,0 +1,310 @@
+/**
+ * @file logicvector.h
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Four-state (0/1/X/Z) logic vector built on BitVector
+ */
+
+#ifndef HV_LOGICVECTOR_H
+#define HV_LOGICVECTOR_H
+
+#include <iostream>
+#include <string>
+#include "bitvector.h"
+
+namespace hv {
+namespace common {
+
+/**
+ * Four-state logic values
+ *
+ * Encoding is (unknown << 1) | value, which matches SystemC's
+ * sc_logic_value_t.
+ */
+typedef enum {
+	LOGIC_0 = 0,
+	LOGIC_1 = 1,
+	LOGIC_Z = 2,
+	LOGIC_X = 3
+} hvlogic_t;
+
+/**
+ * Class for four-state logic vector representation and manipulation
+ *
+ * A LogicVector is stored as two BitVector bit-planes sharing BitVector's
+ * word layout:
+ *   - value plane: 0 for LOGIC_0 and LOGIC_Z, 1 for LOGIC_1 and LOGIC_X
+ *   - unknown plane: 0 for LOGIC_0 and LOGIC_1, 1 for LOGIC_X and LOGIC_Z
+ *
+ * All logic operations are evaluated cell by cell on both planes.
+ * Binary operations on LogicVectors of different sizes return a LogicVector
+ * of the largest size, the smallest operand being extended with 0s.
+ */
+class LogicVector {
+public:
+	typedef BitVector::bvsize_t bvsize_t;
+	typedef BitVector::bvdata_t bvdata_t;
+
+	//** Constructors **//
+	/**
+	 * Constructor from a logic value
+	 * @param size Logic vector size
+	 * @param value Value of all bits
+	 */
+	LogicVector(const bvsize_t &size, const hvlogic_t &value);
+
+	/**
+	 * Constructor from a two-state value
+	 * @param size Logic vector size
+	 * @param value Initial value (all bits are known)
+	 */
+	LogicVector(const bvsize_t &size, const BitVector &value);
+
+	/**
+	 * Constructor from a two-state value
+	 * Size is the size of the given BitVector
+	 * @param value Initial value (all bits are known)
+	 */
+	explicit LogicVector(const BitVector &value);
+
+	/**
+	 * Constructor from bit-planes
+	 * Size is the size of the largest plane
+	 * @param value Value plane
+	 * @param unknown Unknown plane
+	 */
+	LogicVector(const BitVector &value, const BitVector &unknown);
+
+	/**
+	 * Constructor from std::string value
+	 *
+	 * The string must be composed of '0', '1', 'X' and 'Z' characters
+	 * ('x' and 'z' are accepted). LSB or MSB first is defined by macro
+	 * HV_BV_STR_MSB_FIRST.
+	 * @param size Logic vector size
+	 * @param value Initial value
+	 */
+	LogicVector(const bvsize_t &size, const std::string &value);
+
+	/**
+	 * Constructor from std::string value
+	 * Size is the length of the string
+	 * @param value Initial value
+	 */
+	explicit LogicVector(const std::string &value);
+
+	/**
+	 * Copy constructor
+	 * @param src Copy source
+	 */
+	LogicVector(const LogicVector &src);
+
+	//** Destructor **//
+	virtual ~LogicVector();
+
+	//** Accessors **//
+	/**
+	 * Get LogicVector size in bits
+	 * @return Size in bits
+	 */
+	bvsize_t getSize() const;
+
+	/**
+	 * Get value plane
+	 * @return Value plane
+	 */
+	BitVector& getValuePlane();
+
+	/**
+	 * Get value plane (const version)
+	 * @return Value plane
+	 */
+	const BitVector& getValuePlane() const;
+
+	/**
+	 * Get unknown plane
+	 * @return Unknown plane
+	 */
+	BitVector& getUnknownPlane();
+
+	/**
+	 * Get unknown plane (const version)
+	 * @return Unknown plane
+	 */
+	const BitVector& getUnknownPlane() const;
+
+	/**
+	 * Get the logic value of a bit
+	 * @param ind Bit index
+	 * @return Logic value
+	 */
+	hvlogic_t get(const bvsize_t &ind) const;
+
+	/**
+	 * Set the logic value of a bit
+	 * @param ind Bit index
+	 * @param value Logic value
+	 */
+	void set(const bvsize_t &ind, const hvlogic_t &value);
+
+	/**
+	 * Checks that no bit is X or Z
+	 * @return True if all bits are 0 or 1, false else
+	 */
+	bool isFullyKnown() const;
+
+	/**
+	 * Conversion to BitVector
+	 *
+	 * X and Z bits are converted to 0.
+	 * @return BitVector of same size
+	 */
+	BitVector toBitVector() const;
+
+	//** Operators overloading **//
+	/**
+	 * Assignment from logic value
+	 * @param src Value of all bits
+	 * @return Reference to this
+	 */
+	LogicVector& operator =(const hvlogic_t &src);
+
+	/**
+	 * Assignment from BitVector
+	 *
+	 * Size is kept: source is truncated or extended with 0s.
+	 * @param src Source for assignment
+	 * @return Reference to this
+	 */
+	LogicVector& operator =(const BitVector &src);
+
+	/**
+	 * Assignment from LogicVector
+	 *
+	 * Size is kept: source is truncated or extended with 0s.
+	 * @param src Source for assignment
+	 * @return Reference to this
+	 */
+	LogicVector& operator =(const LogicVector &src);
+
+	/**
+	 * Equal comparison
+	 * X and Z are only equal to themselves.
+	 * @param op2 Right-hand operand
+	 * @return True if equal, false else
+	 */
+	bool operator ==(const LogicVector &op2) const;
+
+	/**
+	 * Different comparison
+	 * @param op2 Right-hand operand
+	 * @return True if different, false else
+	 */
+	bool operator !=(const LogicVector &op2) const;
+
+	/**
+	 * Logic negation
+	 * ~0 = 1, ~1 = 0, ~X = ~Z = X
+	 * @return Negated LogicVector
+	 */
+	LogicVector operator ~() const;
+
+	/**
+	 * Logic AND
+	 * 0 is dominant, 1 & 1 = 1, X otherwise
+	 * @param op2 Right-hand operand
+	 * @return Logic AND result
+	 */
+	LogicVector operator &(const LogicVector &op2) const;
+
+	/**
+	 * Logic OR
+	 * 1 is dominant, 0 | 0 = 0, X otherwise
+	 * @param op2 Right-hand operand
+	 * @return Logic OR result
+	 */
+	LogicVector operator |(const LogicVector &op2) const;
+
+	/**
+	 * Logic XOR
+	 * X if any operand bit is X or Z
+	 * @param op2 Right-hand operand
+	 * @return Logic XOR result
+	 */
+	LogicVector operator ^(const LogicVector &op2) const;
+
+	/**
+	 * Logic AND and assignment
+	 * @param op2 Right-hand operand
+	 * @return Reference to this
+	 */
+	LogicVector& operator &=(const LogicVector &op2);
+
+	/**
+	 * Logic OR and assignment
+	 * @param op2 Right-hand operand
+	 * @return Reference to this
+	 */
+	LogicVector& operator |=(const LogicVector &op2);
+
+	/**
+	 * Logic XOR and assignment
+	 * @param op2 Right-hand operand
+	 * @return Reference to this
+	 */
+	LogicVector& operator ^=(const LogicVector &op2);
+
+	/**
+	 * Resolution of two drivers
+	 *
+	 * Z yields to the other driver, equal values resolve to themselves,
+	 * conflicting values resolve to X. The smallest operand is extended
+	 * with Zs.
+	 * @param op2 Second driver
+	 * @return Resolved LogicVector
+	 */
+	LogicVector resolve(const LogicVector &op2) const;
+
+	//** Helpers **//
+	/**
+	 * Assignment from string
+	 *
+	 * LSB or MSB first is defined by macro HV_BV_STR_MSB_FIRST
+	 * @param src Source for assignment
+	 */
+	void fromString(const std::string &src);
+
+	/**
+	 * Conversion to string
+	 *
+	 * LSB or MSB first is defined by macro HV_BV_STR_MSB_FIRST
+	 * @return String of 0s, 1s, Xs and Zs
+	 */
+	std::string toString() const;
+
+	/**
+	 * Output stream operator overloading
+	 * @param strm Stream
+	 * @param lv Logic vector object to output
+	 * @return Stream
+	 */
+	friend std::ostream& operator <<(std::ostream &strm, const LogicVector &lv);
+
+protected:
+	/**
+	 * Value plane
+	 */
+	BitVector value;
+
+	/**
+	 * Unknown plane
+	 */
+	BitVector unknown;
+};
+
+} // namespace common
+} // namespace hv
+
+#endif // HV_LOGICVECTOR_H
@@ -0,0 +1,521 @@
+/**
+ * @file packedlanes.h
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Lane-wise packed-SIMD view over BitVector for vector register models
+ */
+
+#ifndef HV_PACKED_LANES_H
+#define HV_PACKED_LANES_H
+
+#include <cstring>
+#include <type_traits>
+#include "datatypes.h"
+#include "hvutils.h"
+#include "bitvector.h"
+
+/**
+ * Number of bytes processed at once by lane-wise operations
+ */
+#define HV_PL_CHUNK_BYTES 64u
+
+namespace hv {
+namespace common {
+
+/**
+ * Packed-lane view over a BitVector
+ *
+ * Slices a BitVector register into lanes of type T (hvuint8_t, hvuint16_t,
+ * hvuint32_t or hvuint64_t), lane i holding bits [i * W + W - 1 : i * W]
+ * with W the lane width. The register size must be a multiple of W.
+ *
+ * Operations write lanes of the viewed register from lanes of source
+ * BitVectors of the same size, which may be the viewed register itself.
+ * Masked variants take a BitVector holding one bit per lane (bit i for
+ * lane i, as a RISC-V V v0 mask) and leave lanes with a cleared mask bit
+ * unchanged. Comparisons return such masks.
+ *
+ * Lanes are processed by chunks of HV_PL_CHUNK_BYTES copied out of the
+ * BitVector storage, with fixed-size loops the compiler maps to host SIMD
+ * instructions.
+ */
+template<typename T> class PackedLanes {
+	static_assert(std::is_unsigned<T>::value && (sizeof(T) <= sizeof(hvuint64_t)),
+			"PackedLanes lane type must be an unsigned integer of 8 to 64 bits");
+public:
+	typedef T lane_t;
+	typedef typename std::make_signed<T>::type slane_t;
+	typedef BitVector::bvdata_t bvdata_t;
+	typedef BitVector::bvsize_t bvsize_t;
+
+	/**
+	 * Lane width in bits
+	 */
+	static const unsigned int LANE_WIDTH = BITWIDTH_OF(T);
+
+	/**
+	 * Constructor
+	 * @param reg Viewed register (size multiple of the lane width)
+	 */
+	explicit PackedLanes(BitVector &reg) :
+			reg(reg), nLanes(reg.getSize() / LANE_WIDTH) {
+		HV_ASSERT(!(reg.getSize() % LANE_WIDTH),
+				"Register size {} is not a multiple of the lane width {}",
+				reg.getSize(), LANE_WIDTH);
+	}
+
+	virtual ~PackedLanes() {
+	}
+
+	//** Lane accessors **//
+	/**
+	 * Get number of lanes
+	 * @return Number of lanes
+	 */
+	bvsize_t getNLanes() const {
+		return nLanes;
+	}
+
+	/**
+	 * Get lane value
+	 * @param i Lane index
+	 * @return Lane value
+	 */
+	T get(const bvsize_t &i) const {
+		HV_ASSERT(i < nLanes, "Lane index {} out of range ({} lanes)", i, nLanes);
+		T x[CHUNK_LANES];
+		PackedLanes::load(reg, i, 1u, x);
+		return x[0];
+	}
+
+	/**
+	 * Set lane value
+	 * @param i Lane index
+	 * @param x Lane value
+	 */
+	void set(const bvsize_t &i, const T &x) {
+		HV_ASSERT(i < nLanes, "Lane index {} out of range ({} lanes)", i, nLanes);
+		this->store(i, 1u, &x);
+		reg.syncParent();
+	}
+
+	/**
+	 * Set all lanes to the same value
+	 * @param x Lane value
+	 */
+	void fill(const T &x) {
+		T r[CHUNK_LANES];
+		for (unsigned int j = 0u; j < CHUNK_LANES; j++) {
+			r[j] = x;
+		}
+		for (bvsize_t base = 0u; base < nLanes; base += CHUNK_LANES) {
+			this->store(base, this->chunkLanes(base), r);
+		}
+		reg.syncParent();
+	}
+
+	//** Arithmetic **//
+	/**
+	 * Wrapping addition: lane = a + b
+	 */
+	void add(const BitVector &a, const BitVector &b) {
+		this->apply(a, b, nullptr, Add());
+	}
+	void add(const BitVector &a, const BitVector &b, const BitVector &mask) {
+		this->apply(a, b, &mask, Add());
+	}
+
+	/**
+	 * Wrapping subtraction: lane = a - b
+	 */
+	void sub(const BitVector &a, const BitVector &b) {
+		this->apply(a, b, nullptr, Sub());
+	}
+	void sub(const BitVector &a, const BitVector &b, const BitVector &mask) {
+		this->apply(a, b, &mask, Sub());
+	}
+
+	/**
+	 * Unsigned minimum: lane = min(a, b)
+	 */
+	void min(const BitVector &a, const BitVector &b) {
+		this->apply(a, b, nullptr, Min());
+	}
+	void min(const BitVector &a, const BitVector &b, const BitVector &mask) {
+		this->apply(a, b, &mask, Min());
+	}
+
+	/**
+	 * Unsigned maximum: lane = max(a, b)
+	 */
+	void max(const BitVector &a, const BitVector &b) {
+		this->apply(a, b, nullptr, Max());
+	}
+	void max(const BitVector &a, const BitVector &b, const BitVector &mask) {
+		this->apply(a, b, &mask, Max());
+	}
+
+	/**
+	 * Signed (two's complement) minimum: lane = min(a, b)
+	 */
+	void minSigned(const BitVector &a, const BitVector &b) {
+		this->apply(a, b, nullptr, MinSigned());
+	}
+	void minSigned(const BitVector &a, const BitVector &b,
+			const BitVector &mask) {
+		this->apply(a, b, &mask, MinSigned());
+	}
+
+	/**
+	 * Signed (two's complement) maximum: lane = max(a, b)
+	 */
+	void maxSigned(const BitVector &a, const BitVector &b) {
+		this->apply(a, b, nullptr, MaxSigned());
+	}
+	void maxSigned(const BitVector &a, const BitVector &b,
+			const BitVector &mask) {
+		this->apply(a, b, &mask, MaxSigned());
+	}
+
+	//** Shifts (amount taken modulo the lane width) **//
+	/**
+	 * Logical left shift: lane = a << n
+	 */
+	void shiftLeft(const BitVector &a, const unsigned int &n) {
+		this->apply(a, a, nullptr, ShiftLeft(n));
+	}
+	void shiftLeft(const BitVector &a, const unsigned int &n,
+			const BitVector &mask) {
+		this->apply(a, a, &mask, ShiftLeft(n));
+	}
+
+	/**
+	 * Logical right shift: lane = a >> n
+	 */
+	void shiftRight(const BitVector &a, const unsigned int &n) {
+		this->apply(a, a, nullptr, ShiftRight(n));
+	}
+	void shiftRight(const BitVector &a, const unsigned int &n,
+			const BitVector &mask) {
+		this->apply(a, a, &mask, ShiftRight(n));
+	}
+
+	/**
+	 * Arithmetic right shift: lane = a >> n, sign bit replicated
+	 */
+	void shiftRightArith(const BitVector &a, const unsigned int &n) {
+		this->apply(a, a, nullptr, ShiftRightArith(n));
+	}
+	void shiftRightArith(const BitVector &a, const unsigned int &n,
+			const BitVector &mask) {
+		this->apply(a, a, &mask, ShiftRightArith(n));
+	}
+
+	//** Selection **//
+	/**
+	 * Merge: lane = mask ? a : b
+	 * @param mask One bit per lane
+	 * @param a Lanes selected by set mask bits
+	 * @param b Lanes selected by cleared mask bits
+	 */
+	void select(const BitVector &mask, const BitVector &a, const BitVector &b) {
+		this->checkOperand(a);
+		this->checkOperand(b);
+		this->checkMask(mask);
+		T x[CHUNK_LANES], y[CHUNK_LANES], m[CHUNK_LANES], r[CHUNK_LANES];
+		for (bvsize_t base = 0u; base < nLanes; base += CHUNK_LANES) {
+			const unsigned int n(this->chunkLanes(base));
+			PackedLanes::load(a, base, n, x);
+			PackedLanes::load(b, base, n, y);
+			PackedLanes::expandMask(mask, base, m);
+			for (unsigned int j = 0u; j < CHUNK_LANES; j++) {
+				r[j] = static_cast<T>((x[j] & m[j]) | (y[j] & ~m[j]));
+			}
+			this->store(base, n, r);
+		}
+		reg.syncParent();
+	}
+
+	//** Comparisons (viewed register lanes against b lanes) **//
+	/**
+	 * Lane-wise equality
+	 * @param b Compared register
+	 * @return One bit per lane, set where lane == b
+	 */
+	BitVector equal(const BitVector &b) const {
+		return this->compare(b, Equal());
+	}
+
+	/**
+	 * Lane-wise unsigned less than
+	 * @param b Compared register
+	 * @return One bit per lane, set where lane < b
+	 */
+	BitVector lessThan(const BitVector &b) const {
+		return this->compare(b, LessThan());
+	}
+
+	/**
+	 * Lane-wise signed less than
+	 * @param b Compared register
+	 * @return One bit per lane, set where lane < b
+	 */
+	BitVector lessThanSigned(const BitVector &b) const {
+		return this->compare(b, LessThanSigned());
+	}
+
+protected:
+	/**
+	 * Number of lanes per chunk
+	 */
+	static const unsigned int CHUNK_LANES = HV_PL_CHUNK_BYTES / sizeof(T);
+
+	//** Lane operators **//
+	struct Add {
+		T operator()(const T &x, const T &y) const {
+			return static_cast<T>(x + y);
+		}
+	};
+	struct Sub {
+		T operator()(const T &x, const T &y) const {
+			return static_cast<T>(x - y);
+		}
+	};
+	struct Min {
+		T operator()(const T &x, const T &y) const {
+			return x < y ? x : y;
+		}
+	};
+	struct Max {
+		T operator()(const T &x, const T &y) const {
+			return x < y ? y : x;
+		}
+	};
+	struct MinSigned {
+		T operator()(const T &x, const T &y) const {
+			return static_cast<slane_t>(x) < static_cast<slane_t>(y) ? x : y;
+		}
+	};
+	struct MaxSigned {
+		T operator()(const T &x, const T &y) const {
+			return static_cast<slane_t>(x) < static_cast<slane_t>(y) ? y : x;
+		}
+	};
+	struct ShiftLeft {
+		explicit ShiftLeft(const unsigned int &n) :
+				n(n % LANE_WIDTH) {
+		}
+		T operator()(const T &x, const T &) const {
+			return static_cast<T>(x << n);
+		}
+		unsigned int n;
+	};
+	struct ShiftRight {
+		explicit ShiftRight(const unsigned int &n) :
+				n(n % LANE_WIDTH) {
+		}
+		T operator()(const T &x, const T &) const {
+			return static_cast<T>(x >> n);
+		}
+		unsigned int n;
+	};
+	struct ShiftRightArith {
+		explicit ShiftRightArith(const unsigned int &n) :
+				n(n % LANE_WIDTH) {
+		}
+		T operator()(const T &x, const T &) const {
+			const T sign(static_cast<T>(static_cast<T>(0) - (x >> (LANE_WIDTH - 1u))));
+			return static_cast<T>((x >> n) | (sign & ~(static_cast<T>(~static_cast<T>(0)) >> n)));
+		}
+		unsigned int n;
+	};
+	struct Equal {
+		bool operator()(const T &x, const T &y) const {
+			return x == y;
+		}
+	};
+	struct LessThan {
+		bool operator()(const T &x, const T &y) const {
+			return x < y;
+		}
+	};
+	struct LessThanSigned {
+		bool operator()(const T &x, const T &y) const {
+			return static_cast<slane_t>(x) < static_cast<slane_t>(y);
+		}
+	};
+
+	/**
+	 * Lane = op(a, b) on all lanes, or on lanes selected by mask
+	 */
+	template<class Op> void apply(const BitVector &a, const BitVector &b,
+			const BitVector *mask, const Op &op) {
+		this->checkOperand(a);
+		this->checkOperand(b);
+		if (mask != nullptr) {
+			this->checkMask(*mask);
+		}
+		T x[CHUNK_LANES], y[CHUNK_LANES], r[CHUNK_LANES];
+		for (bvsize_t base = 0u; base < nLanes; base += CHUNK_LANES) {
+			const unsigned int n(this->chunkLanes(base));
+			PackedLanes::load(a, base, n, x);
+			PackedLanes::load(b, base, n, y);
+			for (unsigned int j = 0u; j < CHUNK_LANES; j++) {
+				r[j] = op(x[j], y[j]);
+			}
+			if (mask != nullptr) {
+				T old[CHUNK_LANES], m[CHUNK_LANES];
+				PackedLanes::load(reg, base, n, old);
+				PackedLanes::expandMask(*mask, base, m);
+				for (unsigned int j = 0u; j < CHUNK_LANES; j++) {
+					r[j] = static_cast<T>((r[j] & m[j]) | (old[j] & ~m[j]));
+				}
+			}
+			this->store(base, n, r);
+		}
+		reg.syncParent();
+	}
+
+	/**
+	 * Mask of op(lane, b) over all lanes
+	 */
+	template<class Op> BitVector compare(const BitVector &b, const Op &op) const {
+		this->checkOperand(b);
+		BitVector ret(nLanes, false);
+		bvdata_t *cells(ret.getDataAddress());
+		T x[CHUNK_LANES], y[CHUNK_LANES];
+		for (bvsize_t base = 0u; base < nLanes; base += CHUNK_LANES) {
+			const unsigned int n(this->chunkLanes(base));
+			PackedLanes::load(reg, base, n, x);
+			PackedLanes::load(b, base, n, y);
+			hvuint64_t bits(0u);
+			for (unsigned int j = 0u; j < CHUNK_LANES; j++) {
+				bits |= static_cast<hvuint64_t>(op(x[j], y[j])) << j;
+			}
+			bits &= HV_LSB_MASK_GEN(hvuint64_t, n);
+			// base is a multiple of 8: bits span at most 3 cells
+			const unsigned int w(base / BITWIDTH_OF(bvdata_t));
+			const unsigned int sh(base % BITWIDTH_OF(bvdata_t));
+			for (unsigned int c = 0u; (c < 3u) && (w + c < ret.getArraySize()); c++) {
+				const unsigned int pos(c * BITWIDTH_OF(bvdata_t));
+				if (pos < sh + 64u) {
+					cells[w + c] |= static_cast<bvdata_t>(
+							pos >= sh ? bits >> (pos - sh) : bits << (sh - pos));
+				}
+			}
+		}
+		return ret;
+	}
+
+	/**
+	 * Number of lanes of the chunk starting at lane base
+	 */
+	unsigned int chunkLanes(const bvsize_t &base) const {
+		const unsigned int n(static_cast<unsigned int>(nLanes - base));
+		return n < CHUNK_LANES ? n : CHUNK_LANES;
+	}
+
+	/**
+	 * Copy n lanes of a register from lane base into a chunk, clearing the
+	 * rest of the chunk
+	 */
+	static void load(const BitVector &src, const bvsize_t &base,
+			const unsigned int &n, T *dst) {
+		if (n < CHUNK_LANES) {
+			std::memset(dst, 0, sizeof(T) * CHUNK_LANES);
+		}
+		const bvdata_t *cells(src.getDataAddress());
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+		std::memcpy(dst, reinterpret_cast<const hvuint8_t*>(cells) + base * sizeof(T),
+				n * sizeof(T));
+#else
+		for (unsigned int j = 0u; j < n; j++) {
+			const std::size_t pos((base + j) * LANE_WIDTH);
+			hvuint64_t x(0u);
+			for (unsigned int k = 0u; k < LANE_WIDTH; k += BITWIDTH_OF(bvdata_t)) {
+				x |= static_cast<hvuint64_t>(cells[(pos + k) / BITWIDTH_OF(bvdata_t)]
+						>> ((pos + k) % BITWIDTH_OF(bvdata_t))) << k;
+			}
+			dst[j] = static_cast<T>(x);
+		}
+#endif
+	}
+
+	/**
+	 * Write n lanes of the viewed register from lane base
+	 */
+	void store(const bvsize_t &base, const unsigned int &n, const T *src) {
+		bvdata_t *cells(reg.getDataAddress());
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+		std::memcpy(reinterpret_cast<hvuint8_t*>(cells) + base * sizeof(T), src,
+				n * sizeof(T));
+#else
+		for (unsigned int j = 0u; j < n; j++) {
+			const std::size_t pos((base + j) * LANE_WIDTH);
+			for (unsigned int k = 0u; k < LANE_WIDTH; k += BITWIDTH_OF(bvdata_t)) {
+				const unsigned int nBits(
+						LANE_WIDTH - k < BITWIDTH_OF(bvdata_t) ?
+								LANE_WIDTH - k : BITWIDTH_OF(bvdata_t));
+				const unsigned int sh((pos + k) % BITWIDTH_OF(bvdata_t));
+				const bvdata_t m(HV_LSB_MASK_GEN(bvdata_t, nBits) << sh);
+				bvdata_t &c(cells[(pos + k) / BITWIDTH_OF(bvdata_t)]);
+				c = static_cast<bvdata_t>((c & ~m)
+						| ((static_cast<bvdata_t>(static_cast<hvuint64_t>(src[j]) >> k)
+								<< sh) & m));
+			}
+		}
+#endif
+	}
+
+	/**
+	 * Lane masks (all ones or all zeros) of lanes [base, base + CHUNK_LANES)
+	 */
+	static void expandMask(const BitVector &mask, const bvsize_t &base, T *m) {
+		const bvdata_t *cells(mask.getDataAddress());
+		const unsigned int w(base / BITWIDTH_OF(bvdata_t));
+		const unsigned int sh(base % BITWIDTH_OF(bvdata_t));
+		hvuint64_t bits(0u);
+		for (unsigned int c = 0u; (c < 3u) && (w + c < mask.getArraySize()); c++) {
+			const unsigned int pos(c * BITWIDTH_OF(bvdata_t));
+			if (pos < sh + 64u) {
+				const hvuint64_t x(cells[w + c]);
+				bits |= pos >= sh ? x << (pos - sh) : x >> (sh - pos);
+			}
+		}
+		for (unsigned int j = 0u; j < CHUNK_LANES; j++) {
+			m[j] = static_cast<T>(static_cast<T>(0) - static_cast<T>((bits >> j) & 1u));
+		}
+	}
+
+	void checkOperand(const BitVector &op) const {
+		HV_ASSERT(op.getSize() == reg.getSize(),
+				"Operand size {} does not match register size {}", op.getSize(),
+				reg.getSize());
+	}
+
+	void checkMask(const BitVector &mask) const {
+		HV_ASSERT(mask.getSize() >= nLanes,
+				"Mask size {} is smaller than the number of lanes {}",
+				mask.getSize(), nLanes);
+	}
+
+	/**
+	 * Viewed register
+	 */
+	BitVector &reg;
+
+	/**
+	 * Number of lanes
+	 */
+	bvsize_t nLanes;
+};
+
+template<typename T> const unsigned int PackedLanes<T>::LANE_WIDTH;
+template<typename T> const unsigned int PackedLanes<T>::CHUNK_LANES;
+
+} // namespace common
+} // namespace hv
+
+#endif // HV_PACKED_LANES_H
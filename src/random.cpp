@@ -0,0 +1,105 @@
+/**
+ * @file random.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Seedable pseudo-random number engine (xoshiro256**)
+ */
+
+#include <atomic>
+#include "random.h"
+
+namespace hv {
+namespace common {
+
+static std::atomic<hvuint64_t> _hvRandomDefaultSeed(HV_RANDOM_DEFAULT_SEED);
+static std::atomic<hvuint64_t> _hvRandomThreadCount(0u);
+
+/**
+ * SplitMix64 step, used to expand seeds into full engine states
+ * @param x SplitMix64 state, advanced by the call
+ * @return Next SplitMix64 output
+ */
+static hvuint64_t splitMix64(hvuint64_t &x) {
+	hvuint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+	return z ^ (z >> 31);
+}
+
+RandomEngine::RandomEngine() {
+	this->seed(HV_RANDOM_DEFAULT_SEED);
+}
+
+RandomEngine::RandomEngine(const hvuint64_t &seedValue,
+		const hvuint64_t &stream) {
+	this->seed(seedValue, stream);
+}
+
+RandomEngine::~RandomEngine() {
+}
+
+void RandomEngine::seed(const hvuint64_t &seedValue, const hvuint64_t &stream) {
+	// Streams are decorrelated by mixing their identifier into the seed
+	hvuint64_t streamTmp(stream);
+	hvuint64_t sm(seedValue ^ splitMix64(streamTmp));
+	for (unsigned int i = 0u; i < 4u; i++) {
+		state[i] = splitMix64(sm);
+	}
+}
+
+void RandomEngine::fill(hvuint64_t *dst, const std::size_t &n) {
+	for (std::size_t i = 0u; i < n; i++) {
+		dst[i] = this->operator ()();
+	}
+}
+
+void RandomEngine::fill(hvuint32_t *dst, const std::size_t &n) {
+	std::size_t i;
+	for (i = 0u; i + 1u < n; i += 2u) {
+		const hvuint64_t tmp(this->operator ()());
+		dst[i] = static_cast<hvuint32_t>(tmp);
+		dst[i + 1u] = static_cast<hvuint32_t>(tmp >> 32);
+	}
+	if (i < n) {
+		dst[i] = static_cast<hvuint32_t>(this->operator ()());
+	}
+}
+
+void RandomEngine::jump() {
+	static const hvuint64_t JUMP[] = { 0x180EC6D33CFD0ABAULL,
+			0xD5A61266F0C9392CULL, 0xA9582618E03FC9AAULL,
+			0x39ABDC4529B1661CULL };
+	hvuint64_t s[4] = { 0u, 0u, 0u, 0u };
+	for (unsigned int i = 0u; i < 4u; i++) {
+		for (unsigned int b = 0u; b < 64u; b++) {
+			if (JUMP[i] & (static_cast<hvuint64_t>(1u) << b)) {
+				for (unsigned int j = 0u; j < 4u; j++) {
+					s[j] ^= state[j];
+				}
+			}
+			this->operator ()();
+		}
+	}
+	for (unsigned int j = 0u; j < 4u; j++) {
+		state[j] = s[j];
+	}
+}
+
+RandomEngine& RandomEngine::getThreadEngine() {
+	static thread_local RandomEngine engine(_hvRandomDefaultSeed.load(),
+			_hvRandomThreadCount.fetch_add(1u));
+	return engine;
+}
+
+void RandomEngine::setDefaultSeed(const hvuint64_t &seedValue) {
+	_hvRandomDefaultSeed.store(seedValue);
+}
+
+hvuint64_t RandomEngine::getDefaultSeed() {
+	return _hvRandomDefaultSeed.load();
+}
+
+} // namespace common
+} // namespace hv
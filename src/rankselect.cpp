@@ -0,0 +1,271 @@
+/**
+ * @file rankselect.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Rank/select index over BitVector bitmaps
+ */
+
+#include "hvutils.h"
+#include "rankselect.h"
+
+namespace hv {
+namespace common {
+
+typedef BitVector::bvdata_t bvdata_t;
+
+const RankSelectIndex::bvsize_t RankSelectIndex::npos;
+
+/**
+ * log2 of the block size in bits
+ */
+#define HV_RS_BLOCK_LOG2 9u
+
+/**
+ * log2 of the superblock size in bits
+ */
+#define HV_RS_SUPERBLOCK_LOG2 14u
+
+/**
+ * log2 of the number of set bits between two select samples
+ */
+#define HV_RS_SAMPLE_LOG2 9u
+
+#define HV_RS_CELL_BITS (BITWIDTH_OF(bvdata_t))
+#define HV_RS_CELLS_PER_BLOCK ((1u << HV_RS_BLOCK_LOG2) / HV_RS_CELL_BITS)
+#define HV_RS_BLOCKS_PER_SUPERBLOCK_LOG2 (HV_RS_SUPERBLOCK_LOG2 - HV_RS_BLOCK_LOG2)
+
+/**
+ * Position of the r-th bit set in a cell
+ * @param x Cell value
+ * @param r Rank of the bit (lower than the number of bits set in x)
+ * @return Bit position
+ */
+static inline unsigned int selectInCell(bvdata_t x, unsigned int r) {
+	unsigned int base(0u);
+	for (;;) {
+		const unsigned int n(popCount(x & 0xFFu));
+		if (r < n) {
+			break;
+		}
+		r -= n;
+		x >>= 8u;
+		base += 8u;
+	}
+	for (; r; r--) {
+		x &= x - 1u;
+	}
+	return base + countTrailingZeros(x);
+}
+
+RankSelectIndex::RankSelectIndex(BitVector &bv) :
+		bv(bv), indexedSize(0u), total(0u), valid(false), samplesValid(false) {
+}
+
+RankSelectIndex::~RankSelectIndex() {
+}
+
+RankSelectIndex::bvsize_t RankSelectIndex::count() const {
+	this->update();
+	return static_cast<bvsize_t>(total);
+}
+
+RankSelectIndex::bvsize_t RankSelectIndex::rank1(const bvsize_t &pos) const {
+	HV_ASSERT(pos <= bv.getSize(), "Rank position {} out of range (size {})",
+			pos, bv.getSize());
+	this->update();
+	const hvuint32_t p(pos);
+	const hvuint32_t c(p / HV_RS_CELL_BITS);
+	const bvdata_t *d(this->cells());
+	hvuint32_t r(this->blockRank(p >> HV_RS_BLOCK_LOG2));
+	for (hvuint32_t i = (p >> HV_RS_BLOCK_LOG2) * HV_RS_CELLS_PER_BLOCK; i < c;
+			i++) {
+		r += popCount(d[i]);
+	}
+	const unsigned int rem(p % HV_RS_CELL_BITS);
+	if (rem) {
+		r += popCount(d[c] & HV_LSB_MASK_GEN(bvdata_t, rem));
+	}
+	return static_cast<bvsize_t>(r);
+}
+
+RankSelectIndex::bvsize_t RankSelectIndex::rank0(const bvsize_t &pos) const {
+	return static_cast<bvsize_t>(pos - this->rank1(pos));
+}
+
+RankSelectIndex::bvsize_t RankSelectIndex::select1(const bvsize_t &k) const {
+	this->update();
+	if (k >= total) {
+		return npos;
+	}
+	this->updateSamples();
+
+	// Last block starting with at most k bits set, between the samples
+	// framing k
+	const hvuint32_t j(k >> HV_RS_SAMPLE_LOG2);
+	hvuint32_t lo(samples[j]);
+	hvuint32_t hi(
+			j + 1u < samples.size() ?
+					samples[j + 1u] :
+					static_cast<hvuint32_t>(blockCounts.size() - 1u));
+	while (lo < hi) {
+		const hvuint32_t mid(lo + (hi - lo + 1u) / 2u);
+		if (this->blockRank(mid) <= k) {
+			lo = mid;
+		} else {
+			hi = mid - 1u;
+		}
+	}
+
+	hvuint32_t rem(k - this->blockRank(lo));
+	for (hvuint32_t i = lo * HV_RS_CELLS_PER_BLOCK;; i++) {
+		const bvdata_t x(this->cell(i));
+		const unsigned int n(popCount(x));
+		if (rem < n) {
+			return static_cast<bvsize_t>(i * HV_RS_CELL_BITS
+					+ selectInCell(x, rem));
+		}
+		rem -= n;
+	}
+}
+
+RankSelectIndex::bvsize_t RankSelectIndex::select0(const bvsize_t &k) const {
+	this->update();
+	if (k >= bv.getSize() - total) {
+		return npos;
+	}
+
+	// Last block starting with at most k bits cleared
+	hvuint32_t lo(0u);
+	hvuint32_t hi(static_cast<hvuint32_t>(blockCounts.size() - 1u));
+	while (lo < hi) {
+		const hvuint32_t mid(lo + (hi - lo + 1u) / 2u);
+		if ((mid << HV_RS_BLOCK_LOG2) - this->blockRank(mid) <= k) {
+			lo = mid;
+		} else {
+			hi = mid - 1u;
+		}
+	}
+
+	const bvdata_t *d(this->cells());
+	const hvuint32_t nCells(bv.getArraySize());
+	hvuint32_t rem(k - ((lo << HV_RS_BLOCK_LOG2) - this->blockRank(lo)));
+	for (hvuint32_t i = lo * HV_RS_CELLS_PER_BLOCK;; i++) {
+		bvdata_t x(~d[i]);
+		if (i + 1u == nCells) {
+			x &= bv.getmaskLastCell();
+		}
+		const unsigned int n(popCount(x));
+		if (rem < n) {
+			return static_cast<bvsize_t>(i * HV_RS_CELL_BITS
+					+ selectInCell(x, rem));
+		}
+		rem -= n;
+	}
+}
+
+bool RankSelectIndex::get(const bvsize_t &pos) const {
+	HV_ASSERT(pos < bv.getSize(), "Bit position {} out of range (size {})", pos,
+			bv.getSize());
+	return (this->cells()[HV_BV_ABS_POS_TO_ARRAY_INDEX(pos)]
+			& HV_BIT_MASK_GEN(bvdata_t, HV_BV_ABS_POS_TO_REL_POS(pos))) != 0u;
+}
+
+void RankSelectIndex::set(const bvsize_t &pos, const bool &value) {
+	if (this->get(pos) == value) {
+		return;
+	}
+	bv.getDataAddress()[HV_BV_ABS_POS_TO_ARRAY_INDEX(pos)] ^= HV_BIT_MASK_GEN(
+			bvdata_t, HV_BV_ABS_POS_TO_REL_POS(pos));
+	bv.syncParent();
+	if (!valid || (indexedSize != bv.getSize())) {
+		return;
+	}
+
+	// Counts of the following blocks of the superblock, then of the
+	// following superblocks
+	const hvuint32_t block(static_cast<hvuint32_t>(pos) >> HV_RS_BLOCK_LOG2);
+	const hvuint32_t blocksPerSuper(1u << HV_RS_BLOCKS_PER_SUPERBLOCK_LOG2);
+	for (hvuint32_t b = block + 1u;
+			(b < blockCounts.size()) && (b & (blocksPerSuper - 1u)); b++) {
+		blockCounts[b] = static_cast<hvuint16_t>(
+				value ? blockCounts[b] + 1u : blockCounts[b] - 1u);
+	}
+	for (hvuint32_t s = (block >> HV_RS_BLOCKS_PER_SUPERBLOCK_LOG2) + 1u;
+			s < superCounts.size(); s++) {
+		superCounts[s] = value ? superCounts[s] + 1u : superCounts[s] - 1u;
+	}
+	total = value ? total + 1u : total - 1u;
+	samplesValid = false;
+}
+
+void RankSelectIndex::invalidate() {
+	valid = false;
+}
+
+void RankSelectIndex::update() const {
+	if (valid && (indexedSize == bv.getSize())) {
+		return;
+	}
+	const hvuint32_t size(bv.getSize());
+	const hvuint32_t nCells(bv.getArraySize());
+	// Counts are kept up to the block holding position size, for rank(size)
+	const hvuint32_t nBlocks((size >> HV_RS_BLOCK_LOG2) + 1u);
+	superCounts.assign((size >> HV_RS_SUPERBLOCK_LOG2) + 1u, 0u);
+	blockCounts.assign(nBlocks, 0u);
+
+	hvuint32_t acc(0u);
+	for (hvuint32_t b = 0u; b < nBlocks; b++) {
+		const hvuint32_t s(b >> HV_RS_BLOCKS_PER_SUPERBLOCK_LOG2);
+		if (!(b & ((1u << HV_RS_BLOCKS_PER_SUPERBLOCK_LOG2) - 1u))) {
+			superCounts[s] = acc;
+		}
+		blockCounts[b] = static_cast<hvuint16_t>(acc - superCounts[s]);
+		const hvuint32_t end(
+				(b + 1u) * HV_RS_CELLS_PER_BLOCK < nCells ?
+						(b + 1u) * HV_RS_CELLS_PER_BLOCK : nCells);
+		for (hvuint32_t i = b * HV_RS_CELLS_PER_BLOCK; i < end; i++) {
+			acc += popCount(this->cell(i));
+		}
+	}
+	total = acc;
+	indexedSize = static_cast<bvsize_t>(size);
+	valid = true;
+	samplesValid = false;
+}
+
+void RankSelectIndex::updateSamples() const {
+	if (samplesValid) {
+		return;
+	}
+	const hvuint32_t nSamples(
+			(total + (1u << HV_RS_SAMPLE_LOG2) - 1u) >> HV_RS_SAMPLE_LOG2);
+	const hvuint32_t nBlocks(static_cast<hvuint32_t>(blockCounts.size()));
+	samples.assign(nSamples, 0u);
+	hvuint32_t j(0u);
+	for (hvuint32_t b = 0u; (b < nBlocks) && (j < nSamples); b++) {
+		const hvuint32_t next(b + 1u < nBlocks ? this->blockRank(b + 1u) : total);
+		while ((j < nSamples) && ((j << HV_RS_SAMPLE_LOG2) < next)) {
+			samples[j++] = b;
+		}
+	}
+	samplesValid = true;
+}
+
+hvuint32_t RankSelectIndex::blockRank(const hvuint32_t &block) const {
+	return superCounts[block >> HV_RS_BLOCKS_PER_SUPERBLOCK_LOG2]
+			+ blockCounts[block];
+}
+
+const bvdata_t* RankSelectIndex::cells() const {
+	return static_cast<const BitVector&>(bv).getDataAddress();
+}
+
+bvdata_t RankSelectIndex::cell(const hvuint32_t &i) const {
+	const bvdata_t x(this->cells()[i]);
+	return i + 1u == bv.getArraySize() ? x & bv.getmaskLastCell() : x;
+}
+
+} // namespace common
+} // namespace hv
@@ -0,0 +1,172 @@
+/**
+ * @file rankselect.h
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Rank/select index over BitVector bitmaps
+ */
+
+#ifndef HV_RANK_SELECT_H
+#define HV_RANK_SELECT_H
+
+#include <vector>
+#include "datatypes.h"
+#include "bitvector.h"
+
+namespace hv {
+namespace common {
+
+/**
+ * Rank/select index
+ *
+ * Answers "how many bits are set before position i" (rank) and "where is
+ * the k-th set bit" (select) on a BitVector in near-constant time, e.g. for
+ * page allocator and memory map models. Bitmaps of more than 65535 bits
+ * require 32-bit BitVector sizes (CMake option HV_BV_WIDE_SIZE).
+ *
+ * The index keeps absolute counts every 16384 bits (superblocks) and 16-bit
+ * counts relative to the superblock every 512 bits (blocks), i.e. about 3%
+ * of the bitmap size; the remainder of a rank query is a popcount over at
+ * most 16 cells. Select queries start from a sample of the block holding
+ * every 512th set bit, then binary search the block counts between samples.
+ *
+ * Writes through set() update the counts incrementally. Writes made
+ * directly to the BitVector must be followed by invalidate(): the index is
+ * then rebuilt on the next query. Select samples are rebuilt on the first
+ * select query following a change.
+ */
+class RankSelectIndex {
+public:
+	typedef BitVector::bvsize_t bvsize_t;
+
+	/**
+	 * Index returned by select queries when no bit is found
+	 */
+	static const bvsize_t npos = BitVector::npos;
+
+	/**
+	 * Constructor
+	 * @param bv Indexed BitVector
+	 */
+	explicit RankSelectIndex(BitVector &bv);
+
+	virtual ~RankSelectIndex();
+
+	/**
+	 * Get number of bits set
+	 * @return Number of 1s
+	 */
+	bvsize_t count() const;
+
+	/**
+	 * Get number of bits set before a position
+	 * @param pos Position (0 to size)
+	 * @return Number of 1s in [0, pos)
+	 */
+	bvsize_t rank1(const bvsize_t &pos) const;
+
+	/**
+	 * Get number of bits cleared before a position
+	 * @param pos Position (0 to size)
+	 * @return Number of 0s in [0, pos)
+	 */
+	bvsize_t rank0(const bvsize_t &pos) const;
+
+	/**
+	 * Find the k-th bit set
+	 * @param k Rank of the bit, starting from 0
+	 * @return Position of the bit, npos if fewer than k + 1 bits are set
+	 */
+	bvsize_t select1(const bvsize_t &k) const;
+
+	/**
+	 * Find the k-th bit cleared
+	 * @param k Rank of the bit, starting from 0
+	 * @return Position of the bit, npos if fewer than k + 1 bits are cleared
+	 */
+	bvsize_t select0(const bvsize_t &k) const;
+
+	/**
+	 * Get a bit
+	 * @param pos Position
+	 * @return Bit value
+	 */
+	bool get(const bvsize_t &pos) const;
+
+	/**
+	 * Write a bit of the BitVector and update the index
+	 * @param pos Position
+	 * @param value Bit value
+	 */
+	void set(const bvsize_t &pos, const bool &value);
+
+	/**
+	 * Notify the index that the BitVector was written directly
+	 */
+	void invalidate();
+
+protected:
+	/**
+	 * Rebuild counts if invalidated or if the BitVector was resized
+	 */
+	void update() const;
+
+	/**
+	 * Rebuild select samples if needed
+	 */
+	void updateSamples() const;
+
+	/**
+	 * Number of 1s before a block
+	 */
+	hvuint32_t blockRank(const hvuint32_t &block) const;
+
+	/**
+	 * Cells of the BitVector, read without detaching shared storage
+	 */
+	const BitVector::bvdata_t* cells() const;
+
+	/**
+	 * Cell value, bits beyond size cleared
+	 */
+	BitVector::bvdata_t cell(const hvuint32_t &i) const;
+
+	/**
+	 * Indexed BitVector
+	 */
+	BitVector &bv;
+
+	/**
+	 * Size the index was built for
+	 */
+	mutable bvsize_t indexedSize;
+
+	/**
+	 * Number of 1s before each superblock, up to the one holding position size
+	 */
+	mutable std::vector<hvuint32_t> superCounts;
+
+	/**
+	 * Number of 1s between the superblock start and each block
+	 */
+	mutable std::vector<hvuint16_t> blockCounts;
+
+	/**
+	 * Block holding each (sample * 512)-th set bit
+	 */
+	mutable std::vector<hvuint32_t> samples;
+
+	/**
+	 * Number of 1s
+	 */
+	mutable hvuint32_t total;
+
+	mutable bool valid;
+	mutable bool samplesValid;
+};
+
+} // namespace common
+} // namespace hv
+
+#endif // HV_RANK_SELECT_H
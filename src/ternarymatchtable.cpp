@@ -0,0 +1,224 @@
+/**
+ * @file ternarymatchtable.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Ternary (value/mask) match table for TCAM and address decoder models
+ */
+
+#include <algorithm>
+#include <functional>
+#include "hvutils.h"
+#include "ternarymatchtable.h"
+
+namespace hv {
+namespace common {
+
+typedef BitVector::bvdata_t bvdata_t;
+typedef BitVector::bvsize_t bvsize_t;
+
+const TernaryMatchTable::entryid_t TernaryMatchTable::npos;
+
+/**
+ * Number of entries matched at once (capacity is a multiple of it)
+ */
+#define HV_TMT_BLOCK_SIZE 16u
+
+/**
+ * Keys up to this number of 64-bit words are converted on the stack
+ */
+#define HV_TMT_STACK_KEY_WORDS 4u
+
+/**
+ * Match bitmap of a block of entries
+ * @param key Key words
+ * @param pv Values of the first entry of the block, word 0
+ * @param pm Masks of the first entry of the block, word 0
+ * @param stride Distance between words of an entry
+ * @param nWords Number of words
+ * @return Bit j set if entry j of the block matches
+ */
+static inline hvuint32_t matchBlock(const hvuint64_t *key, const hvuint64_t *pv,
+		const hvuint64_t *pm, const std::size_t &stride,
+		const unsigned int &nWords) {
+	// Fixed-size inner loops over contiguous entries: vectorized by the compiler
+	hvuint64_t diff[HV_TMT_BLOCK_SIZE];
+	for (unsigned int j = 0u; j < HV_TMT_BLOCK_SIZE; j++) {
+		diff[j] = (key[0] & pm[j]) ^ pv[j];
+	}
+	for (unsigned int w = 1u; w < nWords; w++) {
+		const hvuint64_t k(key[w]);
+		pv += stride;
+		pm += stride;
+		for (unsigned int j = 0u; j < HV_TMT_BLOCK_SIZE; j++) {
+			diff[j] |= (k & pm[j]) ^ pv[j];
+		}
+	}
+	// MSB of d | -d is set iff d != 0: vertical test for a miss on all entries
+	hvuint64_t miss(~static_cast<hvuint64_t>(0u));
+	for (unsigned int j = 0u; j < HV_TMT_BLOCK_SIZE; j++) {
+		miss &= diff[j] | (static_cast<hvuint64_t>(0u) - diff[j]);
+	}
+	if (miss >> 63) {
+		return 0u;
+	}
+	hvuint32_t ret(0u);
+	for (unsigned int j = 0u; j < HV_TMT_BLOCK_SIZE; j++) {
+		ret |= static_cast<hvuint32_t>(diff[j] == 0u) << j;
+	}
+	return ret;
+}
+
+TernaryMatchTable::TernaryMatchTable(const bvsize_t &keyWidth) :
+		keyWidth(keyWidth), nWords((keyWidth + 63u) / 64u), capacity(0u), nextId(
+				0u) {
+	HV_ASSERT(keyWidth > 0u, "Ternary match table key width must be non-zero");
+}
+
+TernaryMatchTable::~TernaryMatchTable() {
+}
+
+bvsize_t TernaryMatchTable::getKeyWidth() const {
+	return keyWidth;
+}
+
+std::size_t TernaryMatchTable::size() const {
+	return ids.size();
+}
+
+TernaryMatchTable::entryid_t TernaryMatchTable::insert(const BitVector &value,
+		const BitVector &mask, const hvint32_t &priority) {
+	HV_ASSERT(value.getSize() == keyWidth && mask.getSize() == keyWidth,
+			"Ternary match table entry width must be {} bits (got {} and {})",
+			keyWidth, value.getSize(), mask.getSize());
+	HV_ASSERT(nextId != npos, "Ternary match table identifiers exhausted");
+
+	const std::size_t n(ids.size());
+	if (n == capacity) {
+		this->reserve(
+				std::max<std::size_t>(2u * capacity, 4u * HV_TMT_BLOCK_SIZE));
+	}
+
+	// After all entries of higher or equal priority
+	const std::size_t slot(
+			static_cast<std::size_t>(std::upper_bound(priorities.begin(),
+					priorities.end(), priority, std::greater<hvint32_t>())
+					- priorities.begin()));
+
+	std::vector<hvuint64_t> v(nWords), m(nWords);
+	toWords(value, v.data(), nWords);
+	toWords(mask, m.data(), nWords);
+	for (unsigned int w = 0u; w < nWords; w++) {
+		hvuint64_t *pv(&values[w * capacity]);
+		hvuint64_t *pm(&masks[w * capacity]);
+		std::copy_backward(pv + slot, pv + n, pv + n + 1u);
+		std::copy_backward(pm + slot, pm + n, pm + n + 1u);
+		pv[slot] = v[w] & m[w];
+		pm[slot] = m[w];
+	}
+	priorities.insert(priorities.begin() + slot, priority);
+	ids.insert(ids.begin() + slot, nextId);
+	return nextId++;
+}
+
+bool TernaryMatchTable::erase(const entryid_t &id) {
+	const std::vector<entryid_t>::iterator it(
+			std::find(ids.begin(), ids.end(), id));
+	if (it == ids.end()) {
+		return false;
+	}
+	const std::size_t slot(static_cast<std::size_t>(it - ids.begin()));
+	const std::size_t n(ids.size());
+	for (unsigned int w = 0u; w < nWords; w++) {
+		hvuint64_t *pv(&values[w * capacity]);
+		hvuint64_t *pm(&masks[w * capacity]);
+		std::copy(pv + slot + 1u, pv + n, pv + slot);
+		std::copy(pm + slot + 1u, pm + n, pm + slot);
+	}
+	priorities.erase(priorities.begin() + slot);
+	ids.erase(it);
+	return true;
+}
+
+void TernaryMatchTable::clear() {
+	priorities.clear();
+	ids.clear();
+}
+
+TernaryMatchTable::entryid_t TernaryMatchTable::lookup(
+		const BitVector &key) const {
+	HV_ASSERT(key.getSize() == keyWidth,
+			"Ternary match table key must be {} bits (got {})", keyWidth,
+			key.getSize());
+	if (nWords <= HV_TMT_STACK_KEY_WORDS) {
+		hvuint64_t k[HV_TMT_STACK_KEY_WORDS];
+		toWords(key, k, nWords);
+		return this->lookup(k);
+	}
+	std::vector<hvuint64_t> k(nWords);
+	toWords(key, k.data(), nWords);
+	return this->lookup(k.data());
+}
+
+TernaryMatchTable::entryid_t TernaryMatchTable::lookup(
+		const hvuint64_t *key) const {
+	const hvuint64_t *pv(values.data());
+	const hvuint64_t *pm(masks.data());
+	const std::size_t n(ids.size());
+	for (std::size_t base = 0u; base < n; base += HV_TMT_BLOCK_SIZE) {
+		hvuint32_t match(
+				matchBlock(key, pv + base, pm + base, capacity, nWords));
+		if (n - base < HV_TMT_BLOCK_SIZE) {
+			match &= HV_LSB_MASK_GEN(hvuint32_t, n - base);
+		}
+		if (match) {
+			return ids[base + countTrailingZeros(match)];
+		}
+	}
+	return npos;
+}
+
+std::vector<TernaryMatchTable::entryid_t> TernaryMatchTable::lookupAll(
+		const BitVector &key) const {
+	HV_ASSERT(key.getSize() == keyWidth,
+			"Ternary match table key must be {} bits (got {})", keyWidth,
+			key.getSize());
+	std::vector<hvuint64_t> k(nWords);
+	toWords(key, k.data(), nWords);
+	std::vector<entryid_t> ret;
+	const hvuint64_t *pv(values.data());
+	const hvuint64_t *pm(masks.data());
+	const std::size_t n(ids.size());
+	for (std::size_t base = 0u; base < n; base += HV_TMT_BLOCK_SIZE) {
+		hvuint32_t match(
+				matchBlock(k.data(), pv + base, pm + base, capacity, nWords));
+		if (n - base < HV_TMT_BLOCK_SIZE) {
+			match &= HV_LSB_MASK_GEN(hvuint32_t, n - base);
+		}
+		while (match) {
+			ret.push_back(ids[base + countTrailingZeros(match)]);
+			match &= match - 1u;
+		}
+	}
+	return ret;
+}
+
+void TernaryMatchTable::reserve(const std::size_t &newCapacity) {
+	std::vector<hvuint64_t> newValues(nWords * newCapacity, 0u);
+	std::vector<hvuint64_t> newMasks(nWords * newCapacity, 0u);
+	const std::size_t n(ids.size());
+	for (unsigned int w = 0u; w < nWords; w++) {
+		std::copy(values.begin() + w * capacity,
+				values.begin() + w * capacity + n,
+				newValues.begin() + w * newCapacity);
+		std::copy(masks.begin() + w * capacity, masks.begin() + w * capacity + n,
+				newMasks.begin() + w * newCapacity);
+	}
+	values.swap(newValues);
+	masks.swap(newMasks);
+	capacity = newCapacity;
+}
+
+} // namespace common
+} // namespace hv
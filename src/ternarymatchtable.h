@@ -0,0 +1,144 @@
+/**
+ * @file ternarymatchtable.h
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Ternary (value/mask) match table for TCAM and address decoder models
+ */
+
+#ifndef HV_TERNARY_MATCH_TABLE_H
+#define HV_TERNARY_MATCH_TABLE_H
+
+#include <cstddef>
+#include <vector>
+#include "datatypes.h"
+#include "bitvector.h"
+
+namespace hv {
+namespace common {
+
+/**
+ * Ternary match table
+ *
+ * Entries are (value, mask) pairs: a key matches an entry if
+ * ((key ^ value) & mask) == 0, i.e. mask bits at 0 are "don't care".
+ * Lookups return the matching entry with the highest priority; among
+ * entries of equal priority, the first inserted one wins.
+ *
+ * Entries are kept sorted by priority in contiguous word arrays, one array
+ * per 64-bit key word, so that lookups scan blocks of entries with
+ * branch-free code the compiler vectorizes, and stop at the first block
+ * holding a match.
+ */
+class TernaryMatchTable {
+public:
+	typedef hvuint32_t entryid_t;
+
+	/**
+	 * Identifier returned when no entry matches
+	 */
+	static const entryid_t npos = static_cast<entryid_t>(~0u);
+
+	/**
+	 * Constructor
+	 * @param keyWidth Key width in bits
+	 */
+	explicit TernaryMatchTable(const BitVector::bvsize_t &keyWidth);
+
+	virtual ~TernaryMatchTable();
+
+	/**
+	 * Get key width
+	 * @return Width in bits
+	 */
+	BitVector::bvsize_t getKeyWidth() const;
+
+	/**
+	 * Get number of entries
+	 * @return Number of entries
+	 */
+	std::size_t size() const;
+
+	/**
+	 * Insert an entry
+	 * @param value Entry value (key width)
+	 * @param mask Entry mask (key width), 1s for bits to compare
+	 * @param priority Entry priority, higher values win
+	 * @return Entry identifier
+	 */
+	entryid_t insert(const BitVector &value, const BitVector &mask,
+			const hvint32_t &priority = 0);
+
+	/**
+	 * Remove an entry
+	 * @param id Entry identifier
+	 * @return True if the entry existed
+	 */
+	bool erase(const entryid_t &id);
+
+	/**
+	 * Remove all entries
+	 */
+	void clear();
+
+	/**
+	 * Look up a key
+	 * @param key Key (key width)
+	 * @return Identifier of the best matching entry, npos if none
+	 */
+	entryid_t lookup(const BitVector &key) const;
+
+	/**
+	 * Look up a key given as 64-bit little-endian words
+	 * @param key Key words (bits beyond key width are ignored)
+	 * @return Identifier of the best matching entry, npos if none
+	 */
+	entryid_t lookup(const hvuint64_t *key) const;
+
+	/**
+	 * Look up all entries matching a key
+	 * @param key Key (key width)
+	 * @return Identifiers of matching entries, best match first
+	 */
+	std::vector<entryid_t> lookupAll(const BitVector &key) const;
+
+protected:
+	/**
+	 * Grow word arrays
+	 */
+	void reserve(const std::size_t &newCapacity);
+
+	/**
+	 * Key width
+	 */
+	BitVector::bvsize_t keyWidth;
+
+	/**
+	 * Number of 64-bit words per key
+	 */
+	unsigned int nWords;
+
+	/**
+	 * Values (pre-masked) and masks: word w of entry i at w * capacity + i
+	 */
+	std::vector<hvuint64_t> values;
+	std::vector<hvuint64_t> masks;
+	std::size_t capacity;
+
+	/**
+	 * Entry priorities (descending) and identifiers, in storage order
+	 */
+	std::vector<hvint32_t> priorities;
+	std::vector<entryid_t> ids;
+
+	/**
+	 * Next entry identifier
+	 */
+	entryid_t nextId;
+};
+
+} // namespace common
+} // namespace hv
+
+#endif // HV_TERNARY_MATCH_TABLE_H
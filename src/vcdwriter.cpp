@@ -0,0 +1,352 @@
+/**
+ * @file vcdwriter.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Streaming VCD waveform writer for BitVector signals
+ */
+
+#include <algorithm>
+#include <cstring>
+#include "hvutils.h"
+#include "vcdwriter.h"
+
+namespace hv {
+namespace common {
+
+typedef BitVector::bvdata_t bvdata_t;
+
+/**
+ * First and number of printable characters in VCD identifier codes
+ */
+#define HV_VCD_CODE_FIRST_CHAR '!'
+#define HV_VCD_CODE_N_CHARS 94u
+
+/**
+ * Binary strings of all byte values, MSB first
+ */
+struct ByteStrings {
+	char str[256][8];
+
+	ByteStrings() {
+		for (unsigned int v = 0u; v < 256u; v++) {
+			for (unsigned int b = 0u; b < 8u; b++) {
+				str[v][b] = ((v >> (7u - b)) & 1u) ? '1' : '0';
+			}
+		}
+	}
+};
+
+static const ByteStrings byteStrings;
+
+/**
+ * Identifier code of a signal index
+ */
+static std::string makeCode(std::size_t index) {
+	std::string ret;
+	do {
+		ret += static_cast<char>(HV_VCD_CODE_FIRST_CHAR
+				+ index % HV_VCD_CODE_N_CHARS);
+		index /= HV_VCD_CODE_N_CHARS;
+	} while (index);
+	return ret;
+}
+
+/**
+ * Split a dot-separated scope path
+ */
+static std::vector<std::string> splitScope(const std::string &scope) {
+	std::vector<std::string> ret;
+	std::size_t begin(0u);
+	while (begin < scope.size()) {
+		std::size_t end(scope.find('.', begin));
+		if (end == std::string::npos) {
+			end = scope.size();
+		}
+		if (end > begin) {
+			ret.push_back(scope.substr(begin, end - begin));
+		}
+		begin = end + 1u;
+	}
+	return ret;
+}
+
+VcdWriter::VcdWriter(std::ostream &os, const std::string &timescale,
+		const bool &backgroundFlush, const std::size_t &bufferSize) :
+		os(os), timescale(timescale) {
+	this->init(backgroundFlush, bufferSize);
+}
+
+VcdWriter::VcdWriter(const std::string &fileName, const std::string &timescale,
+		const bool &backgroundFlush, const std::size_t &bufferSize) :
+		file(fileName.c_str(), std::ios::out | std::ios::binary), os(file), timescale(
+				timescale) {
+	if (!file.is_open()) {
+		HV_LOG_ERROR("Could not open VCD file {}", fileName);
+		HV_EXIT_FAILURE();
+	}
+	this->init(backgroundFlush, bufferSize);
+}
+
+VcdWriter::~VcdWriter() {
+	this->flush();
+	if (background) {
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			stopping = true;
+		}
+		pendingReady.notify_one();
+		writer.join();
+	}
+}
+
+void VcdWriter::init(const bool &backgroundFlush,
+		const std::size_t &bufferSize) {
+	headerWritten = false;
+	lastTime = 0u;
+	buffer.resize(bufferSize > 64u ? bufferSize : 64u);
+	used = 0u;
+	background = backgroundFlush;
+	pendingSize = 0u;
+	stopping = false;
+	if (background) {
+		pending.resize(buffer.size());
+		writer = std::thread(&VcdWriter::backgroundWriter, this);
+	}
+}
+
+VcdWriter::signalid_t VcdWriter::addSignal(const std::string &scope,
+		const std::string &name, const BitVector &signal) {
+	HV_ASSERT(!headerWritten, "VCD signal {} added after the first sample",
+			name);
+	Signal s;
+	s.scope = splitScope(scope);
+	s.name = name;
+	s.bv = &signal;
+	s.code = makeCode(signals.size());
+	s.offset = prevCells.size();
+	prevCells.resize(prevCells.size() + signal.getArraySize(), 0u);
+	signals.push_back(s);
+	return static_cast<signalid_t>(signals.size() - 1u);
+}
+
+std::size_t VcdWriter::getNSignals() const {
+	return signals.size();
+}
+
+void VcdWriter::sample(const hvuint64_t &time) {
+	if (!headerWritten) {
+		this->writeHeader(time);
+		return;
+	}
+	HV_ASSERT(time >= lastTime, "VCD time going backwards ({} after {})", time,
+			lastTime);
+	bool timeWritten(false);
+	for (const Signal &s : signals) {
+		const bvdata_t *cur(s.bv->getDataAddress());
+		bvdata_t *prev(&prevCells[s.offset]);
+		const unsigned int n(s.bv->getArraySize());
+		bvdata_t diff((cur[n - 1u] ^ prev[n - 1u]) & s.bv->getmaskLastCell());
+		for (unsigned int i = 0u; i + 1u < n; i++) {
+			diff |= cur[i] ^ prev[i];
+		}
+		if (!diff) {
+			continue;
+		}
+		std::memcpy(prev, cur, n * sizeof(bvdata_t));
+		if (!timeWritten && (time != lastTime)) {
+			this->writeTime(time);
+		}
+		timeWritten = true;
+		this->writeValue(s);
+	}
+	if (timeWritten) {
+		lastTime = time;
+	}
+}
+
+void VcdWriter::flush() {
+	this->handOff();
+	if (background) {
+		std::unique_lock<std::mutex> lock(mutex);
+		pendingDone.wait(lock, [this] {return pendingSize == 0u;});
+	}
+	os.flush();
+}
+
+void VcdWriter::writeHeader(const hvuint64_t &time) {
+	this->write("$version hvcommon VcdWriter $end\n$timescale ");
+	this->write(timescale);
+	this->write(" $end\n");
+
+	// Signals grouped by scope, scopes opened and closed as the sorted paths
+	// change
+	std::vector<std::size_t> order(signals.size());
+	for (std::size_t i = 0u; i < order.size(); i++) {
+		order[i] = i;
+	}
+	std::stable_sort(order.begin(), order.end(),
+			[this](const std::size_t &a, const std::size_t &b) {
+				return signals[a].scope < signals[b].scope;
+			});
+	std::vector<std::string> open;
+	for (const std::size_t i : order) {
+		const Signal &s(signals[i]);
+		std::size_t common(0u);
+		while (common < open.size() && common < s.scope.size()
+				&& open[common] == s.scope[common]) {
+			common++;
+		}
+		for (; open.size() > common; open.pop_back()) {
+			this->write("$upscope $end\n");
+		}
+		for (; open.size() < s.scope.size(); open.push_back(s.scope[open.size()])) {
+			this->write("$scope module ");
+			this->write(s.scope[open.size()]);
+			this->write(" $end\n");
+		}
+		this->write("$var wire ");
+		this->write(std::to_string(s.bv->getSize()));
+		this->write(" ");
+		this->write(s.code);
+		this->write(" ");
+		this->write(s.name);
+		this->write(s.bv->getSize() > 1u ?
+				" [" + std::to_string(s.bv->getSize() - 1u) + ":0] $end\n" :
+				std::string(" $end\n"));
+	}
+	for (; !open.empty(); open.pop_back()) {
+		this->write("$upscope $end\n");
+	}
+	this->write("$enddefinitions $end\n");
+
+	this->writeTime(time);
+	this->write("$dumpvars\n");
+	for (const Signal &s : signals) {
+		std::memcpy(&prevCells[s.offset], s.bv->getDataAddress(),
+				s.bv->getArraySize() * sizeof(bvdata_t));
+		this->writeValue(s);
+	}
+	this->write("$end\n");
+	headerWritten = true;
+	lastTime = time;
+}
+
+void VcdWriter::writeValue(const Signal &s) {
+	const unsigned int size(s.bv->getSize());
+	const bvdata_t *d(s.bv->getDataAddress());
+	if (size == 1u) {
+		char *p(this->reserve(2u + s.code.size()));
+		*p++ = (d[0] & 1u) ? '1' : '0';
+		std::memcpy(p, s.code.data(), s.code.size());
+		p[s.code.size()] = '\n';
+		used += 2u + s.code.size();
+		return;
+	}
+
+	// "b<value> <code>\n": a partial byte first, then whole bytes from MSB
+	const std::size_t len(size + 3u + s.code.size());
+	char *p(this->reserve(len));
+	*p++ = 'b';
+	unsigned int bit(size);
+	const unsigned int head(size % 8u);
+	if (head) {
+		bit -= head;
+		const unsigned int v(
+				(d[bit / BITWIDTH_OF(bvdata_t)] >> (bit % BITWIDTH_OF(bvdata_t)))
+						& 0xFFu);
+		std::memcpy(p, byteStrings.str[v] + 8u - head, head);
+		p += head;
+	}
+	while (bit) {
+		bit -= 8u;
+		const unsigned int v(
+				(d[bit / BITWIDTH_OF(bvdata_t)] >> (bit % BITWIDTH_OF(bvdata_t)))
+						& 0xFFu);
+		std::memcpy(p, byteStrings.str[v], 8u);
+		p += 8u;
+	}
+	*p++ = ' ';
+	std::memcpy(p, s.code.data(), s.code.size());
+	p[s.code.size()] = '\n';
+	used += len;
+}
+
+void VcdWriter::writeTime(const hvuint64_t &time) {
+	char digits[24];
+	unsigned int n(0u);
+	hvuint64_t t(time);
+	do {
+		digits[n++] = static_cast<char>('0' + t % 10u);
+		t /= 10u;
+	} while (t);
+	char *p(this->reserve(n + 2u));
+	*p++ = '#';
+	for (unsigned int i = 0u; i < n; i++) {
+		*p++ = digits[n - 1u - i];
+	}
+	*p = '\n';
+	used += n + 2u;
+}
+
+void VcdWriter::write(const char *str, const std::size_t &n) {
+	std::memcpy(this->reserve(n), str, n);
+	used += n;
+}
+
+void VcdWriter::write(const std::string &str) {
+	this->write(str.data(), str.size());
+}
+
+char* VcdWriter::reserve(const std::size_t &n) {
+	if (used + n > buffer.size()) {
+		this->handOff();
+		if (n > buffer.size()) {
+			buffer.resize(n);
+		}
+	}
+	return &buffer[used];
+}
+
+void VcdWriter::handOff() {
+	if (!used) {
+		return;
+	}
+	if (!background) {
+		os.write(&buffer[0], static_cast<std::streamsize>(used));
+		used = 0u;
+		return;
+	}
+	std::unique_lock<std::mutex> lock(mutex);
+	pendingDone.wait(lock, [this] {return pendingSize == 0u;});
+	// The writer thread is idle: swapping buffers
+	std::swap(buffer, pending);
+	if (buffer.size() < pending.size()) {
+		buffer.resize(pending.size());
+	}
+	pendingSize = used;
+	used = 0u;
+	lock.unlock();
+	pendingReady.notify_one();
+}
+
+void VcdWriter::backgroundWriter() {
+	std::unique_lock<std::mutex> lock(mutex);
+	for (;;) {
+		pendingReady.wait(lock, [this] {return pendingSize || stopping;});
+		if (!pendingSize) {
+			return;
+		}
+		// Buffers are not touched by the simulation thread while pendingSize
+		// is non-zero
+		lock.unlock();
+		os.write(&pending[0], static_cast<std::streamsize>(pendingSize));
+		lock.lock();
+		pendingSize = 0u;
+		pendingDone.notify_all();
+	}
+}
+
+} // namespace common
+} // namespace hv
@@ -0,0 +1,206 @@
+/**
+ * @file vcdwriter.h
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Streaming VCD waveform writer for BitVector signals
+ */
+
+#ifndef HV_VCD_WRITER_H
+#define HV_VCD_WRITER_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <fstream>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "cplusplus.h"
+#include "datatypes.h"
+#include "bitvector.h"
+
+/**
+ * Default output buffer size in bytes
+ */
+#define HV_VCD_DEFAULT_BUFFER_SIZE (1u << 20)
+
+namespace hv {
+namespace common {
+
+/**
+ * VCD (IEEE 1364 value change dump) writer
+ *
+ * Signals are registered as references to BitVectors; sample() compares each
+ * of them with its previous value using word-level XOR, and only dumps the
+ * signals that changed. Values are formatted 8 bits at a time from a lookup
+ * table into a large output buffer, which is written to the stream when
+ * full.
+ *
+ * With background flush, full buffers are handed to a writer thread and the
+ * simulation keeps filling a second buffer, so that stream writes do not
+ * stall the caller. The writer itself is not thread-safe: addSignal(),
+ * sample() and flush() must be called from the same thread.
+ *
+ * Scopes are given as dot-separated paths, e.g. "top.cpu.regs".
+ */
+class VcdWriter {
+public:
+	typedef hvuint32_t signalid_t;
+
+	/**
+	 * Constructor writing to a stream
+	 * @param os Output stream (must outlive the writer)
+	 * @param timescale VCD timescale, e.g. "1 ps"
+	 * @param backgroundFlush Write buffers from a background thread
+	 * @param bufferSize Output buffer size in bytes
+	 */
+	explicit VcdWriter(std::ostream &os, const std::string &timescale = "1 ps",
+			const bool &backgroundFlush = false, const std::size_t &bufferSize =
+			HV_VCD_DEFAULT_BUFFER_SIZE);
+
+	/**
+	 * Constructor writing to a file
+	 * @param fileName Output file name
+	 * @param timescale VCD timescale, e.g. "1 ps"
+	 * @param backgroundFlush Write buffers from a background thread
+	 * @param bufferSize Output buffer size in bytes
+	 */
+	explicit VcdWriter(const std::string &fileName,
+			const std::string &timescale = "1 ps", const bool &backgroundFlush =
+					false, const std::size_t &bufferSize =
+			HV_VCD_DEFAULT_BUFFER_SIZE);
+
+	VcdWriter(const VcdWriter&) HV_CPLUSPLUS_MEMBER_FUNCTION_DELETE;
+	VcdWriter& operator=(const VcdWriter&) HV_CPLUSPLUS_MEMBER_FUNCTION_DELETE;
+
+	/**
+	 * Destructor, flushes the output
+	 */
+	virtual ~VcdWriter();
+
+	/**
+	 * Register a signal, before the first sample
+	 * @param scope Dot-separated scope path
+	 * @param name Signal name
+	 * @param signal Signal (must outlive the writer)
+	 * @return Signal identifier
+	 */
+	signalid_t addSignal(const std::string &scope, const std::string &name,
+			const BitVector &signal);
+
+	/**
+	 * Get number of signals
+	 * @return Number of registered signals
+	 */
+	std::size_t getNSignals() const;
+
+	/**
+	 * Dump the signals that changed since the previous sample (all signals
+	 * on the first sample)
+	 * @param time Simulation time, in timescale units, non-decreasing
+	 */
+	void sample(const hvuint64_t &time);
+
+	/**
+	 * Write buffered data to the stream and flush it
+	 */
+	void flush();
+
+protected:
+	/**
+	 * Registered signal
+	 */
+	struct Signal {
+		std::vector<std::string> scope;
+		std::string name;
+		const BitVector *bv;
+		std::string code;
+		std::size_t offset; // Offset of the previous value in prevCells
+	};
+
+	/**
+	 * Common constructor part
+	 */
+	void init(const bool &backgroundFlush, const std::size_t &bufferSize);
+
+	/**
+	 * Write the header and the initial values
+	 */
+	void writeHeader(const hvuint64_t &time);
+
+	/**
+	 * Append the current value of a signal
+	 */
+	void writeValue(const Signal &s);
+
+	/**
+	 * Append a time stamp
+	 */
+	void writeTime(const hvuint64_t &time);
+
+	/**
+	 * Append raw characters
+	 */
+	void write(const char *str, const std::size_t &n);
+	void write(const std::string &str);
+
+	/**
+	 * Make room for n characters in the buffer
+	 */
+	char* reserve(const std::size_t &n);
+
+	/**
+	 * Hand the buffer to the stream (directly or through the writer thread)
+	 */
+	void handOff();
+
+	/**
+	 * Writer thread body
+	 */
+	void backgroundWriter();
+
+	/**
+	 * Owned file, if constructed from a file name
+	 */
+	std::ofstream file;
+
+	std::ostream &os;
+	std::string timescale;
+
+	std::vector<Signal> signals;
+
+	/**
+	 * Previous values, all signals
+	 */
+	std::vector<BitVector::bvdata_t> prevCells;
+
+	bool headerWritten;
+	hvuint64_t lastTime;
+
+	/**
+	 * Buffer being filled and number of characters in it
+	 */
+	std::vector<char> buffer;
+	std::size_t used;
+
+	/**
+	 * Background flush: buffer being written and its size (0 when the
+	 * writer thread is idle)
+	 */
+	bool background;
+	std::vector<char> pending;
+	std::size_t pendingSize;
+	bool stopping;
+	std::mutex mutex;
+	std::condition_variable pendingReady;
+	std::condition_variable pendingDone;
+	std::thread writer;
+};
+
+} // namespace common
+} // namespace hv
+
+#endif // HV_VCD_WRITER_H
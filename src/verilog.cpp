@@ -0,0 +1,393 @@
+/**
+ * @file verilog.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Verilog/SystemVerilog sized literals from/to BitVector and LogicVector
+ */
+
+#include <cctype>
+#include "verilog.h"
+
+namespace hv {
+namespace common {
+
+typedef BitVector::bvdata_t bvdata_t;
+typedef BitVector::bvsize_t bvsize_t;
+
+/**
+ * Digit kinds, from the unknown/value bits they set
+ */
+enum VerilogDigitKind {
+	VERILOG_DIGIT_KNOWN, VERILOG_DIGIT_X, VERILOG_DIGIT_Z, VERILOG_DIGIT_INVALID
+};
+
+static VerilogDigitKind digitKind(const char &c, hvuint32_t &v) {
+	if ((c >= '0') && (c <= '9')) {
+		v = static_cast<hvuint32_t>(c - '0');
+	} else if ((c >= 'a') && (c <= 'f')) {
+		v = static_cast<hvuint32_t>(c - 'a' + 10);
+	} else if ((c >= 'A') && (c <= 'F')) {
+		v = static_cast<hvuint32_t>(c - 'A' + 10);
+	} else if ((c == 'x') || (c == 'X')) {
+		return VERILOG_DIGIT_X;
+	} else if ((c == 'z') || (c == 'Z') || (c == '?')) {
+		return VERILOG_DIGIT_Z;
+	} else {
+		return VERILOG_DIGIT_INVALID;
+	}
+	return VERILOG_DIGIT_KNOWN;
+}
+
+static void literalError(const std::string &src, const char *reason) {
+	HV_LOG_ERROR("Invalid Verilog literal '{}': {}", src, reason);
+	HV_EXIT_FAILURE();
+}
+
+/**
+ * ORs the n LSBs of bits at position pos, bits beyond the array are dropped
+ */
+static inline void depositBits(bvdata_t *cells, const bvsize_t &arraySize,
+		const hvuint32_t &pos, const hvuint32_t &bits) {
+	const hvuint32_t cell(HV_BV_ABS_POS_TO_ARRAY_INDEX(pos));
+	const hvuint32_t shift(HV_BV_ABS_POS_TO_REL_POS(pos));
+	cells[cell] |= static_cast<bvdata_t>(bits << shift);
+	if (shift && (cell + 1u < arraySize)) {
+		cells[cell + 1u] |= static_cast<bvdata_t>(
+				static_cast<hvuint64_t>(bits) >> (BITWIDTH_OF(bvdata_t) - shift));
+	}
+}
+
+/**
+ * Sets bits [lo, arraySize cells) to 1
+ */
+static inline void fillFrom(bvdata_t *cells, const bvsize_t &arraySize,
+		const hvuint32_t &lo) {
+	hvuint32_t cell(HV_BV_ABS_POS_TO_ARRAY_INDEX(lo));
+	cells[cell] |= HV_MSB_MASK_GEN(bvdata_t, HV_BV_ABS_POS_TO_REL_POS(lo));
+	while (++cell < arraySize) {
+		cells[cell] = ~static_cast<bvdata_t>(0u);
+	}
+}
+
+/**
+ * cells = cells * mul + add, over the used cells and growing them up to
+ * arraySize
+ */
+static inline void mulAdd(bvdata_t *cells, const bvsize_t &arraySize,
+		bvsize_t &used, const hvuint32_t &mul, const hvuint32_t &add) {
+	hvuint64_t carry(add);
+	for (bvsize_t i = 0u; i < used; i++) {
+		const hvuint64_t cur(static_cast<hvuint64_t>(cells[i]) * mul + carry);
+		cells[i] = static_cast<bvdata_t>(cur);
+		carry = cur >> BITWIDTH_OF(bvdata_t);
+	}
+	if (carry && (used < arraySize)) {
+		cells[used++] = static_cast<bvdata_t>(carry);
+	}
+}
+
+/**
+ * Reads n bits (n <= 32) at position pos
+ */
+static inline hvuint32_t extractBits(const bvdata_t *cells,
+		const bvsize_t &arraySize, const hvuint32_t &pos, const hvuint32_t &n) {
+	const hvuint32_t cell(HV_BV_ABS_POS_TO_ARRAY_INDEX(pos));
+	const hvuint32_t shift(HV_BV_ABS_POS_TO_REL_POS(pos));
+	hvuint64_t w(cells[cell] >> shift);
+	if (shift && (shift + n > BITWIDTH_OF(bvdata_t))
+			&& (cell + 1u < arraySize)) {
+		w |= static_cast<hvuint64_t>(cells[cell + 1u])
+				<< (BITWIDTH_OF(bvdata_t) - shift);
+	}
+	return static_cast<hvuint32_t>(w) & HV_LSB_MASK_GEN(hvuint32_t, n);
+}
+
+/**
+ * Parses src into the value plane and, if not nullptr, the unknown plane
+ * @return True if the literal has X or Z bits
+ */
+static bool parseLiteral(const std::string &src, BitVector &value,
+		BitVector *unknown, bool *isSigned) {
+	const char *p(src.data());
+	const char *end(p + src.size());
+	while ((p != end) && std::isspace(static_cast<unsigned char>(*p))) {
+		p++;
+	}
+	while ((end != p) && std::isspace(static_cast<unsigned char>(end[-1]))) {
+		end--;
+	}
+	const bool negative((p != end) && (*p == '-'));
+	if (negative) {
+		p++;
+	}
+
+	// Size, or value of a plain decimal number
+	const char *sizeBegin(p);
+	hvuint64_t size(0u);
+	while ((p != end) && (std::isdigit(static_cast<unsigned char>(*p)) || (*p == '_'))) {
+		if ((*p != '_') && (size <= static_cast<bvsize_t>(~0u))) {
+			size = size * 10u + static_cast<hvuint64_t>(*p - '0');
+		}
+		p++;
+	}
+	const bool hasSize(p != sizeBegin);
+	const char *sizeEnd(p);
+	while ((p != end) && std::isspace(static_cast<unsigned char>(*p))) {
+		p++;
+	}
+
+	bool sgn(false);
+	char base('d');
+	const char *digits(p);
+	if (p == end) {
+		if (!hasSize) {
+			literalError(src, "no digits");
+		}
+		sgn = true;
+		size = HV_VERILOG_UNSIZED_BITWIDTH;
+		digits = sizeBegin;
+		end = sizeEnd;
+	} else {
+		if (*p++ != '\'') {
+			literalError(src, "' expected after size");
+		}
+		if ((p != end) && ((*p == 's') || (*p == 'S'))) {
+			sgn = true;
+			p++;
+		}
+		base = (p != end) ?
+				static_cast<char>(std::tolower(static_cast<unsigned char>(*p++))) :
+				'\0';
+		if ((base != 'b') && (base != 'o') && (base != 'd') && (base != 'h')) {
+			literalError(src, "base must be b, o, d or h");
+		}
+		while ((p != end) && std::isspace(static_cast<unsigned char>(*p))) {
+			p++;
+		}
+		digits = p;
+		if (!hasSize) {
+			size = HV_VERILOG_UNSIZED_BITWIDTH;
+		}
+	}
+	if (!size || (size > static_cast<bvsize_t>(~0u))) {
+		literalError(src, "invalid size");
+	}
+	if ((digits == end) || (*digits == '_')) {
+		literalError(src, "digits expected");
+	}
+	if (isSigned != nullptr) {
+		*isSigned = sgn;
+	}
+
+	const bvsize_t n(static_cast<bvsize_t>(size));
+	value.resize(n);
+	bvdata_t *pv(value.getDataAddress());
+	bvdata_t *pu(nullptr);
+	if (unknown != nullptr) {
+		unknown->resize(n);
+		pu = unknown->getDataAddress();
+	}
+	const bvsize_t nCells(value.getArraySize());
+	for (bvsize_t i = 0u; i < nCells; i++) {
+		pv[i] = static_cast<bvdata_t>(0u);
+		if (pu != nullptr) {
+			pu[i] = static_cast<bvdata_t>(0u);
+		}
+	}
+
+	bool hasUnknown(false);
+	VerilogDigitKind leftmost(VERILOG_DIGIT_KNOWN);
+	hvuint32_t pos(0u);
+	if (base == 'd') {
+		// Multiply-accumulate by chunks of up to 9 digits, modulo 2^size
+		bvsize_t used(0u);
+		hvuint32_t chunk(0u), scale(1u);
+		for (const char *q = digits; q != end; q++) {
+			if (*q == '_') {
+				continue;
+			}
+			hvuint32_t v(0u);
+			const VerilogDigitKind kind(digitKind(*q, v));
+			if (kind != VERILOG_DIGIT_KNOWN) {
+				if ((kind == VERILOG_DIGIT_INVALID) || (q != digits)
+						|| (end - digits != 1)) {
+					literalError(src, "invalid decimal digits");
+				}
+				leftmost = kind;
+				break;
+			}
+			if (v > 9u) {
+				literalError(src, "invalid decimal digit");
+			}
+			chunk = chunk * 10u + v;
+			scale *= 10u;
+			if (scale == 1000000000u) {
+				mulAdd(pv, nCells, used, scale, chunk);
+				chunk = 0u;
+				scale = 1u;
+			}
+		}
+		if (scale > 1u) {
+			mulAdd(pv, nCells, used, scale, chunk);
+		}
+	} else {
+		// Right to left, each digit is deposited at its bit position
+		const hvuint32_t bits(base == 'b' ? 1u : (base == 'o' ? 3u : 4u));
+		const hvuint32_t digitMask(HV_LSB_MASK_GEN(hvuint32_t, bits));
+		for (const char *q = end; q-- != digits;) {
+			if (*q == '_') {
+				continue;
+			}
+			hvuint32_t v(0u);
+			const VerilogDigitKind kind(digitKind(*q, v));
+			if ((kind == VERILOG_DIGIT_INVALID)
+					|| ((kind == VERILOG_DIGIT_KNOWN) && (v > digitMask))) {
+				literalError(src, "invalid digit for base");
+			}
+			leftmost = kind;
+			if (pos >= n) {
+				continue;
+			}
+			const hvuint32_t mask(HV_LSB_MASK_GEN(hvuint32_t, HV_MIN(bits, n - pos)));
+			if (kind == VERILOG_DIGIT_KNOWN) {
+				depositBits(pv, nCells, pos, v & mask);
+			} else {
+				hasUnknown = true;
+				if (pu != nullptr) {
+					depositBits(pu, nCells, pos, mask);
+					if (kind == VERILOG_DIGIT_X) {
+						depositBits(pv, nCells, pos, mask);
+					}
+				}
+			}
+			pos += bits;
+		}
+	}
+
+	// x/z leftmost digits extend to the size
+	if ((leftmost != VERILOG_DIGIT_KNOWN) && (pos < n)) {
+		hasUnknown = true;
+		if (pu != nullptr) {
+			fillFrom(pu, nCells, pos);
+			if (leftmost == VERILOG_DIGIT_X) {
+				fillFrom(pv, nCells, pos);
+			}
+		}
+	}
+
+	if (negative) {
+		if (hasUnknown) {
+			// As in Verilog, arithmetic on unknown bits gives X
+			if (pu != nullptr) {
+				fillFrom(pu, nCells, 0u);
+				fillFrom(pv, nCells, 0u);
+			} else {
+				// X bits are converted to 0
+				for (bvsize_t i = 0u; i < nCells; i++) {
+					pv[i] = static_cast<bvdata_t>(0u);
+				}
+			}
+		} else {
+			hvuint64_t carry(1u);
+			for (bvsize_t i = 0u; i < nCells; i++) {
+				const hvuint64_t cur(static_cast<hvuint64_t>(~pv[i]) + carry);
+				pv[i] = static_cast<bvdata_t>(cur);
+				carry = cur >> BITWIDTH_OF(bvdata_t);
+			}
+		}
+	}
+
+	pv[nCells - 1u] &= value.getmaskLastCell();
+	if (pu != nullptr) {
+		pu[nCells - 1u] &= unknown->getmaskLastCell();
+	}
+	return hasUnknown;
+}
+
+bool fromVerilog(const std::string &src, BitVector &dst, bool *isSigned) {
+	return !parseLiteral(src, dst, nullptr, isSigned);
+}
+
+void fromVerilog(const std::string &src, LogicVector &dst, bool *isSigned) {
+	parseLiteral(src, dst.getValuePlane(), &dst.getUnknownPlane(), isSigned);
+}
+
+/**
+ * Prints the planes, unknown being nullptr for BitVectors
+ */
+static std::string printLiteral(const BitVector &value, const BitVector *unknown,
+		const char &base, const bool &grouped) {
+	const bvsize_t n(value.getSize());
+	const bvsize_t nCells(value.getArraySize());
+	const bvdata_t *pv(value.getDataAddress());
+	const bvdata_t *pu(unknown != nullptr ? unknown->getDataAddress() : nullptr);
+	bool known(true), allX(true), allZ(true);
+	if (pu != nullptr) {
+		for (bvsize_t i = 0u; i < nCells; i++) {
+			const bvdata_t mask(
+					i + 1u == nCells ? value.getmaskLastCell() : ~static_cast<bvdata_t>(0u));
+			known = known && !(pu[i] & mask);
+			allX = allX && !(~(pu[i] & pv[i]) & mask);
+			allZ = allZ && !((~pu[i] | pv[i]) & mask);
+		}
+	}
+	std::string ret(std::to_string(n));
+	ret += '\'';
+
+	if (base == 'd') {
+		if (known) {
+			ret += 'd';
+			return fmt::format(grouped ? "{}{:_d}" : "{}{:d}", ret, value);
+		}
+		if (allX || allZ) {
+			ret += 'd';
+			ret += allX ? 'x' : 'z';
+			return ret;
+		}
+		return printLiteral(value, unknown, 'b', grouped);
+	}
+	HV_ASSERT((base == 'b') || (base == 'o') || (base == 'h'),
+			"Invalid Verilog literal base '{}'", base);
+
+	const hvuint32_t bits(base == 'b' ? 1u : (base == 'o' ? 3u : 4u));
+	const hvuint32_t nDigits((n + bits - 1u) / bits);
+	ret += base;
+	ret.reserve(ret.size() + nDigits + (grouped ? nDigits / 4u : 0u));
+	for (hvuint32_t k = nDigits; k-- > 0u;) {
+		const hvuint32_t pos(k * bits);
+		const hvuint32_t width(HV_MIN(bits, n - pos));
+		const hvuint32_t v(extractBits(pv, nCells, pos, width));
+		const hvuint32_t u(
+				pu != nullptr ? extractBits(pu, nCells, pos, width) : 0u);
+		if (!u) {
+			ret += "0123456789abcdef"[v];
+		} else if (u == HV_LSB_MASK_GEN(hvuint32_t, width) && ((v == u) || !v)) {
+			ret += v ? 'x' : 'z';
+		} else {
+			return printLiteral(value, unknown, 'b', grouped);
+		}
+		if (grouped && k && !(k % 4u)) {
+			ret += '_';
+		}
+	}
+	return ret;
+}
+
+std::string toVerilog(const BitVector &src, const char &base,
+		const bool &grouped) {
+	return printLiteral(src, nullptr,
+			static_cast<char>(std::tolower(static_cast<unsigned char>(base))),
+			grouped);
+}
+
+std::string toVerilog(const LogicVector &src, const char &base,
+		const bool &grouped) {
+	return printLiteral(src.getValuePlane(), &src.getUnknownPlane(),
+			static_cast<char>(std::tolower(static_cast<unsigned char>(base))),
+			grouped);
+}
+
+} // namespace common
+} // namespace hv
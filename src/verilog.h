@@ -0,0 +1,90 @@
+/**
+ * @file verilog.h
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Verilog/SystemVerilog sized literals from/to BitVector and LogicVector
+ */
+
+#ifndef HV_VERILOG_H
+#define HV_VERILOG_H
+
+#include <string>
+#include "datatypes.h"
+#include "bitvector.h"
+#include "logicvector.h"
+
+/**
+ * Size of unsized literals ('hFF, 1234), in bits
+ */
+#define HV_VERILOG_UNSIZED_BITWIDTH 32u
+
+namespace hv {
+namespace common {
+
+//** Verilog literals to BitVector/LogicVector **//
+/*
+ * Accepted literals are [-][size]'[s]<base><digits> and plain decimal
+ * numbers, e.g. 32'hDEAD_BEEF, 8'b1010_xxxx, 16'd1234, -8'sd5, 'o17 or 42:
+ *   - base is b, o, d or h (either case), optional s marks a signed literal
+ *   - digits may contain '_' separators, and x, z or ? digits (a decimal
+ *     literal is then made of a single x or z digit)
+ *   - without size, the literal is HV_VERILOG_UNSIZED_BITWIDTH bits wide
+ *   - digits beyond the size are truncated, missing digits are 0, or x/z
+ *     if the leftmost digit is x/z
+ *   - '-' gives the two's complement of the value
+ * Spaces are accepted around the base, as in Verilog sources. Digits are
+ * parsed in one pass and written to the cells directly. Malformed literals
+ * are fatal errors.
+ */
+
+/**
+ * Parse a Verilog literal into a BitVector
+ * X and Z bits are converted to 0.
+ * @param src Source literal
+ * @param dst Destination BitVector, resized to the literal size
+ * @param isSigned If not nullptr, set to true for signed literals
+ * @return True if all bits were 0 or 1, false else
+ */
+bool fromVerilog(const std::string &src, BitVector &dst,
+		bool *isSigned = nullptr);
+
+/**
+ * Parse a Verilog literal into a LogicVector
+ * @param src Source literal
+ * @param dst Destination LogicVector, resized to the literal size
+ * @param isSigned If not nullptr, set to true for signed literals
+ */
+void fromVerilog(const std::string &src, LogicVector &dst,
+		bool *isSigned = nullptr);
+
+//** BitVector/LogicVector to Verilog literals **//
+/**
+ * Print a BitVector as a sized Verilog literal, e.g. 32'hdead_beef
+ * @param src Source BitVector
+ * @param base Literal base: 'b', 'o', 'd' or 'h'
+ * @param grouped Group digits by 4, or by 3 in decimal ('_' separated)
+ * @return Verilog literal
+ */
+std::string toVerilog(const BitVector &src, const char &base = 'h',
+		const bool &grouped = false);
+
+/**
+ * Print a LogicVector as a sized Verilog literal, e.g. 8'b1010_xxxx
+ *
+ * Digits with all their bits X or Z are printed x or z. If a digit mixes
+ * unknown and known bits (or if a decimal literal is not fully known nor
+ * fully X or Z), the literal is printed in binary instead.
+ * @param src Source LogicVector
+ * @param base Literal base: 'b', 'o', 'd' or 'h'
+ * @param grouped Group digits by 4, or by 3 in decimal ('_' separated)
+ * @return Verilog literal
+ */
+std::string toVerilog(const LogicVector &src, const char &base = 'h',
+		const bool &grouped = false);
+
+} // namespace common
+} // namespace hv
+
+#endif // HV_VERILOG_H
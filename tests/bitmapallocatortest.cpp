@@ -0,0 +1,155 @@
+/**
+ * @file bitmapallocatortest.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Tests for bitmapallocator.h
+ */
+
+#include <utility>
+#include <limits>
+#include <vector>
+#include "gtest/gtest.h"
+#include "bitmapallocator.h"
+
+using namespace ::hv::common;
+
+typedef BitVector::bvsize_t bvsize_t;
+
+namespace {
+
+/**
+ * Reference allocator over a bool vector, bit by bit
+ */
+bvsize_t refAllocate(std::vector<bool> &bits, const bvsize_t &n,
+		const bvsize_t &alignment, const hvallocpolicy_t &policy) {
+	const unsigned int size(static_cast<unsigned int>(bits.size()));
+	bool found(false);
+	unsigned int best(0u), bestLength(0u);
+	for (unsigned int start = 0u; start < size;) {
+		if (bits[start]) {
+			start++;
+			continue;
+		}
+		unsigned int end(start);
+		while (end < size && !bits[end]) {
+			end++;
+		}
+		const unsigned int aligned((start + alignment - 1u) / alignment * alignment);
+		if ((aligned + n <= end)
+				&& (!found || (policy == ALLOC_BEST_FIT && end - start < bestLength))) {
+			found = true;
+			best = aligned;
+			bestLength = end - start;
+		}
+		start = end;
+	}
+	if (!found) {
+		return BitmapAllocator::npos;
+	}
+	for (unsigned int i = best; i < best + n; i++) {
+		bits[i] = true;
+	}
+	return static_cast<bvsize_t>(best);
+}
+
+/**
+ * Random allocations and frees against the reference
+ */
+void randomSequence(const bvsize_t &size, const hvallocpolicy_t &policy,
+		const unsigned int &maxRun, const hvuint64_t &seed) {
+	BitmapAllocator alloc(size, policy);
+	std::vector<bool> bits(size, false);
+	std::vector<std::pair<bvsize_t, bvsize_t> > runs;
+	RandomEngine rng(seed);
+	for (unsigned int iter = 0u; iter < 1000u; iter++) {
+		if (runs.empty() || (rng() % 8u) < 5u) {
+			const bvsize_t n(static_cast<bvsize_t>(1u + rng() % maxRun));
+			const bvsize_t alignment(
+					static_cast<bvsize_t>((rng() & 1u) ? 1u : 1u << (rng() % 7u)));
+			const bvsize_t expected(refAllocate(bits, n, alignment, policy));
+			const bvsize_t start(alloc.allocateRun(n, alignment));
+			ASSERT_EQ(start, expected)<< "iteration " << iter << ", n " << n
+					<< ", alignment " << alignment;
+			if (start != BitmapAllocator::npos) {
+				runs.push_back(std::make_pair(start, n));
+			}
+		} else {
+			const std::size_t k(rng() % runs.size());
+			alloc.free(runs[k].first, runs[k].second);
+			for (unsigned int i = 0u; i < runs[k].second; i++) {
+				bits[runs[k].first + i] = false;
+			}
+			runs[k] = runs.back();
+			runs.pop_back();
+		}
+	}
+	const BitVector::bvdata_t *cells(alloc.getBitmap().getDataAddress());
+	bvsize_t nFree(0u);
+	for (bvsize_t i = 0u; i < size; i++) {
+		ASSERT_EQ(((cells[i / 32u] >> (i % 32u)) & 1u) != 0u, bits[i])<< "bit " << i;
+		nFree += !bits[i];
+	}
+	ASSERT_EQ(alloc.getFreeCount(), nFree);
+}
+
+} // namespace
+
+TEST(BitmapAllocatorTest, Basic) {
+	BitmapAllocator alloc(100u);
+	ASSERT_EQ(alloc.getSize(), 100u);
+	ASSERT_EQ(alloc.getFreeCount(), 100u);
+	ASSERT_EQ(alloc.allocateRun(10u), 0u);
+	ASSERT_EQ(alloc.allocateRun(5u, 16u), 16u);
+	ASSERT_EQ(alloc.allocateRun(6u), 10u);
+	ASSERT_EQ(alloc.allocateRun(5u), 21u);
+	ASSERT_TRUE(alloc.allocateAt(90u, 10u));
+	ASSERT_FALSE(alloc.allocateAt(85u, 6u));
+	ASSERT_FALSE(alloc.allocateAt(95u, 10u));
+	ASSERT_EQ(alloc.allocateRun(64u), 26u);
+	ASSERT_EQ(alloc.getFreeCount(), 0u);
+	ASSERT_EQ(alloc.allocateRun(1u), BitmapAllocator::npos);
+	alloc.free(16u, 5u);
+	ASSERT_TRUE(alloc.isFree(16u, 5u));
+	ASSERT_FALSE(alloc.isFree(16u, 6u));
+	ASSERT_EQ(alloc.allocateRun(6u), BitmapAllocator::npos);
+	ASSERT_EQ(alloc.allocateRun(4u, 4u), 16u);
+	ASSERT_EQ(alloc.getFreeCount(), 1u);
+}
+
+TEST(BitmapAllocatorTest, BestFit) {
+	BitmapAllocator alloc(256u, ALLOC_BEST_FIT);
+	ASSERT_TRUE(alloc.allocateAt(40u, 10u));
+	ASSERT_TRUE(alloc.allocateAt(58u, 100u));
+	ASSERT_TRUE(alloc.allocateAt(200u, 50u));
+	// Free runs: [0, 40), [50, 58), [158, 200), [250, 256)
+	ASSERT_EQ(alloc.allocateRun(5u), 250u);
+	ASSERT_EQ(alloc.allocateRun(8u), 50u);
+	ASSERT_EQ(alloc.allocateRun(20u), 0u);
+	ASSERT_EQ(alloc.allocateRun(8u, 32u), 32u);
+	alloc.setPolicy(ALLOC_FIRST_FIT);
+	ASSERT_EQ(alloc.getPolicy(), ALLOC_FIRST_FIT);
+	ASSERT_EQ(alloc.allocateRun(1u), 20u);
+}
+
+TEST(BitmapAllocatorTest, RandomAgainstReference) {
+	const bvsize_t sizes[] = { 1u, 33u, 1000u, 5000u, 20000u };
+	for (const bvsize_t size : sizes) {
+		randomSequence(size, ALLOC_FIRST_FIT, 40u, size);
+		randomSequence(size, ALLOC_BEST_FIT, 40u, size + 1u);
+	}
+	// Long runs spanning empty summary words
+	randomSequence(40000u, ALLOC_FIRST_FIT, 5000u, 7u);
+	randomSequence(40000u, ALLOC_BEST_FIT, 5000u, 8u);
+}
+
+TEST(BitmapAllocatorTest, WideBitmap) {
+	// Bitmaps of more than 65535 bits need 32-bit sizes (HV_BV_WIDE_SIZE)
+	const hvuint32_t size((1u << 20) + 1000u);
+	if (std::numeric_limits<bvsize_t>::max() < size) {
+		return;
+	}
+	randomSequence(static_cast<bvsize_t>(size), ALLOC_FIRST_FIT, 100000u, 9u);
+	randomSequence(static_cast<bvsize_t>(size), ALLOC_BEST_FIT, 100000u, 10u);
+}
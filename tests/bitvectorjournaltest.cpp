@@ -0,0 +1,143 @@
+/**
+ * @file bitvectorjournaltest.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Tests for bitvectorjournal.h
+ */
+
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+#include "bitvectorjournal.h"
+
+using namespace ::hv::common;
+
+TEST(BitVectorJournalTest, Rollback) {
+	BitVectorJournal::clear();
+	BitVector a(100u, 0u), b(16u, 0xABCDu), untracked(32u, 7u);
+	a.setJournaled(true);
+	b.setJournaled(true);
+	ASSERT_TRUE(a.isJournaled());
+	ASSERT_FALSE(untracked.isJournaled());
+	a = static_cast<hvuint64_t>(0x123456789ABCDEFull);
+	const BitVector aRef(a.getSize(), a), bRef(b.getSize(), b);
+
+	const BitVectorJournal::marker_t m(BitVectorJournal::mark());
+	a <<= 3;
+	a |= BitVector(100u, 0xF0F0u);
+	a ^= untracked;
+	b = std::string("0000111100001111");
+	b = true;
+	untracked = 0u;
+	ASSERT_NE(a, aRef);
+	ASSERT_NE(b, bRef);
+	BitVectorJournal::rollback(m);
+	ASSERT_EQ(a, aRef);
+	ASSERT_EQ(b, bRef);
+	ASSERT_EQ(untracked, BitVector(32u, 0u)); // Not journaled
+	ASSERT_EQ(BitVectorJournal::mark(), m);
+}
+
+TEST(BitVectorJournalTest, NestedMarkers) {
+	BitVectorJournal::clear();
+	BitVector r(32u, 0u);
+	r.setJournaled(true);
+	std::vector<BitVectorJournal::marker_t> markers;
+	for (hvuint32_t i = 0u; i < 10u; i++) {
+		markers.push_back(BitVectorJournal::mark());
+		r = i * 3u;
+	}
+	for (hvuint32_t i = 10u; i-- > 0u;) {
+		BitVectorJournal::rollback(markers[i]);
+		ASSERT_EQ(static_cast<hvuint32_t>(r), i ? (i - 1u) * 3u : 0u);
+	}
+}
+
+TEST(BitVectorJournalTest, SubVectors) {
+	BitVectorJournal::clear();
+	BitVector reg(64u, static_cast<hvuint64_t>(0x1122334455667788ull));
+	const BitVector ref(reg.getSize(), reg);
+	reg.setJournaled(true);
+	const BitVectorJournal::marker_t m(BitVectorJournal::mark());
+	reg(15u, 8u) = static_cast<hvuint8_t>(0xFFu);
+	reg[42u] = true;
+	reg(63u, 32u)(3u, 0u) = static_cast<hvuint8_t>(0x0u);
+	ASSERT_EQ(static_cast<hvuint64_t>(reg), 0x112237405566FF88ull);
+	BitVectorJournal::rollback(m);
+	ASSERT_EQ(reg, ref);
+}
+
+TEST(BitVectorJournalTest, ChangedCellsOnly) {
+	BitVectorJournal::clear();
+	BitVector big(1024u, 0u);
+	big.setJournaled(true);
+	BitVector one(1024u, 0u);
+	one.getDataAddress()[5] = 1u;
+	big |= one;
+	ASSERT_EQ(BitVectorJournal::getSize(), 1u);
+	big[1000u] = true;
+	ASSERT_EQ(BitVectorJournal::getSize(), 2u);
+}
+
+TEST(BitVectorJournalTest, Overflow) {
+	BitVectorJournal::setCapacity(100u);
+	ASSERT_EQ(BitVectorJournal::getCapacity(), 128u);
+	BitVector r(32u, 0u);
+	r.setJournaled(true);
+	const BitVectorJournal::marker_t m0(BitVectorJournal::mark());
+	for (hvuint32_t i = 1u; i <= 200u; i++) {
+		r = i;
+	}
+	ASSERT_FALSE(BitVectorJournal::isAvailable(m0));
+	ASSERT_EQ(BitVectorJournal::getSize(), 128u);
+	const BitVectorJournal::marker_t m1(m0 + 72u);
+	ASSERT_TRUE(BitVectorJournal::isAvailable(m1));
+	BitVectorJournal::rollback(m1);
+	ASSERT_EQ(static_cast<hvuint32_t>(r), 72u);
+	r = 0u;
+	BitVectorJournal::clear();
+	ASSERT_FALSE(BitVectorJournal::isAvailable(m1));
+	ASSERT_TRUE(BitVectorJournal::isAvailable(BitVectorJournal::mark()));
+	BitVectorJournal::setCapacity(HV_BV_JOURNAL_DEFAULT_CAPACITY);
+}
+
+TEST(BitVectorJournalTest, Lifetime) {
+	BitVectorJournal::clear();
+	BitVector kept(32u, 1u);
+	kept.setJournaled(true);
+	const BitVectorJournal::marker_t m(BitVectorJournal::mark());
+	{
+		BitVector gone(32u, 0u);
+		gone.setJournaled(true);
+		gone = 5u;
+		kept = 2u;
+	}
+	BitVector resized(32u, 3u);
+	resized.setJournaled(true);
+	resized = 4u;
+	resized.resize(64u);
+	BitVectorJournal::rollback(m); // Records of gone and resized are dropped
+	ASSERT_EQ(static_cast<hvuint32_t>(kept), 1u);
+	ASSERT_EQ(static_cast<hvuint64_t>(resized), 4u);
+}
+
+TEST(BitVectorJournalTest, PerThread) {
+	BitVectorJournal::clear();
+	BitVector a(32u, 0u);
+	a.setJournaled(true);
+	a = 1u;
+	std::thread t([] {
+		BitVector b(32u, 0u);
+		b.setJournaled(true);
+		const BitVectorJournal::marker_t m(BitVectorJournal::mark());
+		b = 2u;
+		b = 3u;
+		ASSERT_EQ(BitVectorJournal::getSize(), 2u);
+		BitVectorJournal::rollback(m);
+		ASSERT_EQ(static_cast<hvuint32_t>(b), 0u);
+	});
+	t.join();
+	ASSERT_EQ(BitVectorJournal::getSize(), 1u);
+}
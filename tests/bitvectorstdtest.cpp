@@ -0,0 +1,137 @@
+/**
+ * @file bitvectorstdtest.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Tests for bitvector_std.h
+ */
+
+#include <bitset>
+#include <vector>
+#include "gtest/gtest.h"
+#include "bitvector_std.h"
+
+using namespace ::hv::common;
+
+template<std::size_t N> static void checkBitsetRoundTrip() {
+	BitVector bv(N, 0u);
+	bv.rand();
+	const std::bitset<N> bs(toBitset<N>(bv));
+	for (std::size_t i = 0; i < N; i++) {
+		ASSERT_EQ(bs[i], static_cast<bool>(bv[i]));
+	}
+	ASSERT_EQ(toBitVector(bs), bv);
+
+	// Destination size is kept
+	BitVector bvSmall(N / 2 + 1, 0u), bvLarge(N + 40, 0u);
+	bvLarge.rand();
+	fromStd(bs, bvSmall);
+	fromStd(bs, bvLarge);
+	ASSERT_EQ(bvSmall, bv(N / 2, 0));
+	ASSERT_EQ(bvLarge, bv);
+
+	std::bitset<N + 40> bsLarge;
+	bsLarge.set();
+	toStd(bv, bsLarge);
+	ASSERT_EQ(toBitVector(bsLarge), bvLarge);
+
+	// Portable path gives the same words
+	hvuint64_t words[HV_STD_N_WORDS(N)], portable[HV_STD_N_WORDS(N)];
+	BitsetWords<N>::get(bs, words);
+	BitsetWords<N, false>::get(bs, portable);
+	for (std::size_t i = 0; i < HV_STD_N_WORDS(N); i++) {
+		ASSERT_EQ(words[i], portable[i]);
+	}
+	std::bitset<N> bsPortable;
+	bsPortable.set();
+	BitsetWords<N, false>::set(words, bsPortable);
+	ASSERT_EQ(bsPortable, bs);
+}
+
+static void checkBoolVectorRoundTrip(const std::size_t &n) {
+	BitVector bv(n, 0u);
+	bv.rand();
+	const std::vector<bool> v(toBoolVector(bv));
+	ASSERT_EQ(v.size(), n);
+	for (std::size_t i = 0; i < n; i++) {
+		ASSERT_EQ(v[i], static_cast<bool>(bv[i]));
+	}
+	ASSERT_EQ(toBitVector(v), bv);
+
+	BitVector bvSmall(n / 2 + 1, 0u), bvLarge(n + 40, 0u);
+	bvLarge.rand();
+	fromStd(v, bvSmall);
+	fromStd(v, bvLarge);
+	ASSERT_EQ(bvSmall, bv(n / 2, 0));
+	ASSERT_EQ(bvLarge, bv);
+
+	// Bits beyond destination size are left out
+	std::vector<bool> vSmall(n / 2 + 1, true);
+	toStd(bv, vSmall);
+	vSmall.push_back(false);
+	const BitVector bvGrown(toBitVector(vSmall));
+	ASSERT_EQ(bvGrown(n / 2, 0), bv(n / 2, 0));
+	ASSERT_FALSE(static_cast<bool>(bvGrown[n / 2 + 1]));
+
+	// Portable path gives the same words
+	std::vector<hvuint64_t> buf, bufPortable;
+	const hvuint64_t *words(BoolVectorWords<>::read(v, buf));
+	const hvuint64_t *portable(BoolVectorWords<false>::read(v, bufPortable));
+	for (std::size_t i = 0; i < HV_STD_N_WORDS(n); i++) {
+		ASSERT_EQ(words[i], portable[i]);
+	}
+	std::vector<bool> vPortable(n, true);
+	hvuint64_t *dst(BoolVectorWords<false>::write(vPortable, bufPortable));
+	for (std::size_t i = 0; i < HV_STD_N_WORDS(n); i++) {
+		dst[i] = words[i];
+	}
+	BoolVectorWords<false>::flush(dst, vPortable);
+	ASSERT_EQ(vPortable, v);
+}
+
+TEST(BitVectorStdTest, BitsetConversion) {
+	for (int n = 0; n < 100; n++) {
+		checkBitsetRoundTrip<1>();
+		checkBitsetRoundTrip<8>();
+		checkBitsetRoundTrip<31>();
+		checkBitsetRoundTrip<32>();
+		checkBitsetRoundTrip<33>();
+		checkBitsetRoundTrip<64>();
+		checkBitsetRoundTrip<65>();
+		checkBitsetRoundTrip<130>();
+		checkBitsetRoundTrip<4096>();
+	}
+}
+
+TEST(BitVectorStdTest, BoolVectorConversion) {
+	for (int n = 0; n < 100; n++) {
+		checkBoolVectorRoundTrip(1);
+		checkBoolVectorRoundTrip(31);
+		checkBoolVectorRoundTrip(32);
+		checkBoolVectorRoundTrip(63);
+		checkBoolVectorRoundTrip(64);
+		checkBoolVectorRoundTrip(65);
+		checkBoolVectorRoundTrip(200);
+		checkBoolVectorRoundTrip(4096);
+	}
+}
+
+TEST(BitVectorStdTest, SubVectorDestination) {
+	BitVector bv(64, 0u);
+	std::bitset<16> bs;
+	for (int i = 0; i < 16; i++) {
+		bs[i] = i % 3 == 0;
+	}
+	BitVector slice(bv(31, 16));
+	fromStd(bs, slice);
+	ASSERT_EQ(bv(31, 16), toBitVector(bs));
+	ASSERT_EQ(bv(15, 0), BitVector(16, 0u));
+	ASSERT_EQ(bv(63, 32), BitVector(32, 0u));
+
+	const std::vector<bool> v(8, true);
+	BitVector slice2(bv(7, 0));
+	fromStd(v, slice2);
+	ASSERT_EQ(bv(7, 0), BitVector(8, 0xFFu));
+	ASSERT_EQ(bv(31, 16), toBitVector(bs));
+}
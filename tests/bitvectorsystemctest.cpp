@@ -0,0 +1,118 @@
+/**
+ * @file bitvectorsystemctest.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Tests for bitvector_systemc.h
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <systemc>
+#include "gtest/gtest.h"
+#include "bitvector_systemc.h"
+#include "hvutils.h"
+
+using namespace ::hv::common;
+
+template<int W> static void checkScBvRoundTrip() {
+	BitVector bv(W, 0u);
+	bv.rand();
+	const sc_dt::sc_bv<W> sbv(toScBv<W>(bv));
+	for (int i = 0; i < W; i++) {
+		ASSERT_EQ(static_cast<bool>(sbv.get_bit(i)), static_cast<bool>(bv[i]));
+	}
+	ASSERT_TRUE(toBitVector(sbv) == bv);
+
+	// Destination size is kept
+	BitVector bvSmall(W / 2 + 1, 0u), bvLarge(W + 40, 0u);
+	bvLarge.rand();
+	fromSystemC(sbv, bvSmall);
+	fromSystemC(sbv, bvLarge);
+	ASSERT_TRUE(bvSmall == bv(W / 2, 0));
+	ASSERT_TRUE(bvLarge == bv);
+}
+
+template<int W> static void checkScBigUintRoundTrip() {
+	BitVector bv(W, 0u);
+	bv.rand();
+	const sc_dt::sc_biguint<W> su(toScBigUint<W>(bv));
+	ASSERT_TRUE(toBitVector(su) == bv);
+	const sc_dt::sc_bigint<W> ss(toScBigInt<W>(bv));
+	ASSERT_TRUE(toBitVector(ss) == bv);
+
+	BitVector bvLarge(W + 70, 0u);
+	bvLarge.rand();
+	fromSystemC(su, bvLarge);
+	ASSERT_TRUE(bvLarge == bv);
+}
+
+template<int W> static void checkScLvRoundTrip() {
+	LogicVector lv(W, LOGIC_0);
+	for (int i = 0; i < W; i++) {
+		lv.set(i, static_cast<hvlogic_t>(std::rand() % 4));
+	}
+	const sc_dt::sc_lv<W> slv(toScLv<W>(lv));
+	for (int i = 0; i < W; i++) {
+		ASSERT_EQ(static_cast<int>(slv.get_bit(i)), static_cast<int>(lv.get(i)));
+	}
+	ASSERT_TRUE(toLogicVector(slv) == lv);
+
+	BitVector bv(W, 0u);
+	ASSERT_EQ(fromSystemC(slv, bv), lv.isFullyKnown());
+	ASSERT_TRUE(bv == lv.toBitVector());
+
+	bv.rand();
+	ASSERT_TRUE(fromSystemC(toScLv<W>(bv), bv));
+	ASSERT_TRUE(toLogicVector(toScLv<W>(bv)) == LogicVector(bv));
+}
+
+TEST(BitVectorSystemCTest, ScBvConversion) {
+	for (int n = 0; n < 100; n++) {
+		checkScBvRoundTrip<1>();
+		checkScBvRoundTrip<8>();
+		checkScBvRoundTrip<31>();
+		checkScBvRoundTrip<32>();
+		checkScBvRoundTrip<33>();
+		checkScBvRoundTrip<64>();
+		checkScBvRoundTrip<65>();
+		checkScBvRoundTrip<130>();
+		checkScBvRoundTrip<512>();
+	}
+}
+
+TEST(BitVectorSystemCTest, ScBigUintConversion) {
+	for (int n = 0; n < 100; n++) {
+		checkScBigUintRoundTrip<1>();
+		checkScBigUintRoundTrip<17>();
+		checkScBigUintRoundTrip<32>();
+		checkScBigUintRoundTrip<64>();
+		checkScBigUintRoundTrip<100>();
+		checkScBigUintRoundTrip<512>();
+	}
+}
+
+TEST(BitVectorSystemCTest, ScLvConversion) {
+	for (int n = 0; n < 100; n++) {
+		checkScLvRoundTrip<1>();
+		checkScLvRoundTrip<13>();
+		checkScLvRoundTrip<32>();
+		checkScLvRoundTrip<64>();
+		checkScLvRoundTrip<99>();
+		checkScLvRoundTrip<300>();
+	}
+}
+
+TEST(BitVectorSystemCTest, SubVectorDestination) {
+	BitVector bv(64, 0u);
+	sc_dt::sc_bv<16> sbv;
+	for (int i = 0; i < 16; i++) {
+		sbv.set_bit(i, i % 3 == 0);
+	}
+	BitVector slice(bv(31, 16));
+	fromSystemC(sbv, slice);
+	ASSERT_TRUE(bv(31, 16) == toBitVector(sbv));
+	ASSERT_TRUE(bv(15, 0) == BitVector(16, 0u));
+	ASSERT_TRUE(bv(63, 32) == BitVector(32, 0u));
+}
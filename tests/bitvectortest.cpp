@@ -14,6 +14,7 @@
 #include <cstdlib>
 #include <iostream>
 #include <sstream>
+#include <vector>
 #include <cci_configuration>
 #include "gtest/gtest.h"
 #include "bitvector.h"
@@ -438,6 +439,131 @@ TEST_F(BitVectorTest, ConcatenationTest) {
 	}
 }
 
+TEST_F(BitVectorTest, NaryConcatenationTest) {
+	for (auto j = 0u; j < nTests; j++) {
+		const auto nOperands = (std::rand() % 40) + 1;
+		std::vector<BitVector> operands;
+		std::string concatStr;
+		for (auto k = 0; k < nOperands; k++) {
+			const std::string str(test::bitRandStr((std::rand() % 70) + 1));
+			operands.push_back(BitVector(str));
+#ifdef HV_BV_STR_MSB_FIRST
+			concatStr += str;
+#else
+			concatStr = str + concatStr;
+#endif
+		}
+		// Chained operator+ and concat(...) must agree
+		BitVector chained(operands[0].copy());
+		for (auto k = 1; k < nOperands; k++) {
+			const BitVector tmp(chained + operands[k]);
+			chained.resize(tmp.getSize());
+			chained = tmp;
+		}
+		ASSERT_STREQ(concatStr.c_str(), chained.toString().c_str());
+	}
+
+	const std::string s1(test::bitRandStr(33)), s2(test::bitRandStr(7)), s3(
+			test::bitRandStr(64)), s4(test::bitRandStr(1));
+	BitVector bv1(s1), bv2(s2), bv3(s3), bv4(s4);
+	const BitVector ret(concat(bv1, bv2, bv3, bv4));
+	ASSERT_EQ(ret.getSize(), 105u);
+	ASSERT_TRUE(ret == bv1 + bv2 + bv3 + bv4);
+#ifdef HV_BV_STR_MSB_FIRST
+	ASSERT_EQ(ret.toString(), s1 + s2 + s3 + s4);
+#endif
+
+	// Slices and native types
+	BitVector x(8, 0xF0), y(8, 0x0F);
+	ASSERT_TRUE(concat(x(6, 3), y(4, 1), static_cast<hvuint8_t>(0xA5)) == BitVector(std::string("1110011110100101")));
+	ASSERT_TRUE(concat(x) == x);
+
+	// Random widths and sub-vector operands against chained operator+
+	auto randomOperand = [](BitVector &parent) {
+		const BitVector::bvsize_t hi(std::rand() % parent.getSize());
+		const BitVector::bvsize_t lo(std::rand() % (hi + 1));
+		return (std::rand() & 1) ? parent(hi, lo) : parent;
+	};
+	for (auto j = 0u; j < nTests; j++) {
+		BitVector p1((std::rand() % 100) + 1, 0u), p2((std::rand() % 100) + 1, 0u),
+				p3((std::rand() % 100) + 1, 0u), p4((std::rand() % 100) + 1, 0u),
+				p5((std::rand() % 100) + 1, 0u);
+		p1.rand();
+		p2.rand();
+		p3.rand();
+		p4.rand();
+		p5.rand();
+		const BitVector a(randomOperand(p1)), b(randomOperand(p2)), c(
+				randomOperand(p3)), d(randomOperand(p4)), e(randomOperand(p5));
+		const BitVector ab(a + b), abc(ab + c), abcd(abc + d), abcde(abcd + e);
+		ASSERT_EQ(concat(a, b), ab);
+		ASSERT_EQ(concat(a, b, c), abc);
+		ASSERT_EQ(concat(a, b, c, d, e), abcde);
+		ASSERT_EQ(concat(a, b, c, d, e).getSize(), abcde.getSize());
+	}
+}
+
+TEST_F(BitVectorTest, BitSearchTest) {
+	const BitVector::bvsize_t npos(BitVector::npos);
+	for (auto size : { 1u, 7u, 32u, 33u, 64u, 100u, 1024u, 1030u }) {
+		for (auto i = 0u; i < nTests / 50; i++) {
+			BitVector bv(size, 0u);
+			// Sparse and dense vectors
+			bv.rand();
+			for (auto k = 0u; k < i % 4u; k++) {
+				BitVector mask(size, 0u);
+				mask.rand();
+				bv &= mask;
+			}
+			if (i % 7u == 0u) {
+				bv = BitVector(size, 0u);
+			}
+
+			std::vector<BitVector::bvsize_t> setBits;
+			for (auto j = 0u; j < size; j++) {
+				if (static_cast<bool>(bv[j])) {
+					setBits.push_back(j);
+				}
+			}
+			ASSERT_EQ(bv.priorityEncode(), setBits.empty() ? npos : setBits[0]);
+			ASSERT_EQ(bv.isOneHot(), setBits.size() == 1u);
+			ASSERT_EQ(bv.oneHotEncode(),
+					setBits.size() == 1u ? setBits[0] : npos);
+
+			for (auto from = 0u; from <= size; from += 1u + size / 50u) {
+				BitVector::bvsize_t expected(npos), expectedWrap(npos);
+				for (auto b : setBits) {
+					if (b >= from) {
+						expected = b;
+						break;
+					}
+				}
+				expectedWrap = (expected == npos && !setBits.empty()) ?
+						setBits[0] : expected;
+				ASSERT_EQ(bv.findNextSet(from), expected)<< "size " << size << ", from " << from;
+				ASSERT_EQ(bv.findNextSet(from, true), expectedWrap)<< "size " << size << ", from " << from;
+			}
+		}
+	}
+
+	// Garbage beyond size and sub-vectors
+	BitVector big(std::string("1000000000000000000000000000000000000001"));
+	ASSERT_EQ(big(38, 1).priorityEncode(), npos);
+	ASSERT_EQ(big(39, 1).oneHotEncode(), 38u);
+	ASSERT_EQ(big.findNextSet(1u), 39u);
+	ASSERT_EQ(big.findNextSet(40u, true), 0u);
+
+	// One-hot round trip
+	for (auto width : { 1u, 31u, 32u, 1024u }) {
+		for (auto index = 0u; index < width; index += 1u + width / 10u) {
+			const BitVector oneHot(BitVector::oneHotDecode(index, width));
+			ASSERT_EQ(oneHot.getSize(), width);
+			ASSERT_EQ(oneHot.oneHotEncode(), index);
+		}
+		ASSERT_TRUE(!BitVector::oneHotDecode(width, width));
+	}
+}
+
 TEST_F(BitVectorTest, VectorSelectionTest) {
 	for (auto size = 12u; size <= maxSize; size++) {
 		std::string str(size, '0');
@@ -543,6 +669,218 @@ TEST_F(BitVectorTest, InteroperabilityTest) {
 
 }
 
+/**
+ * Checks integer operator fast paths against BitVector operands
+ */
+template<typename T> void checkScalarOperators(const BitVector &a,
+		const T &b) {
+	const BitVector bv(bv_scalar<T>::width(), b);
+	ASSERT_EQ(a == b, a == bv)<< a << " == " << bv;
+	ASSERT_EQ(b == a, a == bv)<< a << " == " << bv;
+	ASSERT_EQ(a != b, a != bv)<< a << " != " << bv;
+	ASSERT_EQ(a && b, a && bv)<< a << " && " << bv;
+	ASSERT_EQ(b || a, a || bv)<< a << " || " << bv;
+
+	const BitVector andRef(a & BitVector(HV_MIN(a.getSize(), bv.getSize()), b));
+	const BitVector andRes(a & b);
+	ASSERT_EQ(andRes.getSize(), andRef.getSize());
+	ASSERT_EQ(andRes, andRef)<< a << " & " << bv;
+	const BitVector orRes(b | a);
+	ASSERT_EQ(orRes.getSize(), (a | bv).getSize());
+	ASSERT_EQ(orRes, a | bv)<< a << " | " << bv;
+	const BitVector xorRes(a ^ b);
+	ASSERT_EQ(xorRes.getSize(), (a ^ bv).getSize());
+	ASSERT_EQ(xorRes, a ^ bv)<< a << " ^ " << bv;
+
+	BitVector res(a.getSize(), a), ref(a.getSize(), a);
+	res &= b;
+	ref &= bv;
+	ASSERT_EQ(res, ref)<< a << " &= " << bv;
+	res |= b;
+	ref |= bv;
+	ASSERT_EQ(res, ref)<< a << " |= " << bv;
+	res ^= b;
+	ref ^= bv;
+	ASSERT_EQ(res, ref)<< a << " ^= " << bv;
+}
+
+TEST_F(BitVectorTest, ScalarOperatorsTest) {
+	RandomEngine rng(7u);
+	for (BitVector::bvsize_t size = 1u; size <= maxSize; size++) {
+		BitVector a(size, false);
+		for (auto i = 0u; i < nTests / 100u; i++) {
+			a.rand(rng);
+			const hvuint64_t r((static_cast<hvuint64_t>(rng()) << 32) | rng());
+			checkScalarOperators(a, static_cast<bool>(r & 1u));
+			checkScalarOperators(a, static_cast<hvuint8_t>(r));
+			checkScalarOperators(a, static_cast<hvuint16_t>(r));
+			checkScalarOperators(a, static_cast<hvuint32_t>(r));
+			checkScalarOperators(a, r);
+			checkScalarOperators(a, static_cast<hvint8_t>(r));
+			checkScalarOperators(a, static_cast<hvint16_t>(r));
+			checkScalarOperators(a, static_cast<hvint32_t>(r));
+			checkScalarOperators(a, static_cast<hvint64_t>(r));
+#ifdef HV_HAS_INT128
+			const hvuint128_t r128((static_cast<hvuint128_t>(r) << 64) ^ rng());
+			checkScalarOperators(a, r128);
+			checkScalarOperators(a, static_cast<hvint128_t>(r128));
+			checkScalarOperators(a, static_cast<hvuint128_t>(a));
+#endif
+			// Equal values
+			checkScalarOperators(a, static_cast<hvuint8_t>(a));
+			checkScalarOperators(a, static_cast<hvuint32_t>(a));
+			checkScalarOperators(a, static_cast<hvint64_t>(a));
+		}
+	}
+
+	// Sub-vectors
+	BitVector reg(64u, static_cast<hvuint64_t>(0x0123456789ABCDEFull));
+	ASSERT_TRUE(reg(15u, 8u) == 0xCDu);
+	ASSERT_TRUE(reg(39u, 32u) != 0x66u);
+	reg(15u, 8u) |= 0x30u;
+	reg(7u, 0u) &= 0x0Fu;
+	reg(63u, 56u) ^= 0xFFu;
+	ASSERT_TRUE(reg == static_cast<hvuint64_t>(0xFE23456789ABFD0Full));
+}
+
+#ifdef HV_HAS_INT128
+TEST_F(BitVectorTest, Int128Test) {
+	const hvuint128_t v((static_cast<hvuint128_t>(0x0123456789ABCDEFull) << 64)
+			| 0xFEDCBA9876543210ull);
+	BitVector a(v);
+	ASSERT_EQ(a.getSize(), 128u);
+	ASSERT_EQ(static_cast<hvuint128_t>(a), v);
+	ASSERT_EQ(static_cast<hvuint64_t>(a), 0xFEDCBA9876543210ull);
+	ASSERT_EQ(static_cast<hvuint64_t>(a(127u, 64u)), 0x0123456789ABCDEFull);
+	ASSERT_TRUE(a == v);
+
+	// Truncation and zero extension
+	BitVector b(100u, v);
+	ASSERT_EQ(static_cast<hvuint128_t>(b), v & HV_LSB_MASK_GEN(hvuint128_t, 100u));
+	BitVector c(8u, false);
+	c = v;
+	ASSERT_EQ(static_cast<hvuint128_t>(c), 0x10u);
+	BitVector d(200u, false);
+	d.rand();
+	d = v;
+	ASSERT_EQ(static_cast<hvuint128_t>(d), v);
+	ASSERT_FALSE(d(199u, 128u));
+
+	// Signed values
+	const hvint128_t minusOne(-1);
+	BitVector e(minusOne);
+	ASSERT_EQ(e.getSize(), 128u);
+	ASSERT_EQ(static_cast<hvint128_t>(e), minusOne);
+	ASSERT_EQ(static_cast<hvuint128_t>(e), ~static_cast<hvuint128_t>(0u));
+
+	// Sub-vector assignment and interoperability
+	BitVector f(256u, false);
+	f(191u, 64u) = v;
+	ASSERT_EQ(static_cast<hvuint128_t>(f >> 64u), v);
+	hvuint128_t x(v);
+	x ^= a;
+	ASSERT_EQ(x, 0u);
+	ASSERT_EQ((BitVector(64u, 0u) + v).getSize(), 192u);
+}
+#endif
+
+TEST_F(BitVectorTest, SharedStorageTest) {
+	const BitVector::bvsize_t threshold(BitVector::getShareThreshold());
+	BitVector::setShareThreshold(128u);
+	// Non-const getDataAddress() would take ownership
+	auto cells = [](const BitVector &bv) {
+		return bv.getDataAddress();
+	};
+	BitVector reg(256u, 0u);
+	reg.rand();
+	const BitVector ref(reg);
+	const BitVector narrow(100u, reg);
+	ASSERT_TRUE(reg.isShared());
+	ASSERT_FALSE(narrow.isShared());
+
+	// Copies share the cells until the first write
+	std::vector<BitVector> snapshots(100u, reg);
+	const BitVector &snap(snapshots[1]);
+	ASSERT_EQ(cells(snap), cells(ref));
+	reg ^= BitVector(256u, 1u);
+	ASSERT_FALSE(reg.isShared());
+	ASSERT_NE(cells(snap), cells(reg));
+	ASSERT_EQ(snap, ref);
+	ASSERT_EQ(reg, ref ^ BitVector(256u, 1u));
+	reg = snap;
+	ASSERT_EQ(cells(reg), cells(ref));
+	reg(200u, 100u) = 0u;
+	reg[3u] = !reg[3u];
+	ASSERT_EQ(snap, ref);
+	ASSERT_EQ(reg(200u, 100u), 0u);
+
+	// Every write path detaches
+	BitVector a(ref), b(ref), c(ref), d(ref), e(ref), f(ref);
+	a = static_cast<hvuint64_t>(5u);
+	b |= static_cast<hvuint64_t>(0xFFu);
+	c.rand();
+	d = std::string(256u, '1');
+	e.getDataAddress()[7] = ~e.getDataAddress()[7];
+	f.resize(300u);
+	f[299u] = true;
+	snapshots.clear();
+	ASSERT_EQ(b(7u, 0u), 0xFFu);
+	ASSERT_EQ(b(255u, 8u), ref(255u, 8u));
+	ASSERT_EQ(d, ~BitVector(256u, 0u));
+	ASSERT_EQ(static_cast<hvuint64_t>(a), 5u);
+	ASSERT_EQ(e ^ ref, BitVector(256u, 0xFFFFFFFFu) << 224u);
+	ASSERT_EQ(f(255u, 0u), ref);
+	ASSERT_FALSE(ref.isShared());
+
+	// A threshold of 0 disables sharing
+	BitVector::setShareThreshold(0u);
+	const BitVector g(ref);
+	ASSERT_FALSE(g.isShared());
+	BitVector::setShareThreshold(threshold);
+}
+
+TEST_F(BitVectorTest, FormatterTest) {
+	for (auto size = 1u; size <= maxSize; size++) {
+		BitVector bv(size, 0u);
+		bv.rand();
+		ASSERT_EQ(fmt::format("{}", bv), bv.toString());
+	}
+	const BitVector reg(32u, 0x12345678u);
+	ASSERT_EQ(fmt::format("{:x}", reg), "12345678");
+	ASSERT_EQ(fmt::format("{:#_x}", reg), "0x1234_5678");
+	ASSERT_EQ(fmt::format("{:#X}", BitVector(12u, 0xABCu)), "0XABC");
+	ASSERT_EQ(fmt::format("{:x}", BitVector(10u, 0x3FFu)), "3ff");
+	ASSERT_EQ(fmt::format("{:#_x}", BitVector(20u, 0x1u)), "0x0_0001");
+	ASSERT_EQ(fmt::format("{:b}", BitVector(6u, 0x5u)), "000101");
+	ASSERT_EQ(fmt::format("{:#_b}", BitVector(6u, 0x25u)), "0b10_0101");
+	ASSERT_EQ(fmt::format("{:_}", BitVector(8u, 0xF0u)), "1111_0000");
+	ASSERT_EQ(fmt::format("{:d}", BitVector(5u, 0u)), "0");
+	ASSERT_EQ(fmt::format("{:d}", reg), "305419896");
+	ASSERT_EQ(fmt::format("{:_d}", reg), "305_419_896");
+	ASSERT_EQ(fmt::format("{:d}", BitVector(64u, ~static_cast<hvuint64_t>(0u))),
+			"18446744073709551615");
+	ASSERT_EQ(fmt::format("{:d}", BitVector(128u, 1u) << 100u),
+			"1267650600228229401496703205376");
+	ASSERT_EQ(fmt::format("{:d}", BitVector(128u, 1000000000u)), "1000000000");
+
+	// Decimal against 64-bit conversions, on the stack and beyond it
+	for (auto size : {100u, 3000u}) {
+		BitVector bv(size, 0u);
+		for (auto i = 0u; i < nTests / 100; i++) {
+			bv.rand();
+			bv(size - 1u, 64u) = 0u;
+			ASSERT_EQ(fmt::format("{:d}", bv),
+					std::to_string(static_cast<hvuint64_t>(bv)));
+		}
+	}
+	const std::string pow2999(fmt::format("{:d}", BitVector(3000u, 1u) << 2999u));
+	ASSERT_EQ(pow2999.size(), 903u);
+	ASSERT_EQ(pow2999.substr(0u, 20u), "61511596108055858846");
+	ASSERT_EQ(pow2999.substr(883u), "36089259509114994688");
+	ASSERT_EQ(fmt::format("{:x}", ~BitVector(3000u, 0u)), std::string(750u, 'f'));
+	ASSERT_THROW(fmt::format(fmt::runtime("{:q}"), reg), fmt::format_error);
+}
+
 TEST_F(BitVectorTest, FlipTest) {
 	for (auto size = 1u; size <= maxSize; size++) {
 		BitVector bv(size, 0u);
@@ -583,6 +921,30 @@ TEST_F(BitVectorTest, StripTest) {
 	}
 }
 
+TEST_F(BitVectorTest, SyncParentTest) {
+	for (auto size = 2u; size <= maxSize; size++) {
+		BitVector bv(size, 0u);
+		for (auto i = 0u; i < nTests / 100; i++) {
+			bv.rand();
+			const BitVector ref(bv.copy());
+			const auto hi = std::rand() % size;
+			const auto lo = std::rand() % (hi + 1u);
+			BitVector sub(bv(hi, lo));
+			BitVector subSub(sub(hi - lo, 0u));
+			// Direct write of the sub-sub-vector LSB
+			subSub.getDataAddress()[0] ^= 1u;
+			subSub.syncParent();
+			BitVector expected(ref.copy());
+			expected[lo] = !ref[lo];
+			ASSERT_EQ(bv, expected)<< "Sub-vector direct write not propagated";
+		}
+	}
+	BitVector bv(8u, 0xA5u);
+	bv.getDataAddress()[0] = 0x5Au;
+	bv.syncParent();
+	ASSERT_EQ(bv, BitVector(8u, 0x5Au));
+}
+
 TEST_F(BitVectorTest, StartingGuidePart1Test) {
 	// Declarations and initialization
 	BitVector bv1(12, 0);
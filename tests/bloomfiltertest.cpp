@@ -0,0 +1,100 @@
+/**
+ * @file bloomfiltertest.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Tests for bloomfilter.h
+ */
+
+#include <set>
+#include <vector>
+#include "gtest/gtest.h"
+#include "bloomfilter.h"
+
+using namespace ::hv::common;
+
+TEST(BloomFilterTest, NoFalseNegatives) {
+	BloomFilter filter(8192u, 3u);
+	ASSERT_EQ(filter.getNBits(), 8192u);
+	ASSERT_EQ(filter.getNHashes(), 3u);
+	RandomEngine rng(1u);
+	std::set<hvaddr_t> inserted;
+	for (unsigned int i = 0u; i < 512u; i++) {
+		const hvaddr_t addr(rng());
+		filter.insert(addr);
+		inserted.insert(addr);
+	}
+	for (const hvaddr_t addr : inserted) {
+		ASSERT_TRUE(filter.mayContain(addr));
+	}
+
+	// Theoretical false positive rate: (1 - exp(-3 * 512 / 8192))^3 ~ 0.5%
+	unsigned int falsePositives(0u);
+	for (unsigned int i = 0u; i < 100000u; i++) {
+		const hvaddr_t addr(rng());
+		falsePositives += !inserted.count(addr) && filter.mayContain(addr);
+	}
+	ASSERT_LT(falsePositives, 1000u);
+
+	filter.clear();
+	ASSERT_TRUE(!filter.getBitmap());
+	ASSERT_FALSE(filter.mayContain(*inserted.begin()));
+}
+
+TEST(BloomFilterTest, Ranges) {
+	// 64-byte granules
+	BloomFilter filter(1024u, 4u, 6u);
+	filter.insertRange(0x1000u, 0x100u);
+	filter.insert(0xFFFFFFFFFFFFFFFFULL);
+	for (hvaddr_t a = 0x1000u; a < 0x1100u; a += 8u) {
+		ASSERT_TRUE(filter.mayContain(a));
+		ASSERT_TRUE(filter.mayContainRange(a, 8u));
+	}
+	ASSERT_TRUE(filter.mayContainRange(0xFF0u, 0x20u));
+	ASSERT_TRUE(filter.mayContainRange(0x10FFu, 2u));
+	ASSERT_TRUE(filter.mayContainRange(0xFFFFFFFFFFFFFFC0ULL, 0x40u));
+	// Granules outside the range are (with this filter size) not set
+	unsigned int hits(0u);
+	for (hvaddr_t a = 0x2000u; a < 0x12000u; a += 0x40u) {
+		hits += filter.mayContainRange(a, 4u);
+	}
+	ASSERT_LT(hits, 10u);
+}
+
+TEST(BloomFilterTest, Counting) {
+	CountingBloomFilter filter(4096u, 3u, 2u);
+	RandomEngine rng(2u);
+	std::vector<hvaddr_t> addrs;
+	for (unsigned int i = 0u; i < 300u; i++) {
+		addrs.push_back(rng() & ~static_cast<hvaddr_t>(0xFu));
+		filter.insertRange(addrs.back(), 16u);
+	}
+	// Erasing half of the ranges
+	for (unsigned int i = 0u; i < 300u; i += 2u) {
+		filter.eraseRange(addrs[i], 16u);
+	}
+	for (unsigned int i = 1u; i < 300u; i += 2u) {
+		ASSERT_TRUE(filter.mayContainRange(addrs[i], 16u));
+		ASSERT_TRUE(filter.mayContain(addrs[i] + 15u));
+	}
+	for (unsigned int i = 1u; i < 300u; i += 2u) {
+		filter.eraseRange(addrs[i], 16u);
+	}
+	// Empty again: exact
+	ASSERT_TRUE(!filter.getBitmap());
+
+	// Saturated counters are never decremented
+	for (unsigned int i = 0u; i < 300u; i++) {
+		filter.insert(0x40u);
+	}
+	for (unsigned int i = 0u; i < 300u; i++) {
+		filter.erase(0x40u);
+	}
+	ASSERT_TRUE(filter.mayContain(0x40u));
+	filter.clear();
+	ASSERT_FALSE(filter.mayContain(0x40u));
+	filter.insert(0x40u);
+	filter.erase(0x40u);
+	ASSERT_FALSE(filter.mayContain(0x40u));
+}
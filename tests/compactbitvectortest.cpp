@@ -0,0 +1,99 @@
+/**
+ * @file compactbitvectortest.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Tests for compactbitvector.h
+ */
+
+#include <sstream>
+#include "gtest/gtest.h"
+#include "compactbitvector.h"
+
+using namespace ::hv::common;
+
+typedef BitVector::bvsize_t bvsize_t;
+
+TEST(CompactBitVectorTest, Layout) {
+	ASSERT_LE(sizeof(CompactBitVector), 16u);
+	const CompactBitVector def;
+	ASSERT_EQ(def.getSize(), 32u);
+	ASSERT_EQ(def.getValue(), 0u);
+}
+
+TEST(CompactBitVectorTest, AgainstBitVector) {
+	RandomEngine rng(5u);
+	for (bvsize_t size = 1u; size <= HV_CBV_MAX_BITWIDTH; size++) {
+		for (unsigned int i = 0u; i < 20u; i++) {
+			const hvuint64_t r1((static_cast<hvuint64_t>(rng()) << 32) | rng());
+			const hvuint64_t r2((static_cast<hvuint64_t>(rng()) << 32) | rng());
+			const bvsize_t size2(static_cast<bvsize_t>(1u + rng() % 64u));
+			const CompactBitVector a(size, r1), b(size2, r2);
+			const BitVector ra(size, r1), rb(size2, r2);
+
+			ASSERT_EQ(a.toBitVector(), ra);
+			ASSERT_EQ(CompactBitVector(ra), a);
+			ASSERT_EQ(a.toString(), ra.toString());
+			ASSERT_EQ(a.count(), popCount(r1 & HV_LSB_MASK_GEN(hvuint64_t, size)));
+			ASSERT_EQ(a == b, ra == rb);
+			ASSERT_EQ(a != b, ra != rb);
+			ASSERT_EQ(!a, !ra);
+			ASSERT_EQ((~a).toBitVector(), ~ra);
+			ASSERT_EQ((a & b).toBitVector(), ra & rb);
+			ASSERT_EQ((a & b).getSize(), (ra & rb).getSize());
+			ASSERT_EQ((a | b).toBitVector(), ra | rb);
+			ASSERT_EQ((a ^ b).toBitVector(), ra ^ rb);
+			const hvuint32_t shift(rng() % 70u);
+			ASSERT_EQ((a << shift).toBitVector(), ra << shift);
+			ASSERT_EQ((a >> shift).toBitVector(), ra >> shift);
+			if (size + size2 <= HV_CBV_MAX_BITWIDTH) {
+				ASSERT_EQ((a + b).toBitVector(), ra + rb);
+			}
+
+			CompactBitVector c(a);
+			BitVector rc(ra.getSize(), ra);
+			c &= b;
+			rc &= rb;
+			ASSERT_EQ(c.toBitVector(), rc);
+			c |= b;
+			rc |= rb;
+			ASSERT_EQ(c.toBitVector(), rc);
+			c ^= b;
+			rc ^= rb;
+			ASSERT_EQ(c.toBitVector(), rc);
+			ASSERT_EQ(c.getSize(), size);
+
+			const bvsize_t lo(static_cast<bvsize_t>(rng() % size));
+			const bvsize_t hi(static_cast<bvsize_t>(lo + rng() % (size - lo)));
+			ASSERT_EQ(a.getRange(hi, lo).toBitVector(), ra(hi, lo).copy());
+			c = a;
+			rc = ra;
+			c.setRange(lo, hi, r2);
+			rc(hi, lo) = r2;
+			ASSERT_EQ(c.toBitVector(), rc);
+			c.set(lo, false);
+			rc[lo] = false;
+			ASSERT_EQ(c.toBitVector(), rc);
+			ASSERT_FALSE(c.get(lo));
+			c.set(hi);
+			ASSERT_TRUE(c.get(hi));
+		}
+	}
+}
+
+TEST(CompactBitVectorTest, Values) {
+	CompactBitVector a(12u, 0xFABCu);
+	ASSERT_EQ(a.getValue(), 0xABCu);
+	a.setValue(~static_cast<hvuint64_t>(0u));
+	ASSERT_EQ(a.getValue(), 0xFFFu);
+	ASSERT_EQ(a.getRange(3u, 0u).getValue(), 0xFu);
+	a.setRange(11u, 8u, 0x0u);
+	ASSERT_EQ(a.getValue(), 0x0FFu);
+	CompactBitVector full(64u, ~static_cast<hvuint64_t>(0u));
+	ASSERT_EQ(full.count(), 64u);
+	ASSERT_EQ((full >> 63u).getValue(), 1u);
+	std::ostringstream os;
+	os << CompactBitVector(4u, 0x5u);
+	ASSERT_EQ(os.str(), CompactBitVector(4u, 0x5u).toString());
+}
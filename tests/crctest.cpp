@@ -0,0 +1,153 @@
+/**
+ * @file crctest.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Tests for crc.h
+ */
+
+#include <cstring>
+#include <vector>
+#include "gtest/gtest.h"
+#include "crc.h"
+#include "random.h"
+
+using namespace ::hv::common;
+
+static const char CHECK_STR[] = "123456789";
+
+/**
+ * Bit-serial reference CRC over the first nBits bits of a byte stream
+ * (Rocksoft model, bits of each byte taken LSB first if refIn)
+ */
+static hvuint64_t refCrc(const CrcEngine &e, const hvuint8_t *p,
+		const std::size_t &nBits) {
+	const unsigned int w(e.getWidth());
+	const hvuint64_t mask(HV_LSB_MASK_GEN(hvuint64_t, w));
+	const hvuint64_t top(static_cast<hvuint64_t>(1u) << (w - 1u));
+	hvuint64_t reg(e.getInit());
+	for (std::size_t i = 0u; i < nBits; i++) {
+		const unsigned int byteLen(
+				(i / 8u) * 8u + 8u <= nBits ? 8u : nBits % 8u);
+		const unsigned int j(
+				e.getRefIn() ? i % 8u : byteLen - 1u - (i % 8u));
+		const bool bit((p[i / 8u] >> j) & 1u);
+		const bool msb((reg & top) != 0u);
+		reg = (reg << 1) & mask;
+		if (msb != bit) {
+			reg ^= e.getPoly();
+		}
+	}
+	if (e.getRefOut()) {
+		hvuint64_t r(0u);
+		for (unsigned int i = 0u; i < w; i++) {
+			r |= ((reg >> i) & 1u) << (w - 1u - i);
+		}
+		reg = r;
+	}
+	return (reg ^ e.getXorOut()) & mask;
+}
+
+TEST(CrcTest, CheckValues) {
+	ASSERT_EQ(CrcEngine::getCrc32().compute(CHECK_STR, 9u), 0xCBF43926u);
+	ASSERT_EQ(CrcEngine::getCrc32c().compute(CHECK_STR, 9u), 0xE3069283u);
+	ASSERT_EQ(CrcEngine::getCrc64Xz().compute(CHECK_STR, 9u),
+			0x995DC9BBDF1939FAULL);
+	ASSERT_EQ(CrcEngine::getCrc64Ecma182().compute(CHECK_STR, 9u),
+			0x6C40DF5F0B497347ULL);
+	ASSERT_EQ(CrcEngine::getCrc16CcittFalse().compute(CHECK_STR, 9u),
+			0x29B1u);
+
+	// CRC-32/BZIP2
+	ASSERT_EQ(
+			CrcEngine(32u, 0x04C11DB7u, 0xFFFFFFFFu, false, false, 0xFFFFFFFFu).compute(CHECK_STR, 9u),
+			0xFC891918u);
+	// CRC-8
+	ASSERT_EQ(CrcEngine(8u, 0x07u, 0u, false, false, 0u).compute(CHECK_STR, 9u),
+			0xF4u);
+	// CRC-5/USB
+	ASSERT_EQ(
+			CrcEngine(5u, 0x05u, 0x1Fu, true, true, 0x1Fu).compute(CHECK_STR, 9u),
+			0x19u);
+	// CRC-12/UMTS
+	ASSERT_EQ(
+			CrcEngine(12u, 0x80Fu, 0u, false, true, 0u).compute(CHECK_STR, 9u),
+			0xDAFu);
+
+	// Empty buffer
+	ASSERT_EQ(CrcEngine::getCrc32().compute(CHECK_STR, 0u), 0u);
+}
+
+TEST(CrcTest, AcceleratedVsTable) {
+	const CrcEngine *presets[] = { &CrcEngine::getCrc32(),
+			&CrcEngine::getCrc32c(), &CrcEngine::getCrc64Xz(),
+			&CrcEngine::getCrc64Ecma182(), &CrcEngine::getCrc16CcittFalse() };
+	CrcEngine crc5(5u, 0x05u, 0x1Fu, true, true, 0x1Fu);
+	RandomEngine rng(31u);
+	std::vector<hvuint8_t> buf(4096u + 7u);
+	for (auto &b : buf) {
+		b = static_cast<hvuint8_t>(rng());
+	}
+
+	for (unsigned int k = 0u; k < 6u; k++) {
+		const CrcEngine &accel(k < 5u ? *presets[k] : crc5);
+		CrcEngine table(accel);
+		table.setAccelerated(false);
+		ASSERT_FALSE(table.isAccelerated());
+		for (std::size_t len = 0u; len <= 300u; len++) {
+			for (std::size_t offset = 0u; offset < 3u; offset++) {
+				ASSERT_EQ(accel.compute(buf.data() + offset, len),
+						table.compute(buf.data() + offset, len))<< "len = " << len;
+			}
+		}
+		for (std::size_t len = 1000u; len <= buf.size(); len += 331u) {
+			ASSERT_EQ(accel.compute(buf.data(), len),
+					table.compute(buf.data(), len));
+			ASSERT_EQ(table.compute(buf.data(), len),
+					refCrc(table, buf.data(), len * 8u));
+		}
+	}
+}
+
+TEST(CrcTest, Incremental) {
+	const CrcEngine &e(CrcEngine::getCrc32());
+	RandomEngine rng(32u);
+	std::vector<hvuint8_t> buf(2000u);
+	for (auto &b : buf) {
+		b = static_cast<hvuint8_t>(rng());
+	}
+	const hvuint64_t expected(e.compute(buf.data(), buf.size()));
+	for (std::size_t cut = 0u; cut <= buf.size(); cut += 97u) {
+		hvuint64_t reg(e.start());
+		reg = e.update(reg, buf.data(), cut);
+		reg = e.update(reg, buf.data() + cut, buf.size() - cut);
+		ASSERT_EQ(e.finalize(reg), expected);
+	}
+}
+
+TEST(CrcTest, BitVectorInput) {
+	const CrcEngine engines[] = { CrcEngine::getCrc32(),
+			CrcEngine::getCrc16CcittFalse(), CrcEngine(12u, 0x80Fu, 0u, false,
+					true, 0u), CrcEngine(5u, 0x05u, 0x1Fu, true, true, 0x1Fu) };
+	for (const CrcEngine &e : engines) {
+		for (unsigned int size = 1u; size <= 300u; size++) {
+			BitVector bv(size, 0u);
+			bv.rand();
+			std::vector<hvuint8_t> bytes((size + 7u) / 8u, 0u);
+			for (unsigned int i = 0u; i < size; i++) {
+				bytes[i / 8u] |= static_cast<hvuint8_t>(bv[i]) << (i % 8u);
+			}
+			ASSERT_EQ(e.compute(bv), refCrc(e, bytes.data(), size))<< "size = " << size;
+			if (size % 8u == 0u) {
+				ASSERT_EQ(e.compute(bv), e.compute(bytes.data(), bytes.size()));
+			}
+		}
+	}
+
+	// Sub-vector
+	BitVector bv(std::string("0000000011111111101010100000000011110000"));
+	BitVector expected(std::string("1111111110101010"));
+	const CrcEngine &e(CrcEngine::getCrc32c());
+	ASSERT_EQ(e.compute(bv(31, 16)), e.compute(expected));
+}
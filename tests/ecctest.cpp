@@ -0,0 +1,184 @@
+/**
+ * @file ecctest.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Tests for ecc.h
+ */
+
+#include <cstring>
+#include <vector>
+#include "gtest/gtest.h"
+#include "ecc.h"
+#include "random.h"
+
+using namespace ::hv::common;
+
+TEST(EccTest, CheckWidth) {
+	ASSERT_EQ(Secded(8u).getCheckWidth(), 5u);
+	ASSERT_EQ(Secded(32u).getCheckWidth(), 7u);
+	ASSERT_EQ(Secded(64u).getCheckWidth(), 8u);
+	ASSERT_EQ(Secded(128u).getCheckWidth(), 9u);
+	ASSERT_EQ(Secded(1u).getCheckWidth(), 3u);
+}
+
+TEST(EccTest, ReferenceEncoding) {
+	// Hamming(72,64): check bit j covers data bits whose position has bit j set
+	const Secded ecc(64u);
+	RandomEngine rng(32u);
+	for (unsigned int n = 0u; n < 1000u; n++) {
+		const hvuint64_t data(rng());
+		hvuint32_t expected(0u);
+		bool p(false);
+		for (unsigned int i = 0u; i < 64u; i++) {
+			if ((data >> i) & 1u) {
+				unsigned int pos(0u);
+				for (pos = 1u; ecc.getDataIndex(pos) != static_cast<int>(i);
+						pos++) {
+				}
+				expected ^= pos;
+				p = !p;
+			}
+		}
+		p ^= parity(expected);
+		expected |= static_cast<hvuint32_t>(p) << 7;
+		ASSERT_EQ(ecc.encode(&data), expected);
+	}
+}
+
+TEST(EccTest, SingleAndDoubleErrors) {
+	const unsigned int widths[] = { 1u, 8u, 13u, 32u, 64u, 100u, 128u, 256u };
+	RandomEngine rng(33u);
+	for (const unsigned int width : widths) {
+		const Secded ecc(width);
+		const unsigned int nCheck(ecc.getCheckWidth());
+		const unsigned int nWords64((width - 1u) / 64u + 1u);
+		for (unsigned int n = 0u; n < 20u; n++) {
+			std::vector<hvuint64_t> data(nWords64);
+			for (auto &w : data) {
+				w = rng();
+			}
+			const hvuint32_t check(ecc.encode(data.data()));
+			std::vector<hvuint64_t> tmp(data);
+			hvuint32_t tmpCheck(check);
+			ASSERT_EQ(ecc.decode(tmp.data(), tmpCheck), ECC_OK);
+
+			// Bits beyond the data width are ignored
+			if (width % 64u) {
+				tmp[nWords64 - 1u] ^= HV_BIT_MASK_GEN(hvuint64_t, 63u);
+				ASSERT_EQ(ecc.encode(tmp.data()), check);
+				ASSERT_EQ(ecc.decode(tmp.data(), tmpCheck), ECC_OK);
+				tmp = data;
+			}
+
+			// Every single-bit error is corrected, every double-bit error is
+			// detected
+			const unsigned int nBits(width + nCheck);
+			for (unsigned int i = 0u; i < nBits; i++) {
+				for (unsigned int j = i; j < nBits; j++) {
+					tmp = data;
+					tmpCheck = check;
+					for (const unsigned int k : { i, j }) {
+						if (k < width) {
+							tmp[k / 64u] ^= HV_BIT_MASK_GEN(hvuint64_t, k % 64u);
+						} else {
+							tmpCheck ^= HV_BIT_MASK_GEN(hvuint32_t, k - width);
+						}
+						if (i == j) {
+							break;
+						}
+					}
+					if (i == j) {
+						ASSERT_EQ(ecc.decode(tmp.data(), tmpCheck), ECC_CORRECTED);
+						ASSERT_TRUE(tmp == data);
+						ASSERT_EQ(tmpCheck, check);
+					} else {
+						ASSERT_EQ(ecc.decode(tmp.data(), tmpCheck),
+								ECC_UNCORRECTABLE)<< "width = " << width << ", bits " << i << " and " << j;
+					}
+				}
+				if (width > 64u) {
+					i += 7u;
+				}
+			}
+		}
+	}
+}
+
+TEST(EccTest, BitVectorInterface) {
+	const Secded ecc(128u);
+	for (unsigned int n = 0u; n < 100u; n++) {
+		BitVector data(128u, 0u);
+		data.rand();
+		const BitVector ref(data);
+		BitVector check(ecc.encode(data));
+		ASSERT_EQ(check.getSize(), 9u);
+		const BitVector refCheck(check);
+		ASSERT_EQ(ecc.decode(data, check), ECC_OK);
+
+		const unsigned int i(n % 128u);
+		data[i] = !data[i];
+		ASSERT_EQ(ecc.decode(data, check), ECC_CORRECTED);
+		ASSERT_TRUE(data == ref);
+
+		check[n % 9u] = !check[n % 9u];
+		ASSERT_EQ(ecc.decode(data, check), ECC_CORRECTED);
+		ASSERT_TRUE(check == refCheck);
+
+		data[i] = !data[i];
+		data[(i + 1u) % 128u] = !data[(i + 1u) % 128u];
+		ASSERT_EQ(ecc.decode(data, check), ECC_UNCORRECTABLE);
+	}
+
+	// Data word held in a slice of a larger vector
+	BitVector line(256u, 0u);
+	line.rand();
+	const BitVector refLine(line);
+	BitVector check(ecc.encode(line(191, 64)));
+	line[100] = !line[100];
+	BitVector slice(line(191, 64));
+	ASSERT_EQ(ecc.decode(slice, check), ECC_CORRECTED);
+	ASSERT_TRUE(line == refLine);
+}
+
+TEST(EccTest, Batch) {
+	const Secded ecc64(64u), ecc128(128u), ecc72(72u);
+	const Secded *eccs[] = { &ecc64, &ecc128, &ecc72 };
+	RandomEngine rng(34u);
+	for (const Secded *ecc : eccs) {
+		const std::size_t N_WORDS(100u);
+		const std::size_t nBytes(ecc->getDataWidth() / 8u);
+		std::vector<hvuint8_t> buf(N_WORDS * nBytes);
+		for (auto &b : buf) {
+			b = static_cast<hvuint8_t>(rng());
+		}
+		const std::vector<hvuint8_t> ref(buf);
+		std::vector<hvuint32_t> checks(N_WORDS);
+		ecc->encode(buf.data(), N_WORDS, checks.data());
+
+		hvuint64_t words[2] = { 0u, 0u };
+		std::memcpy(words, &buf[nBytes * 42u], nBytes);
+		ASSERT_EQ(checks[42], ecc->encode(words));
+
+		std::vector<hveccstatus_t> status(N_WORDS);
+		ASSERT_EQ(ecc->decode(buf.data(), N_WORDS, checks.data()), ECC_OK);
+
+		buf[nBytes * 3u] ^= 0x10u;
+		buf[nBytes * 7u + 1u] ^= 0x01u;
+		checks[8] ^= 0x2u;
+		ASSERT_EQ(ecc->decode(buf.data(), N_WORDS, checks.data(), status.data()),
+				ECC_CORRECTED);
+		ASSERT_TRUE(buf == ref);
+		ASSERT_EQ(status[3], ECC_CORRECTED);
+		ASSERT_EQ(status[7], ECC_CORRECTED);
+		ASSERT_EQ(status[8], ECC_CORRECTED);
+		ASSERT_EQ(status[4], ECC_OK);
+
+		buf[nBytes * 5u] ^= 0x03u;
+		ASSERT_EQ(ecc->decode(buf.data(), N_WORDS, checks.data(), status.data()),
+				ECC_UNCORRECTABLE);
+		ASSERT_EQ(status[5], ECC_UNCORRECTABLE);
+		ASSERT_NE(buf, ref);
+	}
+}
@@ -0,0 +1,387 @@
+/**
+ * @file fixedpointtest.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Tests for fixedpoint.h
+ */
+
+#include <cmath>
+#include <limits>
+#include "gtest/gtest.h"
+#include "fixedpoint.h"
+#include "random.h"
+
+using namespace ::hv::common;
+
+#ifdef HV_HAS_INT128
+
+namespace {
+
+const hvfxquant_t QUANT_MODES[] = { FX_RND, FX_RND_ZERO, FX_RND_MIN_INF,
+		FX_RND_INF, FX_RND_CONV, FX_TRN, FX_TRN_ZERO };
+const hvfxoverflow_t OVERFLOW_MODES[] = { FX_SAT, FX_SAT_ZERO, FX_SAT_SYM,
+		FX_WRAP };
+
+unsigned int draw(RandomEngine &rng, const unsigned int &n) {
+	return static_cast<unsigned int>(rng() % n);
+}
+
+hvint128_t floorDiv(const hvint128_t &n, const hvint128_t &d) {
+	hvint128_t q(n / d);
+	if ((n % d) && ((n < 0) != (d < 0))) {
+		q--;
+	}
+	return q;
+}
+
+/**
+ * Reference cast of the rational n / d (d > 0), expressed in units of the
+ * format LSB, into a format
+ */
+hvint128_t refCast(const hvint128_t &n, const hvint128_t &d,
+		const FixedPointFormat &format) {
+	hvint128_t q(floorDiv(n, d));
+	const hvint128_t r2(2 * (n - q * d));
+	bool up(false);
+	switch (format.getQuant()) {
+	case FX_RND:
+		up = r2 >= d;
+		break;
+	case FX_RND_ZERO:
+		up = (r2 > d) || ((r2 == d) && (n < 0));
+		break;
+	case FX_RND_MIN_INF:
+		up = r2 > d;
+		break;
+	case FX_RND_INF:
+		up = (r2 > d) || ((r2 == d) && (n >= 0));
+		break;
+	case FX_RND_CONV:
+		up = (r2 > d) || ((r2 == d) && (q & 1));
+		break;
+	case FX_TRN:
+		break;
+	case FX_TRN_ZERO:
+		up = (n < 0) && r2;
+		break;
+	}
+	q += up;
+	const unsigned int w(format.getWidth());
+	const hvint128_t minRaw(
+			format.isSigned() ? -(static_cast<hvint128_t>(1) << (w - 1u)) : 0);
+	const hvint128_t maxRaw(
+			(static_cast<hvint128_t>(1) << (format.isSigned() ? w - 1u : w)) - 1);
+	if (q >= minRaw && q <= maxRaw) {
+		return q;
+	}
+	switch (format.getOverflow()) {
+	case FX_SAT:
+		return n < 0 ? minRaw : maxRaw;
+	case FX_SAT_ZERO:
+		return 0;
+	case FX_SAT_SYM:
+		return n < 0 ? (format.isSigned() ? -maxRaw : 0) : maxRaw;
+	default:
+		break;
+	}
+	const hvint128_t m(static_cast<hvint128_t>(1) << w);
+	q = ((q % m) + m) % m;
+	if (format.isSigned() && q > maxRaw) {
+		q -= m;
+	}
+	return q;
+}
+
+/**
+ * Reference cast of raw * 2^-frac into a format
+ */
+hvint128_t refCastScaled(const hvint128_t &raw, const int &frac,
+		const FixedPointFormat &format) {
+	const int s(format.getFracWidth() - frac);
+	return s >= 0 ?
+			refCast(raw * (static_cast<hvint128_t>(1) << s), 1, format) :
+			refCast(raw, static_cast<hvint128_t>(1) << -s, format);
+}
+
+/**
+ * Value of a FixedPoint of at most 127 bits, times 2^fracWidth
+ */
+hvint128_t rawOf(const FixedPoint &x) {
+	const BitVector bits(x.getBits());
+	const unsigned int w(x.getFormat().getWidth());
+	hvuint128_t r(0u);
+	for (unsigned int i = 0u; i < bits.getArraySize(); i++) {
+		r |= static_cast<hvuint128_t>(bits.getDataAddress()[i])
+				<< (BITWIDTH_OF(BitVector::bvdata_t) * i);
+	}
+	if (w < 128u) {
+		r &= (static_cast<hvuint128_t>(1u) << w) - 1u;
+		if (x.getFormat().isSigned() && ((r >> (w - 1u)) & 1u)) {
+			r |= ~((static_cast<hvuint128_t>(1u) << w) - 1u);
+		}
+	}
+	return static_cast<hvint128_t>(r);
+}
+
+/**
+ * Random FixedPoint value
+ */
+void setRandom(RandomEngine &rng, FixedPoint &x) {
+	const hvuint128_t r(
+			(static_cast<hvuint128_t>(rng()) << 64u) | static_cast<hvuint64_t>(rng()));
+	x.setBits(BitVector(static_cast<BitVector::bvsize_t>(x.getFormat().getWidth()),
+			r));
+}
+
+} // namespace
+
+TEST(FixedPointTest, SystemCExamples) {
+	// sc_fixed<8, 4> values: LSB 1/16, range [-8, 7.9375]
+	const double inputs[] = { 3.03125, -3.03125, 2.96875, -2.96875, 3.09375 };
+	const double expected[][5] = {
+			{ 3.0625, -3.0, 3.0, -2.9375, 3.125 },   // SC_RND
+			{ 3.0, -3.0, 2.9375, -2.9375, 3.0625 },  // SC_RND_ZERO
+			{ 3.0, -3.0625, 2.9375, -3.0, 3.0625 },  // SC_RND_MIN_INF
+			{ 3.0625, -3.0625, 3.0, -3.0, 3.125 },   // SC_RND_INF
+			{ 3.0, -3.0, 3.0, -3.0, 3.125 },         // SC_RND_CONV
+			{ 3.0, -3.0625, 2.9375, -3.0, 3.0625 },  // SC_TRN
+			{ 3.0, -3.0, 2.9375, -2.9375, 3.0625 } };// SC_TRN_ZERO
+	for (unsigned int q = 0u; q < 7u; q++) {
+		const FixedPointFormat fmt(8u, 4, true, QUANT_MODES[q], FX_SAT);
+		for (unsigned int i = 0u; i < 5u; i++) {
+			ASSERT_EQ(FixedPoint(fmt, inputs[i]).toDouble(), expected[q][i])<< "mode " << q << ", input " << inputs[i];
+		}
+	}
+
+	ASSERT_EQ(FixedPoint(FixedPointFormat(8u, 4, true, FX_TRN, FX_SAT), 10.0).toDouble(), 7.9375);
+	ASSERT_EQ(FixedPoint(FixedPointFormat(8u, 4, true, FX_TRN, FX_SAT), -10.0).toDouble(), -8.0);
+	ASSERT_EQ(FixedPoint(FixedPointFormat(8u, 4, true, FX_TRN, FX_SAT_SYM), -10.0).toDouble(), -7.9375);
+	ASSERT_EQ(FixedPoint(FixedPointFormat(8u, 4, true, FX_TRN, FX_SAT_ZERO), 10.0).toDouble(), 0.0);
+	ASSERT_EQ(FixedPoint(FixedPointFormat(8u, 4, true, FX_TRN, FX_WRAP), 10.0).toDouble(), -6.0);
+	ASSERT_EQ(FixedPoint(FixedPointFormat(8u, 4, false, FX_TRN, FX_SAT), -1.0).toDouble(), 0.0);
+	ASSERT_EQ(FixedPoint(FixedPointFormat(8u, 4, false, FX_TRN, FX_WRAP), -1.0).toDouble(), 15.0);
+
+	// Extreme doubles
+	const FixedPointFormat q15(16u, 1, true, FX_RND_CONV, FX_SAT);
+	ASSERT_EQ(FixedPoint(q15, std::numeric_limits<double>::infinity()).getRaw(), 32767);
+	ASSERT_EQ(FixedPoint(q15, -1e300).getRaw(), -32768);
+	ASSERT_EQ(FixedPoint(q15, 1e-300).getRaw(), 0);
+	ASSERT_EQ(FixedPoint(FixedPointFormat(16u, 1, true, FX_RND_INF), -1e-300).getRaw(), 0);
+	ASSERT_EQ(FixedPoint(FixedPointFormat(16u, 1, true, FX_TRN), -1e-300).getRaw(), -1);
+}
+
+TEST(FixedPointTest, FullWidth) {
+	// 63-bit formats hold values up to 2^63 - 1 (unsigned)
+	const FixedPointFormat u63(63u, 1, false, FX_TRN, FX_SAT);
+	const FixedPoint u8(FixedPointFormat(8u, 8, false), 1.0);
+	FixedPoint x(u63, 1.0);
+	ASSERT_EQ(x.toDouble(), 1.0);
+	x = u8;
+	ASSERT_EQ(x.toDouble(), 1.0);
+	x.mul(u8, u8);
+	ASSERT_EQ(x.toDouble(), 1.0);
+	x.add(u8, FixedPoint(FixedPointFormat(8u, 1, false), 0.5));
+	ASSERT_EQ(x.toDouble(), 1.5);
+	ASSERT_EQ(FixedPoint(FixedPointFormat(63u, 1, false, FX_TRN, FX_SAT_ZERO), 1.0).toDouble(), 1.0);
+	ASSERT_EQ(FixedPoint(u63, 2.0).getRaw(), u63.getMaxRaw());
+	ASSERT_EQ(FixedPoint(FixedPointFormat(63u, 63, false), 9.0e18).getRaw(), 9000000000000000000);
+	ASSERT_EQ(FixedPoint(FixedPointFormat(63u, 63, true, FX_TRN, FX_SAT), 9.0e18).getRaw(),
+			FixedPointFormat(63u, 63).getMaxRaw());
+}
+
+TEST(FixedPointTest, Bits) {
+	const FixedPointFormat fmt(12u, 3, true, FX_RND, FX_SAT);
+	const FixedPoint x(fmt, -1.5);
+	ASSERT_EQ(x.getRaw(), -768);
+	ASSERT_EQ(x.getBits().getSize(), 12u);
+	ASSERT_EQ(static_cast<hvuint32_t>(x.getBits()), 0xD00u);
+	const FixedPoint y(fmt, x.getBits());
+	ASSERT_TRUE(x == y);
+	FixedPoint z(fmt);
+	z.setRaw(0x1FFF); // Wrapped to 12 bits
+	ASSERT_EQ(z.getRaw(), -1);
+	ASSERT_EQ(z.getBits().toString(), std::string("111111111111"));
+}
+
+TEST(FixedPointTest, RandomAgainstReference) {
+	RandomEngine rng(12345u);
+	for (unsigned int iter = 0u; iter < 20000u; iter++) {
+		// Small operand formats so that the reference fits in 128-bit integers,
+		// and full-width destinations
+		const unsigned int wa(1u + draw(rng, 14u)), wb(1u + draw(rng, 14u)), wd(
+				draw(rng, 4u) ? 1u + draw(rng, 14u) : 63u);
+		const FixedPointFormat fa(wa, static_cast<int>(draw(rng, 17u)) - 4,
+				draw(rng, 2u));
+		const FixedPointFormat fb(wb, static_cast<int>(draw(rng, 17u)) - 4,
+				draw(rng, 2u));
+		const FixedPointFormat fd(wd, static_cast<int>(draw(rng, 17u)) - 4,
+				draw(rng, 2u), QUANT_MODES[draw(rng, 7u)],
+				OVERFLOW_MODES[draw(rng, 4u)]);
+		FixedPoint a(fa), b(fb), d(fd);
+		a.setRaw(static_cast<hvint64_t>(rng() >> 32));
+		b.setRaw(static_cast<hvint64_t>(rng() >> 32));
+		const hvint64_t ra(a.getRaw()), rb(b.getRaw());
+		const int fra(fa.getFracWidth()), frb(fb.getFracWidth());
+		const int f(fra > frb ? fra : frb);
+		const hvint64_t aa(ra * (static_cast<hvint64_t>(1) << (f - fra)));
+		const hvint64_t bb(rb * (static_cast<hvint64_t>(1) << (f - frb)));
+
+		d = a;
+		ASSERT_EQ(d.getRaw(), refCastScaled(ra, fra, fd));
+		d.add(a, b);
+		ASSERT_EQ(d.getRaw(), refCastScaled(aa + bb, f, fd));
+		d.sub(a, b);
+		ASSERT_EQ(d.getRaw(), refCastScaled(aa - bb, f, fd));
+		d.mul(a, b);
+		ASSERT_EQ(d.getRaw(), refCastScaled(ra * rb, fra + frb, fd));
+		d.neg(a);
+		ASSERT_EQ(d.getRaw(), refCastScaled(-ra, fra, fd));
+		if (rb) {
+			// a / b in units of the destination LSB: ra * 2^(fd - fa + fb) / rb
+			const int s(fd.getFracWidth() - fra + frb);
+			hvint128_t n(s >= 0 ? ra * (static_cast<hvint128_t>(1) << s) : ra);
+			hvint128_t den(s >= 0 ? rb : rb * (static_cast<hvint128_t>(1) << -s));
+			if (den < 0) {
+				n = -n;
+				den = -den;
+			}
+			d.div(a, b);
+			ASSERT_EQ(d.getRaw(), refCast(n, den, fd));
+		}
+
+		ASSERT_EQ(a < b, aa < bb);
+		ASSERT_EQ(a == b, aa == bb);
+		ASSERT_EQ(a >= b, aa >= bb);
+		ASSERT_EQ(a.toDouble(), std::ldexp(static_cast<double>(ra), -fra));
+	}
+}
+
+TEST(FixedPointTest, WideRandomAgainstReference) {
+	RandomEngine rng(54321u);
+	for (unsigned int iter = 0u; iter < 20000u; iter++) {
+		// Formats across the narrow width, with fractional widths small enough
+		// for the reference to fit in 128-bit integers
+		const unsigned int wa(1u + draw(rng, 90u)), wb(1u + draw(rng, 90u)), wd(
+				1u + draw(rng, 120u));
+		const FixedPointFormat fa(wa,
+				static_cast<int>(wa) - 8 + static_cast<int>(draw(rng, 17u)),
+				draw(rng, 2u));
+		const FixedPointFormat fb(wb,
+				static_cast<int>(wb) - 8 + static_cast<int>(draw(rng, 17u)),
+				draw(rng, 2u));
+		const FixedPointFormat fd(wd,
+				static_cast<int>(wd) - 8 + static_cast<int>(draw(rng, 17u)),
+				draw(rng, 2u), QUANT_MODES[draw(rng, 7u)],
+				OVERFLOW_MODES[draw(rng, 4u)]);
+		FixedPoint a(fa), b(fb), d(fd);
+		setRandom(rng, a);
+		setRandom(rng, b);
+		const hvint128_t ra(rawOf(a)), rb(rawOf(b));
+		const int fra(fa.getFracWidth()), frb(fb.getFracWidth());
+		const int f(fra > frb ? fra : frb);
+		const hvint128_t aa(ra * (static_cast<hvint128_t>(1) << (f - fra)));
+		const hvint128_t bb(rb * (static_cast<hvint128_t>(1) << (f - frb)));
+
+		d = a;
+		ASSERT_EQ(rawOf(d), refCastScaled(ra, fra, fd));
+		d.add(a, b);
+		ASSERT_EQ(rawOf(d), refCastScaled(aa + bb, f, fd));
+		d.sub(a, b);
+		ASSERT_EQ(rawOf(d), refCastScaled(aa - bb, f, fd));
+		d.neg(a);
+		ASSERT_EQ(rawOf(d), refCastScaled(-ra, fra, fd));
+		if (wa + wb <= 100u) {
+			d.mul(a, b);
+			ASSERT_EQ(rawOf(d), refCastScaled(ra * rb, fra + frb, fd));
+			if (rb) {
+				const int s(fd.getFracWidth() - fra + frb);
+				hvint128_t n(s >= 0 ? ra * (static_cast<hvint128_t>(1) << s) : ra);
+				hvint128_t den(
+						s >= 0 ? rb : rb * (static_cast<hvint128_t>(1) << -s));
+				if (den < 0) {
+					n = -n;
+					den = -den;
+				}
+				d.div(a, b);
+				ASSERT_EQ(rawOf(d), refCast(n, den, fd));
+			}
+		}
+
+		ASSERT_EQ(a < b, aa < bb);
+		ASSERT_EQ(a == b, aa == bb);
+		ASSERT_EQ(a >= b, aa >= bb);
+		ASSERT_DOUBLE_EQ(a.toDouble(), std::ldexp(static_cast<double>(ra), -fra));
+	}
+}
+
+TEST(FixedPointTest, WideFormats) {
+	// 64 Q1.31 products accumulated on 72 bits, rounded to Q1.31
+	const FixedPointFormat q31(32u, 1);
+	const FixedPointFormat accFmt(72u, 10);
+	const FixedPointFormat outFmt(32u, 1, true, FX_RND, FX_SAT);
+	RandomEngine rng(7u);
+	FixedPoint acc(accFmt, 0.0), prod(accFmt), x(q31), h(q31), y(outFmt);
+	hvint128_t ref(0);
+	for (unsigned int i = 0u; i < 64u; i++) {
+		x.setRaw(static_cast<hvint32_t>(rng()));
+		h.setRaw(static_cast<hvint32_t>(rng()));
+		prod.mul(x, h);
+		acc += prod;
+		ref += static_cast<hvint128_t>(x.getRaw()) * h.getRaw();
+	}
+	ASSERT_EQ(rawOf(acc), ref);
+	y = acc;
+	ASSERT_EQ(rawOf(y), refCastScaled(ref, 62, outFmt));
+
+	// 200-bit values: LSB 2^-80, range [-2^119, 2^119)
+	const FixedPointFormat big(200u, 120);
+	const FixedPoint p100(big, std::ldexp(1.0, 100));
+	FixedPoint z(p100), lsb(big);
+	lsb.setRaw(1);
+	ASSERT_EQ(z.getBits().getSize(), 200u);
+	z += lsb;
+	ASSERT_TRUE(z > p100);
+	ASSERT_TRUE(z != p100);
+	z -= lsb;
+	ASSERT_TRUE(z == p100);
+	ASSERT_EQ(z.toDouble(), std::ldexp(1.0, 100));
+	z.neg(lsb);
+	ASSERT_EQ(z.toDouble(), -std::ldexp(1.0, -80));
+	ASSERT_EQ(FixedPoint(big, std::ldexp(1.0, 119)).toDouble(), -std::ldexp(1.0, 119));
+	const FixedPointFormat bigSat(200u, 120, true, FX_TRN, FX_SAT);
+	ASSERT_EQ(FixedPoint(bigSat, 1e300).toDouble(), std::ldexp(1.0, 119));
+	ASSERT_EQ(FixedPoint(bigSat, -std::numeric_limits<double>::infinity()).toDouble(), -std::ldexp(1.0, 119));
+	z.div(FixedPoint(big, 1.0), FixedPoint(big, 3.0));
+	ASSERT_DOUBLE_EQ(z.toDouble(), 1.0 / 3.0);
+	z.mul(z, FixedPoint(q31, 0.75));
+	ASSERT_DOUBLE_EQ(z.toDouble(), 0.25);
+
+	// Narrow destination from wide operands
+	FixedPoint q(FixedPointFormat(16u, 1, true, FX_RND, FX_SAT));
+	z = p100;
+	z += FixedPoint(q31, 0.25);
+	q.sub(z, p100);
+	ASSERT_EQ(q.toDouble(), 0.25);
+}
+
+TEST(FixedPointTest, CompoundOperators) {
+	// Q1.15 accumulation with rounding and saturation
+	const FixedPointFormat q15(16u, 1, true, FX_RND, FX_SAT);
+	FixedPoint acc(q15, 0.5), c(q15, 0.25);
+	acc += c;
+	ASSERT_EQ(acc.toDouble(), 0.75);
+	acc += c;
+	ASSERT_EQ(acc.getRaw(), 32767);
+	acc *= c;
+	ASSERT_EQ(acc.getRaw(), 8192); // 32767 / 4 rounded
+	acc -= FixedPoint(q15, 0.75);
+	ASSERT_EQ(acc.toDouble(), -0.5);
+	acc /= FixedPoint(FixedPointFormat(8u, 4), 3.0);
+	ASSERT_EQ(acc.getRaw(), -5461); // -0.1666.. * 32768 rounded
+	ASSERT_TRUE(acc < c);
+	ASSERT_TRUE(FixedPoint(q15, 0.25) == FixedPoint(FixedPointFormat(8u, 4), 0.25));
+}
+
+#endif // HV_HAS_INT128
@@ -9,9 +9,12 @@
 #include "gtest/gtest.h"
 #include <ctime>
 #include <systemc>
+#include "random.h"
 
 int sc_main(int argc, char* argv[]) {
-	::std::srand(std::time(NULL));
+	const unsigned int seed(static_cast<unsigned int>(std::time(NULL)));
+	::std::srand(seed);
+	::hv::common::RandomEngine::getThreadEngine().seed(seed);
 	::testing::InitGoogleTest(&argc, argv);
 	return RUN_ALL_TESTS();
 }
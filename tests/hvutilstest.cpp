@@ -37,6 +37,24 @@ TEST(hvutilstest, superiorPowerOf2Test) {
 	ASSERT_EQ(superiorPowerOf2(17), 32);
 }
 
+TEST(hvutilstest, bitCountingTest) {
+	ASSERT_EQ(popCount(0u), 0u);
+	ASSERT_EQ(popCount(~static_cast<hvuint64_t>(0u)), 64u);
+	ASSERT_EQ(popCount(0x8000000000000001ULL), 2u);
+	ASSERT_FALSE(parity(0x8000000000000001ULL));
+	ASSERT_TRUE(parity(0x0700000000000000ULL));
+	ASSERT_EQ(countTrailingZeros(0u), 64u);
+	ASSERT_EQ(countLeadingZeros(0u), 64u);
+	for (unsigned int i = 0u; i < 64u; i++) {
+		const hvuint64_t bit(static_cast<hvuint64_t>(1u) << i);
+		ASSERT_EQ(countTrailingZeros(bit), i);
+		ASSERT_EQ(countLeadingZeros(bit), 63u - i);
+		ASSERT_EQ(countTrailingZeros(bit | (bit << 1)), i);
+		ASSERT_EQ(countLeadingZeros(bit | 1u), 63u - i);
+		ASSERT_EQ(popCount(bit - 1u), i);
+	}
+}
+
 TEST(hvutilstest, hvRWModePackUnpackTest) {
 	::cci::cci_value mRWModeCCI;
 	hvrwmode_t mRWMode;
@@ -0,0 +1,134 @@
+/**
+ * @file lfsrtest.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Tests for lfsr.h
+ */
+
+#include <vector>
+#include "gtest/gtest.h"
+#include "lfsr.h"
+
+using namespace ::hv::common;
+
+/**
+ * Reference bit-serial PRBS: b[k] = b[k - order] ^ b[k - tap]
+ */
+static std::vector<bool> refPrbs(const unsigned int &order,
+		const unsigned int &tap, const std::size_t &n) {
+	std::vector<bool> ret(order, true);
+	while (ret.size() < n) {
+		const std::size_t k(ret.size());
+		ret.push_back(ret[k - order] != ret[k - tap]);
+	}
+	ret.resize(n);
+	return ret;
+}
+
+static bool getBit(const std::vector<hvuint64_t> &words, const std::size_t &i) {
+	return (words[i / 64u] >> (i % 64u)) & 1u;
+}
+
+TEST(LfsrTest, PrbsSequences) {
+	const unsigned int orders[][2] = { { 7u, 6u }, { 9u, 5u }, { 11u, 9u }, {
+			15u, 14u }, { 20u, 3u }, { 23u, 18u }, { 31u, 28u } };
+	for (const auto &o : orders) {
+		const std::size_t N(5000u);
+		const std::vector<bool> ref(refPrbs(o[0], o[1], N));
+		Lfsr serial(Lfsr::prbs(o[0])), parallel(Lfsr::prbs(o[0]));
+		std::vector<hvuint64_t> buf((N + 63u) / 64u);
+		parallel.generate(buf.data(), N);
+		for (std::size_t i = 0u; i < N; i++) {
+			ASSERT_EQ(serial.step(), ref[i])<< "PRBS" << o[0] << ", bit " << i;
+			ASSERT_EQ(getBit(buf, i), ref[i])<< "PRBS" << o[0] << ", bit " << i;
+		}
+		ASSERT_TRUE(serial.getState() == parallel.getState());
+		ASSERT_EQ(buf.back() >> (N % 64u), 0u);
+	}
+
+	// Period and balance of PRBS7
+	Lfsr prbs7(Lfsr::prbs(7u));
+	const BitVector start(prbs7.getState());
+	unsigned int nOnes(0u);
+	for (unsigned int i = 0u; i < 127u; i++) {
+		nOnes += prbs7.step();
+		if (i < 126u) {
+			ASSERT_FALSE(prbs7.getState() == start);
+		}
+	}
+	ASSERT_TRUE(prbs7.getState() == start);
+	ASSERT_EQ(nOnes, 64u);
+}
+
+TEST(LfsrTest, ChunkedGeneration) {
+	const unsigned int sizes[] = { 1u, 3u, 64u, 65u, 100u, 129u, 1000u };
+	for (const unsigned int width : { 7u, 31u, 64u, 100u }) {
+		BitVector taps(width, false);
+		taps[width - 1u] = true;
+		taps[width / 3u] = true;
+		taps[0] = true;
+		BitVector seed(width, 0u);
+		seed.rand();
+		seed[0] = true;
+		Lfsr serial(taps, seed), chunked(taps, seed);
+		for (const unsigned int n : sizes) {
+			std::vector<hvuint64_t> buf((n + 63u) / 64u);
+			chunked.generate(buf.data(), n);
+			for (unsigned int i = 0u; i < n; i++) {
+				ASSERT_EQ(getBit(buf, i), serial.step())<< "width " << width << ", chunk " << n << ", bit " << i;
+			}
+			ASSERT_TRUE(serial.getState() == chunked.getState());
+		}
+		const BitVector bits(chunked.next(77u));
+		for (unsigned int i = 0u; i < 77u; i++) {
+			ASSERT_EQ(static_cast<bool>(bits[i]), serial.step());
+		}
+	}
+}
+
+TEST(LfsrTest, Advance) {
+	for (const unsigned int order : { 7u, 23u, 31u }) {
+		Lfsr serial(Lfsr::prbs(order)), jumped(Lfsr::prbs(order));
+		hvuint64_t total(0u);
+		for (const hvuint64_t n : { 0u, 1u, 5u, 64u, 127u, 1000u, 4097u }) {
+			for (hvuint64_t i = 0u; i < n; i++) {
+				serial.step();
+			}
+			jumped.advance(n);
+			total += n;
+			ASSERT_TRUE(serial.getState() == jumped.getState())<< "PRBS" << order << ", " << total << " steps";
+		}
+	}
+
+	// Full period
+	Lfsr prbs23(Lfsr::prbs(23u));
+	const BitVector start(prbs23.getState());
+	prbs23.advance((1u << 23) - 1u);
+	ASSERT_TRUE(prbs23.getState() == start);
+	prbs23.advance(3ULL * ((1u << 23) - 1u) + 2u);
+	Lfsr ref(Lfsr::prbs(23u));
+	ref.step();
+	ref.step();
+	ASSERT_TRUE(prbs23.getState() == ref.getState());
+}
+
+TEST(LfsrTest, Galois) {
+	// Reference Galois register: out = g[0], g = (g >> 1) ^ (out ? taps : 0)
+	const hvuint64_t TAPS(0x00000000C0000401ULL); // x^32 + x^31 + x^11 + x
+	BitVector taps(32u, static_cast<hvuint32_t>(TAPS));
+	hvuint64_t g(0x12345678u);
+	Lfsr lfsr(taps, BitVector(32u, static_cast<hvuint32_t>(g)), LFSR_GALOIS);
+	ASSERT_EQ(static_cast<hvuint32_t>(lfsr.getState()), 0x12345678u);
+	std::vector<hvuint64_t> buf(16u);
+	lfsr.generate(buf.data(), 1000u);
+	for (unsigned int i = 0u; i < 1000u; i++) {
+		const bool out(g & 1u);
+		g = (g >> 1) ^ (out ? TAPS : 0u);
+		ASSERT_EQ(getBit(buf, i), out)<< "bit " << i;
+	}
+	ASSERT_EQ(static_cast<hvuint32_t>(lfsr.getState()),
+			static_cast<hvuint32_t>(g));
+	ASSERT_TRUE(lfsr.getTaps() == taps);
+}
@@ -15,6 +15,7 @@ template<typename T> class HVLogTest: public ::testing::Test {
 };
 
 TEST(HVLogText, generalTest) {
+	const hv::common::log::LogLevel previous(hv::common::getLogLevel());
 	hv::common::setLogLevel(hv::common::log::debug);
 	HV_LOG_CRITICAL("This is a critical error log");
 	HV_LOG_ERROR("This is an error log");
@@ -23,6 +24,11 @@ TEST(HVLogText, generalTest) {
 	HV_LOG_DEBUG("This is a debug log");
 	HV_LOG_TRACE("This is a trace log");
 
+	ASSERT_EQ(hv::common::getLogLevel(), hv::common::log::debug);
+	hv::common::setLogLevel(hv::common::log::error);
+	ASSERT_EQ(hv::common::getLogLevel(), hv::common::log::error);
+	hv::common::setLogLevel(previous);
+
 	// FIXME
 	// hv::common::setLogLevel(hv::common::log::trace);
 	// hv::common::setLogFile("output.log");
@@ -0,0 +1,160 @@
+/**
+ * @file logicvectortest.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Tests for logicvector.h
+ *
+ * Word-parallel operators are checked against per-bit reference truth tables
+ * on random four-state vectors.
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include "gtest/gtest.h"
+#include "logicvector.h"
+#include "hvutils.h"
+
+using namespace ::hv::common;
+
+/**
+ * Reference per-bit truth tables (rows/columns: 0, 1, Z, X)
+ */
+static const hvlogic_t REF_AND[4][4] = {
+		{ LOGIC_0, LOGIC_0, LOGIC_0, LOGIC_0 },
+		{ LOGIC_0, LOGIC_1, LOGIC_X, LOGIC_X },
+		{ LOGIC_0, LOGIC_X, LOGIC_X, LOGIC_X },
+		{ LOGIC_0, LOGIC_X, LOGIC_X, LOGIC_X } };
+static const hvlogic_t REF_OR[4][4] = {
+		{ LOGIC_0, LOGIC_1, LOGIC_X, LOGIC_X },
+		{ LOGIC_1, LOGIC_1, LOGIC_1, LOGIC_1 },
+		{ LOGIC_X, LOGIC_1, LOGIC_X, LOGIC_X },
+		{ LOGIC_X, LOGIC_1, LOGIC_X, LOGIC_X } };
+static const hvlogic_t REF_XOR[4][4] = {
+		{ LOGIC_0, LOGIC_1, LOGIC_X, LOGIC_X },
+		{ LOGIC_1, LOGIC_0, LOGIC_X, LOGIC_X },
+		{ LOGIC_X, LOGIC_X, LOGIC_X, LOGIC_X },
+		{ LOGIC_X, LOGIC_X, LOGIC_X, LOGIC_X } };
+static const hvlogic_t REF_RESOLVE[4][4] = {
+		{ LOGIC_0, LOGIC_X, LOGIC_0, LOGIC_X },
+		{ LOGIC_X, LOGIC_1, LOGIC_1, LOGIC_X },
+		{ LOGIC_0, LOGIC_1, LOGIC_Z, LOGIC_X },
+		{ LOGIC_X, LOGIC_X, LOGIC_X, LOGIC_X } };
+static const hvlogic_t REF_NOT[4] = { LOGIC_1, LOGIC_0, LOGIC_X, LOGIC_X };
+
+class LogicVectorTest: public ::testing::Test {
+protected:
+	virtual void SetUp() {
+		nTests = 100;
+		maxSize = 130;
+	}
+
+	virtual void TearDown() {
+	}
+
+	static LogicVector randLogicVector(const LogicVector::bvsize_t &size) {
+		LogicVector ret(size, LOGIC_0);
+		for (LogicVector::bvsize_t i = 0u; i < size; i++) {
+			ret.set(i, static_cast<hvlogic_t>(std::rand() % 4));
+		}
+		return ret;
+	}
+
+	hvuint32_t nTests;
+	LogicVector::bvsize_t maxSize;
+};
+
+TEST_F(LogicVectorTest, ConstructorsAndAccessors) {
+	LogicVector lv1(70u, LOGIC_X);
+	ASSERT_EQ(lv1.getSize(), 70u);
+	for (auto i = 0u; i < 70u; i++) {
+		ASSERT_EQ(lv1.get(i), LOGIC_X);
+	}
+	ASSERT_FALSE(lv1.isFullyKnown());
+
+	LogicVector lv2(std::string("01ZX10"));
+	ASSERT_EQ(lv2.getSize(), 6u);
+	ASSERT_EQ(lv2.toString(), "01ZX10");
+	ASSERT_EQ(lv2.get(0), LOGIC_0);
+	ASSERT_EQ(lv2.get(1), LOGIC_1);
+	ASSERT_EQ(lv2.get(2), LOGIC_X);
+	ASSERT_EQ(lv2.get(3), LOGIC_Z);
+	ASSERT_EQ(LogicVector(std::string("01zx")).toString(), "01ZX");
+
+	lv2.set(2, LOGIC_Z);
+	lv2.set(3, LOGIC_0);
+	ASSERT_EQ(lv2.toString(), "010Z10");
+
+	std::stringstream ss;
+	ss << lv2;
+	ASSERT_EQ(ss.str(), "010Z10");
+
+	LogicVector lv3(lv2);
+	ASSERT_TRUE(lv3 == lv2);
+	lv3.set(0, LOGIC_X);
+	ASSERT_TRUE(lv3 != lv2);
+	lv3 = lv2;
+	ASSERT_TRUE(lv3 == lv2);
+}
+
+TEST_F(LogicVectorTest, BitVectorConversion) {
+	for (LogicVector::bvsize_t size = 1u; size <= maxSize; size++) {
+		BitVector bv(size, 0u);
+		bv.rand();
+		LogicVector lv(bv);
+		ASSERT_TRUE(lv.isFullyKnown());
+		ASSERT_TRUE(lv.toBitVector() == bv);
+		ASSERT_EQ(lv.toString(), bv.toString());
+
+		BitVector unknown(size, 0u);
+		unknown.rand();
+		LogicVector lv2(bv, unknown);
+		ASSERT_EQ(lv2.isFullyKnown(), !unknown);
+		ASSERT_TRUE(lv2.toBitVector() == (bv & ~unknown));
+		ASSERT_TRUE(lv2.getValuePlane() == bv);
+		ASSERT_TRUE(lv2.getUnknownPlane() == unknown);
+
+		lv2 = bv;
+		ASSERT_TRUE(lv2.isFullyKnown());
+		ASSERT_TRUE(lv2.toBitVector() == bv);
+	}
+}
+
+TEST_F(LogicVectorTest, TruthTables) {
+	for (hvuint32_t n = 0u; n < nTests; n++) {
+		for (LogicVector::bvsize_t size = 1u; size <= maxSize; size += 7u) {
+			const LogicVector a(randLogicVector(size));
+			const LogicVector b(randLogicVector(size));
+			const LogicVector rAnd(a & b), rOr(a | b), rXor(a ^ b), rNot(~a);
+			const LogicVector rRes(a.resolve(b));
+			LogicVector cAnd(a), cOr(a), cXor(a);
+			cAnd &= b;
+			cOr |= b;
+			cXor ^= b;
+			ASSERT_TRUE(cAnd == rAnd);
+			ASSERT_TRUE(cOr == rOr);
+			ASSERT_TRUE(cXor == rXor);
+			for (LogicVector::bvsize_t i = 0u; i < size; i++) {
+				ASSERT_EQ(rAnd.get(i), REF_AND[a.get(i)][b.get(i)]);
+				ASSERT_EQ(rOr.get(i), REF_OR[a.get(i)][b.get(i)]);
+				ASSERT_EQ(rXor.get(i), REF_XOR[a.get(i)][b.get(i)]);
+				ASSERT_EQ(rRes.get(i), REF_RESOLVE[a.get(i)][b.get(i)]);
+				ASSERT_EQ(rNot.get(i), REF_NOT[a.get(i)]);
+			}
+		}
+	}
+}
+
+TEST_F(LogicVectorTest, MixedSizes) {
+	const LogicVector a(std::string("XZ10"));
+	const LogicVector b(std::string("1Z01X"));
+	ASSERT_EQ((a & b).toString(), "0X010");
+	ASSERT_EQ((a | b).toString(), "1XX1X");
+	ASSERT_EQ((a ^ b).toString(), "1XX0X");
+	// Missing bits of the smallest driver are undriven
+	ASSERT_EQ(a.resolve(b).toString(), "1X01X");
+	ASSERT_EQ(b.resolve(a).toString(), "1X01X");
+	ASSERT_EQ(LogicVector(std::string("Z")).resolve(b).toString(), "1Z01X");
+}
@@ -0,0 +1,181 @@
+/**
+ * @file packedlanestest.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Tests for packedlanes.h
+ */
+
+#include <algorithm>
+#include <type_traits>
+#include "gtest/gtest.h"
+#include "packedlanes.h"
+
+using namespace ::hv::common;
+
+template<typename T> class PackedLanesTypedTest: public ::testing::Test {
+};
+
+typedef ::testing::Types<hvuint8_t, hvuint16_t, hvuint32_t, hvuint64_t> LaneTypes;
+TYPED_TEST_SUITE(PackedLanesTypedTest, LaneTypes);
+
+namespace {
+
+/**
+ * Reference lane read through BitVector slicing
+ */
+template<typename T> T refLane(const BitVector &bv, const unsigned int &i) {
+	const unsigned int W(BITWIDTH_OF(T));
+	return static_cast<T>(static_cast<hvuint64_t>(bv((i + 1u) * W - 1u, i * W)));
+}
+
+template<typename T> bool refLess(const T &x, const T &y, const bool &isSigned) {
+	typedef typename std::make_signed<T>::type S;
+	return isSigned ? static_cast<S>(x) < static_cast<S>(y) : x < y;
+}
+
+BitVector randomBv(const BitVector::bvsize_t &size) {
+	BitVector ret(size, false);
+	ret.rand();
+	return ret;
+}
+
+} // namespace
+
+TYPED_TEST(PackedLanesTypedTest, Operations) {
+	typedef TypeParam T;
+	typedef typename std::make_signed<T>::type S;
+	const unsigned int W(BITWIDTH_OF(T));
+	// Below, equal to and above one chunk, and a size with a partial last cell
+	for (const unsigned int nLanes : { 1u, 3u, 64u / static_cast<unsigned int>(
+			sizeof(T)), 77u }) {
+		const BitVector::bvsize_t size(static_cast<BitVector::bvsize_t>(nLanes * W));
+		const BitVector a(randomBv(size)), b(randomBv(size)), mask(
+				randomBv(static_cast<BitVector::bvsize_t>(nLanes)));
+		BitVector b2(b);
+		// Some equal lanes for comparisons
+		for (unsigned int i = 0u; i < nLanes; i += 3u) {
+			b2((i + 1u) * W - 1u, i * W) = a((i + 1u) * W - 1u, i * W);
+		}
+
+		BitVector r(size, false), old(randomBv(size));
+		PackedLanes<T> lanes(r);
+		ASSERT_EQ(lanes.getNLanes(), nLanes);
+
+		for (unsigned int op = 0u; op < 9u; op++) {
+			for (const bool masked : { false, true }) {
+				r = old;
+				const unsigned int sh((op * 7u + 3u) % W);
+				switch (op) {
+				case 0:
+					masked ? lanes.add(a, b2, mask) : lanes.add(a, b2);
+					break;
+				case 1:
+					masked ? lanes.sub(a, b2, mask) : lanes.sub(a, b2);
+					break;
+				case 2:
+					masked ? lanes.min(a, b2, mask) : lanes.min(a, b2);
+					break;
+				case 3:
+					masked ? lanes.max(a, b2, mask) : lanes.max(a, b2);
+					break;
+				case 4:
+					masked ? lanes.minSigned(a, b2, mask) : lanes.minSigned(a, b2);
+					break;
+				case 5:
+					masked ? lanes.maxSigned(a, b2, mask) : lanes.maxSigned(a, b2);
+					break;
+				case 6:
+					masked ? lanes.shiftLeft(a, sh, mask) : lanes.shiftLeft(a, sh);
+					break;
+				case 7:
+					masked ? lanes.shiftRight(a, sh, mask) : lanes.shiftRight(a, sh);
+					break;
+				default:
+					masked ?
+							lanes.shiftRightArith(a, sh, mask) :
+							lanes.shiftRightArith(a, sh);
+					break;
+				}
+				for (unsigned int i = 0u; i < nLanes; i++) {
+					const T x(refLane<T>(a, i)), y(refLane<T>(b2, i));
+					T expected(0u);
+					switch (op) {
+					case 0:
+						expected = static_cast<T>(x + y);
+						break;
+					case 1:
+						expected = static_cast<T>(x - y);
+						break;
+					case 2:
+						expected = std::min(x, y);
+						break;
+					case 3:
+						expected = std::max(x, y);
+						break;
+					case 4:
+						expected = refLess(x, y, true) ? x : y;
+						break;
+					case 5:
+						expected = refLess(x, y, true) ? y : x;
+						break;
+					case 6:
+						expected = static_cast<T>(x << sh);
+						break;
+					case 7:
+						expected = static_cast<T>(x >> sh);
+						break;
+					default:
+						expected = static_cast<T>(static_cast<S>(x) >> sh);
+						break;
+					}
+					if (masked && !static_cast<bool>(mask[i])) {
+						expected = refLane<T>(old, i);
+					}
+					ASSERT_EQ(refLane<T>(r, i), expected)<< "op " << op << ", lane " << i << ", " << nLanes << " lanes";
+					ASSERT_EQ(lanes.get(i), expected);
+				}
+			}
+		}
+
+		// Comparisons
+		r = a;
+		const BitVector eq(lanes.equal(b2)), ltu(lanes.lessThan(b2)), lts(
+				lanes.lessThanSigned(b2));
+		ASSERT_EQ(eq.getSize(), nLanes);
+		for (unsigned int i = 0u; i < nLanes; i++) {
+			const T x(refLane<T>(a, i)), y(refLane<T>(b2, i));
+			ASSERT_EQ(static_cast<bool>(eq[i]), x == y);
+			ASSERT_EQ(static_cast<bool>(ltu[i]), refLess(x, y, false));
+			ASSERT_EQ(static_cast<bool>(lts[i]), refLess(x, y, true));
+		}
+
+		// Merge, fill, in-place update
+		lanes.select(mask, a, b);
+		for (unsigned int i = 0u; i < nLanes; i++) {
+			ASSERT_EQ(lanes.get(i),
+					static_cast<bool>(mask[i]) ? refLane<T>(a, i) : refLane<T>(b, i));
+		}
+		lanes.fill(static_cast<T>(0x5Au));
+		lanes.set(nLanes - 1u, static_cast<T>(1u));
+		lanes.add(r, r);
+		for (unsigned int i = 0u; i + 1u < nLanes; i++) {
+			ASSERT_EQ(refLane<T>(r, i), static_cast<T>(0xB4u));
+		}
+		ASSERT_EQ(refLane<T>(r, nLanes - 1u), static_cast<T>(2u));
+	}
+}
+
+TEST(PackedLanesTest, SubVector) {
+	// View over a slice of a wider register
+	BitVector reg(128u, false);
+	BitVector slice(reg(95u, 32u));
+	PackedLanes<hvuint16_t> lanes(slice);
+	ASSERT_EQ(lanes.getNLanes(), 4u);
+	lanes.fill(0x1234u);
+	lanes.set(0u, 0xFFFFu);
+	ASSERT_EQ(static_cast<hvuint64_t>(reg(95u, 32u)), 0x123412341234FFFFULL);
+	ASSERT_EQ(static_cast<hvuint32_t>(reg(31u, 0u)), 0u);
+	ASSERT_EQ(static_cast<hvuint32_t>(reg(127u, 96u)), 0u);
+}
@@ -0,0 +1,121 @@
+/**
+ * @file randomtest.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Tests for random.h
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+#include "bitvector.h"
+#include "random.h"
+
+using namespace ::hv::common;
+
+TEST(RandomEngineTest, KnownAnswerTest) {
+	// Reference values: SplitMix64-seeded xoshiro256**
+	RandomEngine engine(42u);
+	ASSERT_EQ(engine(), 0x1FF785474F113B15ULL);
+	ASSERT_EQ(engine(), 0x4B7867CEFF5D8325ULL);
+	ASSERT_EQ(engine(), 0x90CA7A95A9909966ULL);
+	ASSERT_EQ(engine(), 0x9C9EA6A358C5008FULL);
+
+	engine.seed(42u, 7u);
+	ASSERT_EQ(engine(), 0x24BFB39AEB008C15ULL);
+	ASSERT_EQ(engine(), 0xD858489E7FC02496ULL);
+}
+
+TEST(RandomEngineTest, SeedAndStreamTest) {
+	RandomEngine e1(1234u), e2(1234u), e3(1234u, 1u), e4(1235u);
+	bool sameStream(true), sameSeed(true);
+	for (auto i = 0u; i < 1000u; i++) {
+		const hvuint64_t x1(e1()), x3(e3()), x4(e4());
+		ASSERT_EQ(x1, e2());
+		sameStream &= (x1 == x3);
+		sameSeed &= (x1 == x4);
+	}
+	ASSERT_FALSE(sameStream);
+	ASSERT_FALSE(sameSeed);
+
+	RandomEngine e5(1234u);
+	e5.jump();
+	e1.seed(1234u);
+	ASSERT_NE(e1(), e5());
+}
+
+TEST(RandomEngineTest, FillTest) {
+	RandomEngine e1(99u), e2(99u);
+	hvuint64_t buf64[17];
+	e1.fill(buf64, 17u);
+	for (auto i = 0u; i < 17u; i++) {
+		ASSERT_EQ(buf64[i], e2());
+	}
+
+	hvuint32_t buf32[7];
+	e1.fill(buf32, 7u);
+	for (auto i = 0u; i < 6u; i += 2u) {
+		const hvuint64_t x(e2());
+		ASSERT_EQ(buf32[i], static_cast<hvuint32_t>(x));
+		ASSERT_EQ(buf32[i + 1u], static_cast<hvuint32_t>(x >> 32));
+	}
+	ASSERT_EQ(buf32[6], static_cast<hvuint32_t>(e2()));
+}
+
+TEST(RandomEngineTest, ThreadEngineTest) {
+	const std::size_t N_VALUES(256u);
+	std::vector<hvuint64_t> values1(N_VALUES), values2(N_VALUES);
+	RandomEngine *engine1(nullptr), *engine2(nullptr);
+
+	std::thread t1([&]() {
+		engine1 = &RandomEngine::getThreadEngine();
+		engine1->seed(2018u);
+		engine1->fill(values1.data(), N_VALUES);
+	});
+	std::thread t2([&]() {
+		engine2 = &RandomEngine::getThreadEngine();
+		engine2->seed(2018u);
+		engine2->fill(values2.data(), N_VALUES);
+	});
+	t1.join();
+	t2.join();
+
+	ASSERT_NE(engine1, engine2);
+	ASSERT_NE(engine1, &RandomEngine::getThreadEngine());
+	ASSERT_TRUE(values1 == values2);
+}
+
+TEST(RandomEngineTest, BitVectorRandTest) {
+	for (auto size = 1u; size <= 300u; size++) {
+		RandomEngine e1(size), e2(size);
+		BitVector bv1(size, 0u), bv2(size, 0u);
+		bv1.rand(e1);
+		bv2.rand(e2);
+		ASSERT_TRUE(bv1 == bv2)<< "Seeded rand() is not reproducible (size = " << size << ")";
+	}
+
+	// Bits are balanced
+	BitVector bv(4096u, 0u);
+	bv.rand();
+	const unsigned int w(test::getHammingWeightStr(bv.toString()));
+	ASSERT_GT(w, 1848u);
+	ASSERT_LT(w, 2248u);
+}
+
+TEST(RandomEngineTest, TestHelpersTest) {
+	for (auto n = 0u; n <= 64u; n++) {
+		const hvuint64_t x(test::randNumGen<hvuint64_t>(n));
+		if (n < 64u) {
+			ASSERT_EQ(x & ~HV_LSB_MASK_GEN(hvuint64_t, n), 0u);
+		}
+	}
+	const std::string str(test::bitRandStr(1000u));
+	ASSERT_EQ(str.length(), 1000u);
+	ASSERT_EQ(str.find_first_not_of("01"), std::string::npos);
+	ASSERT_GT(test::getHammingWeightStr(str), 400u);
+	ASSERT_LT(test::getHammingWeightStr(str), 600u);
+}
@@ -0,0 +1,178 @@
+/**
+ * @file rankselecttest.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Tests for rankselect.h
+ */
+
+#include <limits>
+#include <vector>
+#include "gtest/gtest.h"
+#include "rankselect.h"
+
+using namespace ::hv::common;
+
+typedef BitVector::bvsize_t bvsize_t;
+
+namespace {
+
+/**
+ * Reference bits
+ */
+std::vector<bool> refBits(const BitVector &bv) {
+	std::vector<bool> ret(bv.getSize());
+	for (bvsize_t i = 0u; i < bv.getSize(); i++) {
+		ret[i] = (bv.getDataAddress()[i / 32u] >> (i % 32u)) & 1u;
+	}
+	return ret;
+}
+
+/**
+ * Check all rank and select queries against reference bits
+ */
+void checkAll(const RankSelectIndex &index, const std::vector<bool> &bits) {
+	bvsize_t ones(0u), zeros(0u);
+	for (bvsize_t i = 0u; i < bits.size(); i++) {
+		ASSERT_EQ(index.rank1(i), ones)<< "position " << i;
+		ASSERT_EQ(index.rank0(i), zeros)<< "position " << i;
+		if (bits[i]) {
+			ASSERT_EQ(index.select1(ones), i)<< "rank " << ones;
+			ones++;
+		} else {
+			ASSERT_EQ(index.select0(zeros), i)<< "rank " << zeros;
+			zeros++;
+		}
+	}
+	ASSERT_EQ(index.rank1(static_cast<bvsize_t>(bits.size())), ones);
+	ASSERT_EQ(index.count(), ones);
+	ASSERT_EQ(index.select1(ones), RankSelectIndex::npos);
+	ASSERT_EQ(index.select0(zeros), RankSelectIndex::npos);
+}
+
+} // namespace
+
+TEST(RankSelectTest, RandomAgainstReference) {
+	const bvsize_t sizes[] = { 1u, 31u, 32u, 512u, 513u, 1000u, 4096u, 65535u };
+	for (const bvsize_t size : sizes) {
+		BitVector a(size, false), b(size, false);
+		a.rand();
+		b.rand();
+		// Sparse, balanced and dense bitmaps
+		BitVector bitmaps[] = { a & b, a, a | b };
+		for (BitVector &bv : bitmaps) {
+			const RankSelectIndex index(bv);
+			checkAll(index, refBits(bv));
+		}
+	}
+}
+
+TEST(RankSelectTest, IncrementalUpdate) {
+	const bvsize_t size(65535u);
+	BitVector bv(size, false);
+	RankSelectIndex index(bv);
+	std::vector<bool> bits(size, false);
+	ASSERT_EQ(index.count(), 0u);
+	ASSERT_EQ(index.select1(0u), RankSelectIndex::npos);
+	RandomEngine rng(42u);
+	for (unsigned int i = 0u; i < 1500u; i++) {
+		const bvsize_t pos(static_cast<bvsize_t>(rng() % size));
+		const bool value(i < 1200u || (rng() & 1u));
+		index.set(pos, value);
+		bits[pos] = value;
+		ASSERT_EQ(index.get(pos), value);
+		const bvsize_t probe(static_cast<bvsize_t>(rng() % size));
+		bvsize_t expected(0u);
+		for (bvsize_t j = 0u; j < probe; j++) {
+			expected += bits[j];
+		}
+		ASSERT_EQ(index.rank1(probe), expected);
+		if (bits[probe]) {
+			ASSERT_EQ(index.select1(expected), probe);
+		}
+	}
+	checkAll(index, bits);
+	ASSERT_EQ(refBits(bv), bits);
+}
+
+TEST(RankSelectTest, DirectWrites) {
+	BitVector bv(2000u, false);
+	bv.rand();
+	RankSelectIndex index(bv);
+	checkAll(index, refBits(bv));
+
+	// Writes through BitVector require invalidation
+	bv = ~bv;
+	index.invalidate();
+	checkAll(index, refBits(bv));
+
+	// Resizing is detected
+	bv.resize(700u);
+	checkAll(index, refBits(bv));
+	bv.resize(1500u);
+	checkAll(index, refBits(bv));
+}
+
+TEST(RankSelectTest, SubVector) {
+	BitVector parent(128u, false);
+	BitVector sub(parent(99u, 36u));
+	RankSelectIndex index(sub);
+	index.set(0u, true);
+	index.set(63u, true);
+	index.set(10u, true);
+	index.set(10u, false);
+	ASSERT_EQ(parent, BitVector(128u, static_cast<hvuint64_t>(1u) << 36u)
+			| (BitVector(128u, true) << 99u));
+	ASSERT_EQ(index.count(), 2u);
+	ASSERT_EQ(index.select1(1u), 63u);
+}
+
+TEST(RankSelectTest, SharedBitmap) {
+	const bvsize_t threshold(BitVector::getShareThreshold());
+	BitVector::setShareThreshold(128u);
+	BitVector bv(4096u, false);
+	bv.rand();
+	const BitVector snapshot(bv);
+	const BitVector::bvdata_t *cells(snapshot.getDataAddress());
+	ASSERT_TRUE(bv.isShared());
+
+	// Queries do not detach the indexed BitVector from its copies
+	const RankSelectIndex index(bv);
+	checkAll(index, refBits(snapshot));
+	ASSERT_TRUE(bv.isShared());
+	ASSERT_EQ(static_cast<const BitVector&>(bv).getDataAddress(), cells);
+
+	// Writes do
+	RankSelectIndex writer(bv);
+	writer.set(5u, !writer.get(5u));
+	ASSERT_FALSE(snapshot.isShared());
+	ASSERT_EQ(snapshot.getDataAddress(), cells);
+	ASSERT_EQ(bv ^ snapshot, BitVector(4096u, 1u) << 5u);
+	BitVector::setShareThreshold(threshold);
+}
+
+TEST(RankSelectTest, WideBitmap) {
+	// Bitmaps of more than 65535 bits need 32-bit sizes (HV_BV_WIDE_SIZE)
+	const hvuint32_t size((1u << 20) + 1000u);
+	if (std::numeric_limits<bvsize_t>::max() < size) {
+		return;
+	}
+	BitVector a(static_cast<bvsize_t>(size), false);
+	BitVector b(static_cast<bvsize_t>(size), false);
+	a.rand();
+	b.rand();
+	BitVector bv(a & b);
+	RankSelectIndex index(bv);
+	std::vector<bool> bits(refBits(bv));
+	checkAll(index, bits);
+
+	// Updates crossing superblocks
+	RandomEngine rng(7u);
+	for (unsigned int i = 0u; i < 1000u; i++) {
+		const bvsize_t pos(static_cast<bvsize_t>(rng() % size));
+		index.set(pos, !bits[pos]);
+		bits[pos] = !bits[pos];
+	}
+	checkAll(index, bits);
+}
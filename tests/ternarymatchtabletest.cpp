@@ -0,0 +1,139 @@
+/**
+ * @file ternarymatchtabletest.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Tests for ternarymatchtable.h
+ */
+
+#include <algorithm>
+#include <vector>
+#include "gtest/gtest.h"
+#include "ternarymatchtable.h"
+
+using namespace ::hv::common;
+
+namespace {
+
+/**
+ * Reference entry
+ */
+struct RefEntry {
+	BitVector value;
+	BitVector mask;
+	hvint32_t priority;
+	TernaryMatchTable::entryid_t id;
+};
+
+/**
+ * Reference lookup: highest priority, then lowest identifier
+ */
+TernaryMatchTable::entryid_t refLookup(const std::vector<RefEntry> &entries,
+		const BitVector &key) {
+	const RefEntry *best(nullptr);
+	for (const RefEntry &e : entries) {
+		if (!((key ^ e.value) & e.mask)
+				&& (best == nullptr || e.priority > best->priority)) {
+			best = &e;
+		}
+	}
+	return best == nullptr ? TernaryMatchTable::npos : best->id;
+}
+
+} // namespace
+
+TEST(TernaryMatchTableTest, AddressDecode) {
+	// 32-bit address decoder: 4 KiB pages, a catch-all and an overlay
+	TernaryMatchTable table(32u);
+	ASSERT_EQ(table.getKeyWidth(), 32u);
+	const TernaryMatchTable::entryid_t ram(
+			table.insert(BitVector(32u, 0x80000000u), BitVector(32u, 0xF0000000u)));
+	const TernaryMatchTable::entryid_t uart(
+			table.insert(BitVector(32u, 0x40001000u), BitVector(32u, 0xFFFFF000u)));
+	const TernaryMatchTable::entryid_t any(
+			table.insert(BitVector(32u, 0u), BitVector(32u, 0u), -1));
+	const TernaryMatchTable::entryid_t overlay(
+			table.insert(BitVector(32u, 0x80000000u), BitVector(32u, 0xFFFF0000u),
+					1));
+	ASSERT_EQ(table.size(), 4u);
+
+	ASSERT_EQ(table.lookup(BitVector(32u, 0x8FFFFFFCu)), ram);
+	ASSERT_EQ(table.lookup(BitVector(32u, 0x8000FFFCu)), overlay);
+	ASSERT_EQ(table.lookup(BitVector(32u, 0x40001ABCu)), uart);
+	ASSERT_EQ(table.lookup(BitVector(32u, 0x40002000u)), any);
+
+	const std::vector<TernaryMatchTable::entryid_t> all(
+			table.lookupAll(BitVector(32u, 0x80000004u)));
+	ASSERT_EQ(all.size(), 3u);
+	ASSERT_EQ(all[0], overlay);
+	ASSERT_EQ(all[1], ram);
+	ASSERT_EQ(all[2], any);
+
+	ASSERT_TRUE(table.erase(overlay));
+	ASSERT_FALSE(table.erase(overlay));
+	ASSERT_EQ(table.lookup(BitVector(32u, 0x8000FFFCu)), ram);
+	ASSERT_TRUE(table.erase(any));
+	ASSERT_EQ(table.lookup(BitVector(32u, 0x40002000u)), TernaryMatchTable::npos);
+
+	const hvuint64_t key(0x40001004u);
+	ASSERT_EQ(table.lookup(&key), uart);
+
+	table.clear();
+	ASSERT_EQ(table.size(), 0u);
+	ASSERT_EQ(table.lookup(BitVector(32u, 0x40001004u)), TernaryMatchTable::npos);
+}
+
+TEST(TernaryMatchTableTest, RandomAgainstReference) {
+	for (const BitVector::bvsize_t width : { 7u, 64u, 100u, 128u, 200u }) {
+		TernaryMatchTable table(width);
+		std::vector<RefEntry> entries;
+		for (unsigned int i = 0u; i < 600u; i++) {
+			// Few cared bits so that keys match several entries
+			BitVector value(width, false), m1(width, false), m2(width, false),
+					m3(width, false);
+			value.rand();
+			m1.rand();
+			m2.rand();
+			m3.rand();
+			const BitVector mask(m1 & m2 & m3);
+			const hvint32_t priority(static_cast<hvint32_t>(i % 5u));
+			const RefEntry e = { value, mask, priority, table.insert(value, mask,
+					priority) };
+			entries.push_back(e);
+
+			// Remove some entries as we go
+			if (i % 7u == 3u) {
+				const std::size_t victim((i * 13u) % entries.size());
+				ASSERT_TRUE(table.erase(entries[victim].id));
+				entries.erase(entries.begin() + victim);
+			}
+		}
+		ASSERT_EQ(table.size(), entries.size());
+
+		for (unsigned int i = 0u; i < 300u; i++) {
+			BitVector key(width, false);
+			key.rand();
+			if (i % 2u) {
+				// Key derived from an entry: guaranteed hit
+				const RefEntry &e(entries[(i * 31u) % entries.size()]);
+				key = (e.value & e.mask) | (key & ~e.mask);
+			}
+			ASSERT_EQ(table.lookup(key), refLookup(entries, key))<< "width " << width << ", key " << key.toString();
+
+			std::vector<TernaryMatchTable::entryid_t> expected;
+			for (const RefEntry &e : entries) {
+				if (!((key ^ e.value) & e.mask)) {
+					expected.push_back(e.id);
+				}
+			}
+			std::vector<TernaryMatchTable::entryid_t> all(table.lookupAll(key));
+			ASSERT_EQ(all.size(), expected.size());
+			if (!all.empty()) {
+				ASSERT_EQ(all[0], table.lookup(key));
+			}
+			std::sort(all.begin(), all.end());
+			ASSERT_TRUE(all == expected);
+		}
+	}
+}
@@ -0,0 +1,128 @@
+/**
+ * @file vcdwritertest.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Tests for vcdwriter.h
+ */
+
+#include <sstream>
+#include <vector>
+#include "gtest/gtest.h"
+#include "vcdwriter.h"
+
+using namespace ::hv::common;
+
+namespace {
+
+/**
+ * Fill a BitVector from a given engine
+ */
+void randomize(BitVector &bv, RandomEngine &rng) {
+	for (unsigned int i = 0u; i < bv.getArraySize(); i++) {
+		bv.getDataAddress()[i] = static_cast<BitVector::bvdata_t>(rng());
+	}
+}
+
+/**
+ * Random changes on a few signals, dumped with given writer options
+ */
+std::string randomDump(const bool &backgroundFlush,
+		const std::size_t &bufferSize) {
+	std::ostringstream os;
+	std::vector<BitVector> sigs;
+	const BitVector::bvsize_t sizes[] = { 1u, 7u, 32u, 33u, 100u };
+	for (const BitVector::bvsize_t size : sizes) {
+		sigs.push_back(BitVector(size, false));
+	}
+	{
+		VcdWriter vcd(os, "1 ns", backgroundFlush, bufferSize);
+		for (std::size_t i = 0u; i < sigs.size(); i++) {
+			vcd.addSignal(i % 2u ? "top.a" : "top.b", "s" + std::to_string(i),
+					sigs[i]);
+		}
+		RandomEngine rng(3u);
+		for (hvuint64_t t = 0u; t < 2000u; t += 1u + rng() % 3u) {
+			for (BitVector &s : sigs) {
+				if (!(rng() % 3u)) {
+					randomize(s, rng);
+				}
+			}
+			vcd.sample(t);
+		}
+	}
+	return os.str();
+}
+
+} // namespace
+
+TEST(VcdWriterTest, Format) {
+	std::ostringstream os;
+	BitVector clk(1u, false), data(12u, 0xABCu), flags(3u, 0u);
+	{
+		VcdWriter vcd(os, "10 ps");
+		ASSERT_EQ(vcd.addSignal("top.cpu", "data", data), 0u);
+		ASSERT_EQ(vcd.addSignal("top", "clk", clk), 1u);
+		ASSERT_EQ(vcd.addSignal("top.cpu", "flags", flags), 2u);
+		ASSERT_EQ(vcd.getNSignals(), 3u);
+		vcd.sample(0u);
+		clk = true;
+		vcd.sample(5u);
+		vcd.sample(7u); // No change, no time stamp
+		clk = false;
+		data = static_cast<hvuint32_t>(0x5u);
+		flags = static_cast<hvuint32_t>(0x4u);
+		vcd.sample(10u);
+		flags = static_cast<hvuint32_t>(0x5u);
+		vcd.sample(10u); // Same time
+	}
+	ASSERT_EQ(os.str(), std::string(
+			"$version hvcommon VcdWriter $end\n"
+			"$timescale 10 ps $end\n"
+			"$scope module top $end\n"
+			"$var wire 1 \" clk $end\n"
+			"$scope module cpu $end\n"
+			"$var wire 12 ! data [11:0] $end\n"
+			"$var wire 3 # flags [2:0] $end\n"
+			"$upscope $end\n"
+			"$upscope $end\n"
+			"$enddefinitions $end\n"
+			"#0\n"
+			"$dumpvars\n"
+			"b101010111100 !\n"
+			"0\"\n"
+			"b000 #\n"
+			"$end\n"
+			"#5\n"
+			"1\"\n"
+			"#10\n"
+			"b000000000101 !\n"
+			"0\"\n"
+			"b100 #\n"
+			"b101 #\n"));
+}
+
+TEST(VcdWriterTest, BackgroundFlush) {
+	const std::string ref(randomDump(false, HV_VCD_DEFAULT_BUFFER_SIZE));
+	ASSERT_GT(ref.size(), 10000u);
+	// Small buffers: many hand-offs, including values larger than the buffer
+	ASSERT_EQ(randomDump(false, 64u), ref);
+	ASSERT_EQ(randomDump(true, 64u), ref);
+	ASSERT_EQ(randomDump(true, 1000u), ref);
+}
+
+TEST(VcdWriterTest, Identifiers) {
+	std::ostringstream os;
+	std::vector<BitVector> sigs(200u, BitVector(1u, false));
+	VcdWriter vcd(os);
+	for (std::size_t i = 0u; i < sigs.size(); i++) {
+		vcd.addSignal("", "s" + std::to_string(i), sigs[i]);
+	}
+	vcd.sample(0u);
+	vcd.flush();
+	// 94 one-character codes, then two characters
+	ASSERT_NE(os.str().find("$var wire 1 ~ s93 $end\n"), std::string::npos);
+	ASSERT_NE(os.str().find("$var wire 1 !\" s94 $end\n"), std::string::npos);
+	ASSERT_NE(os.str().find("$var wire 1 ,# s199 $end\n"), std::string::npos);
+}
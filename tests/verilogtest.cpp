@@ -0,0 +1,145 @@
+/**
+ * @file verilogtest.cpp
+ * @author Benjamin Barrois <benjamin.barrois@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Tests for verilog.h
+ */
+
+#include <string>
+#include "gtest/gtest.h"
+#include "verilog.h"
+
+using namespace ::hv::common;
+
+TEST(VerilogTest, ParseBitVector) {
+	BitVector bv(1u, false);
+	bool isSigned(true);
+	ASSERT_TRUE(fromVerilog("32'hDEAD_BEEF", bv, &isSigned));
+	ASSERT_EQ(bv.getSize(), 32u);
+	ASSERT_EQ(static_cast<hvuint32_t>(bv), 0xDEADBEEFu);
+	ASSERT_FALSE(isSigned);
+	ASSERT_TRUE(fromVerilog("16'd1234", bv));
+	ASSERT_EQ(bv, BitVector(16u, static_cast<hvuint16_t>(1234u)));
+	ASSERT_TRUE(fromVerilog("6'o75", bv));
+	ASSERT_EQ(static_cast<hvuint32_t>(bv), 075u);
+	ASSERT_TRUE(fromVerilog(" 12 'B 1010_0101_1111 ", bv));
+	ASSERT_EQ(static_cast<hvuint32_t>(bv), 0xA5Fu);
+	ASSERT_TRUE(fromVerilog("-8'sd5", bv, &isSigned));
+	ASSERT_EQ(static_cast<hvuint32_t>(bv), 0xFBu);
+	ASSERT_TRUE(isSigned);
+
+	// Unsized literals, truncation and extension
+	ASSERT_TRUE(fromVerilog("'hff", bv));
+	ASSERT_EQ(bv.getSize(), HV_VERILOG_UNSIZED_BITWIDTH);
+	ASSERT_EQ(static_cast<hvuint32_t>(bv), 0xFFu);
+	ASSERT_TRUE(fromVerilog("1_000_000", bv, &isSigned));
+	ASSERT_EQ(static_cast<hvuint32_t>(bv), 1000000u);
+	ASSERT_TRUE(isSigned);
+	ASSERT_TRUE(fromVerilog("4'hABC", bv));
+	ASSERT_EQ(static_cast<hvuint32_t>(bv), 0xCu);
+	ASSERT_TRUE(fromVerilog("4'd18", bv));
+	ASSERT_EQ(static_cast<hvuint32_t>(bv), 2u);
+	ASSERT_TRUE(fromVerilog("70'h1", bv));
+	ASSERT_EQ(bv, BitVector(70u, 1u));
+
+	// Unknown bits are 0 in BitVectors
+	ASSERT_FALSE(fromVerilog("8'b1010_xxxx", bv));
+	ASSERT_EQ(static_cast<hvuint32_t>(bv), 0xA0u);
+	ASSERT_FALSE(fromVerilog("8'hz", bv));
+	ASSERT_EQ(static_cast<hvuint32_t>(bv), 0u);
+}
+
+TEST(VerilogTest, ParseWide) {
+	BitVector bv(1u, false);
+	ASSERT_TRUE(fromVerilog("128'h0123456789abcdef_fedcba9876543210", bv));
+	ASSERT_EQ(static_cast<hvuint64_t>(bv), 0xFEDCBA9876543210ull);
+	ASSERT_EQ(static_cast<hvuint64_t>(bv >> 64u), 0x0123456789ABCDEFull);
+	ASSERT_TRUE(fromVerilog("128'd1267650600228229401496703205376", bv));
+	ASSERT_EQ(bv, BitVector(128u, 1u) << 100u);
+	ASSERT_TRUE(fromVerilog("100'o7777777777777777777777777777777777", bv));
+	ASSERT_EQ(bv, ~BitVector(100u, 0u));
+
+	// Round trips through the printer
+	RandomEngine engine(3u);
+	for (auto size : {1u, 7u, 31u, 32u, 33u, 64u, 100u, 1000u}) {
+		BitVector ref(size, 0u);
+		for (hvuint32_t i = 0u; i < 50u; i++) {
+			ref.rand(engine);
+			for (char base : {'b', 'o', 'd', 'h'}) {
+				for (bool grouped : {false, true}) {
+					const std::string literal(toVerilog(ref, base, grouped));
+					ASSERT_TRUE(fromVerilog(literal, bv)) << literal;
+					ASSERT_EQ(bv, ref) << literal;
+				}
+			}
+		}
+	}
+}
+
+TEST(VerilogTest, ParseLogicVector) {
+	LogicVector lv(1u, LOGIC_0);
+	fromVerilog("8'b1010_xxxx", lv);
+	ASSERT_EQ(lv, LogicVector(std::string("1010XXXX")));
+	fromVerilog("12'hz5?", lv);
+	ASSERT_EQ(lv, LogicVector(std::string("ZZZZ0101ZZZZ")));
+	fromVerilog("8'hx", lv);
+	ASSERT_EQ(lv, LogicVector(8u, LOGIC_X));
+	fromVerilog("6'bz1", lv);
+	ASSERT_EQ(lv, LogicVector(std::string("ZZZZZ1")));
+	fromVerilog("4'dz", lv);
+	ASSERT_EQ(lv, LogicVector(4u, LOGIC_Z));
+	fromVerilog("4'b01", lv);
+	ASSERT_TRUE(lv.isFullyKnown());
+	ASSERT_EQ(lv.toBitVector(), BitVector(4u, 1u));
+	fromVerilog("-4'b1x", lv);
+	ASSERT_EQ(lv, LogicVector(4u, LOGIC_X));
+
+	// Unknown negative literal reads as 0 in a BitVector
+	BitVector bv(4u, 0u);
+	ASSERT_FALSE(fromVerilog("-4'b1x", bv));
+	ASSERT_EQ(bv, BitVector(4u, 0u));
+	ASSERT_FALSE(fromVerilog("-40'hx1", bv));
+	ASSERT_EQ(bv, BitVector(40u, 0u));
+}
+
+TEST(VerilogTest, Print) {
+	ASSERT_EQ(toVerilog(BitVector(32u, 0xDEADBEEFu)), "32'hdeadbeef");
+	ASSERT_EQ(toVerilog(BitVector(32u, 0xDEADBEEFu), 'H', true),
+			"32'hdead_beef");
+	ASSERT_EQ(toVerilog(BitVector(10u, 0x2A5u), 'b', true), "10'b10_1010_0101");
+	ASSERT_EQ(toVerilog(BitVector(7u, 0x7Fu), 'o'), "7'o177");
+	ASSERT_EQ(toVerilog(BitVector(16u, static_cast<hvuint16_t>(1234u)), 'd'),
+			"16'd1234");
+	ASSERT_EQ(toVerilog(BitVector(32u, 1234567u), 'd', true), "32'd1_234_567");
+	ASSERT_EQ(toVerilog(BitVector(5u, 0x11u)), "5'h11");
+
+	ASSERT_EQ(toVerilog(LogicVector(std::string("1010XXXX")), 'h'), "8'hax");
+	ASSERT_EQ(toVerilog(LogicVector(std::string("ZZZZ0101")), 'h'), "8'hz5");
+	ASSERT_EQ(toVerilog(LogicVector(std::string("10X1")), 'h'), "4'b10x1");
+	ASSERT_EQ(toVerilog(LogicVector(8u, LOGIC_X), 'd'), "8'dx");
+	ASSERT_EQ(toVerilog(LogicVector(std::string("0000000Z")), 'd'),
+			"8'b0000000z");
+	ASSERT_EQ(toVerilog(LogicVector(std::string("01100100")), 'd'), "8'd100");
+
+	// Round trip of four-state values
+	LogicVector lv(1u, LOGIC_0);
+	for (const char *literal : { "8'b1010_xxxx", "12'hz5x", "3'o7", "9'b1x0z1x0z1" }) {
+		fromVerilog(literal, lv);
+		LogicVector back(1u, LOGIC_0);
+		fromVerilog(toVerilog(lv, 'h'), back);
+		ASSERT_EQ(back, lv) << literal;
+	}
+}
+
+TEST(VerilogTest, InvalidLiterals) {
+	BitVector bv(1u, false);
+	ASSERT_DEATH(fromVerilog("8'hG1", bv), "");
+	ASSERT_DEATH(fromVerilog("8'q1", bv), "");
+	ASSERT_DEATH(fromVerilog("0'h1", bv), "");
+	ASSERT_DEATH(fromVerilog("8'h", bv), "");
+	ASSERT_DEATH(fromVerilog("8'b102", bv), "");
+	ASSERT_DEATH(fromVerilog("8'd1x", bv), "");
+	ASSERT_DEATH(fromVerilog("", bv), "");
+}